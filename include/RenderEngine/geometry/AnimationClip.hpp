@@ -0,0 +1,32 @@
+#pragma once
+#include <RenderEngine/geometry/AnimationTrack.hpp>
+#include <array>
+#include <vector>
+
+namespace RenderEngine
+{
+    // A set of animation tracks played together. Applying the clip samples all the tracks with a vectorized kernel,
+    // and writes the interpolated coordinates in the tracks' targets.
+    // Positions and scales are interpolated linearly, orientations with an approximation of SLERP (a corrected normalized linear interpolation).
+    class AnimationClip
+    {
+    public:
+        AnimationClip(bool looping=true);
+        ~AnimationClip();
+    public:
+        // Returns the duration of the longest track
+        double duration() const;
+        // Samples all the tracks at the given time and writes the results in their targets. The time wraps around the duration if the clip is looping.
+        void apply(double time);
+        // Returns the unit quaternion interpolated between unit quaternions q1 (with weight 1-t) and q2 (with weight t), with an approximation of SLERP
+        static Quaternion approximate_SLERP(const Quaternion& q1, const Quaternion& q2, double t);
+    public:
+        std::vector<AnimationTrack> tracks;
+        bool looping = true;
+    protected:
+        // keyframes surrounding the sampled time of each track, gathered for the vectorized kernel, padded to a multiple of FloatPack::size
+        std::vector<float> _weights; // interpolation weight of the second keyframe
+        std::array<std::vector<float>, 8> _from; // x, y, z, qw, qx, qy, qz, scale of the first keyframe
+        std::array<std::vector<float>, 8> _to; // x, y, z, qw, qx, qy, qz, scale of the second keyframe
+    };
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <RenderEngine/geometry/Vector.hpp>
+#include <RenderEngine/geometry/Quaternion.hpp>
+#include <RenderEngine/geometry/Referential.hpp>
+#include <array>
+#include <tuple>
+#include <vector>
+
+namespace RenderEngine
+{
+    // The keyframes of the coordinates of a Referential, stored as contiguous arrays of floats (structure of arrays).
+    // Orientations are normalized when keyframes are added, so that sampling does not need to.
+    class AnimationTrack
+    {
+    public:
+        AnimationTrack() = delete;
+        AnimationTrack(Referential* target);
+        ~AnimationTrack();
+    public:
+        // Adds a keyframe. Keyframes must be added by increasing time.
+        void add_keyframe(double time, const Vector& position, const Quaternion& orientation, double scale=1.0);
+        // Returns the number of keyframes
+        std::size_t size() const;
+        // Returns the time of the last keyframe
+        double duration() const;
+        // Returns the index 'i' of the keyframe such that times[i] <= time < times[i+1] (clamped to the first and last segments).
+        // The segment of the previous call is tested first, then the next one, so that playing forward is O(1).
+        std::size_t segment(float time) const;
+        // Returns the interpolated coordinates at the given time, as AnimationClip would apply them to the target
+        std::tuple<Vector, Quaternion, double> sample(double time) const;
+    public:
+        Referential* target = nullptr; // referential whose coordinates are animated
+        std::vector<float> times;
+        std::array<std::vector<float>, 3> positions; // x, y, z
+        std::array<std::vector<float>, 4> orientations; // w, x, y, z of unit quaternions
+        std::vector<float> scales;
+    protected:
+        mutable std::size_t _segment = 0; // segment found at last call of 'segment'
+    };
+}
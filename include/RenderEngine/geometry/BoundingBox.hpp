@@ -0,0 +1,36 @@
+#pragma once
+#include <RenderEngine/geometry/Vector.hpp>
+#include <RenderEngine/geometry/Transform.hpp>
+#include <cstddef>
+#include <ostream>
+
+namespace RenderEngine
+{
+    // An axis aligned bounding box, defined by its lower and upper corners. A box with a lower corner above its upper corner is empty.
+    class BoundingBox
+    {
+    public:
+        BoundingBox();
+        BoundingBox(const Vector& lower, const Vector& upper);
+        ~BoundingBox();
+    public:
+        Vector lower;
+        Vector upper;
+    public:
+        // Returns true if the box contains no point
+        bool is_empty() const;
+        // Returns the center of the box
+        Vector center() const;
+        // Returns the half size of the box along each axis
+        Vector half_extents() const;
+        // Returns the smallest box containing this one and the given point
+        BoundingBox expanded(const Vector& point) const;
+        // Returns the smallest box containing both boxes
+        BoundingBox merged(const BoundingBox& other) const;
+        // Returns the smallest axis aligned box containing this box once transformed
+        BoundingBox transformed(const Transform& transform) const;
+        // Returns the bounding box of 'count' points, given as three arrays of coordinates
+        static BoundingBox from_points(const float* x, const float* y, const float* z, std::size_t count);
+        friend std::ostream& operator<<(std::ostream& os, const BoundingBox& box);
+    };
+}
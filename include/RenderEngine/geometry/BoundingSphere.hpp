@@ -0,0 +1,30 @@
+#pragma once
+#include <RenderEngine/geometry/Vector.hpp>
+#include <RenderEngine/geometry/Transform.hpp>
+#include <cstddef>
+#include <ostream>
+
+namespace RenderEngine
+{
+    // A sphere containing an object. A sphere of negative radius is empty.
+    class BoundingSphere
+    {
+    public:
+        BoundingSphere();
+        BoundingSphere(const Vector& center, double radius);
+        ~BoundingSphere();
+    public:
+        Vector center;
+        double radius = -1.0;
+    public:
+        // Returns true if the sphere contains no point
+        bool is_empty() const;
+        // Returns the smallest sphere containing both spheres
+        BoundingSphere merged(const BoundingSphere& other) const;
+        // Returns a sphere containing this sphere once transformed
+        BoundingSphere transformed(const Transform& transform) const;
+        // Returns a sphere containing the 'count' points given as three arrays of coordinates, centered on their bounding box center
+        static BoundingSphere from_points(const float* x, const float* y, const float* z, std::size_t count);
+        friend std::ostream& operator<<(std::ostream& os, const BoundingSphere& sphere);
+    };
+}
@@ -1,30 +1,35 @@
 #pragma once
 #include <RenderEngine/graphics/shaders/Types.hpp>
+#include <RenderEngine/geometry/Vector.hpp>
+#include <RenderEngine/geometry/Quaternion.hpp>
 #include <ostream>
 #include <array>
 
 namespace RenderEngine
 {
-    class Vector;
-    class Quaternion;
-
-    class Matrix
+    // A 3x3 matrix of scalars of type T (float or double)
+    template<typename T>
+    class alignas(16) MatrixT
     {
     public:
-        Matrix();
-        Matrix(const Matrix& other);
-        Matrix(const Vector& diagonal);
-        Matrix(const std::array<std::array<double, 3>, 3>& elements);
-        Matrix(const Quaternion& quat);
-        ~Matrix();
+        constexpr MatrixT() : scalars{{{0., 0., 0.}, {0., 0., 0.}, {0., 0., 0.}}} {}
+        constexpr MatrixT(const MatrixT& other) : scalars(other.scalars) {}
+        constexpr MatrixT(const VectorT<T>& diagonal) : scalars{{{diagonal.x, 0., 0.}, {0., diagonal.y, 0.}, {0., 0., diagonal.z}}} {}
+        constexpr MatrixT(const std::array<std::array<T, 3>, 3>& elements) : scalars(elements) {}
+        MatrixT(const QuaternionT<T>& quat);
+        ~MatrixT() = default;
     public:
-        std::array<std::array<double, 3>, 3> scalars = {{{0., 0., 0.}, {0., 0., 0.}, {0., 0., 0.}}};
+        std::array<std::array<T, 3>, 3> scalars = {{{0., 0., 0.}, {0., 0., 0.}, {0., 0., 0.}}};
     public:
-        Matrix transposed() const;
+        MatrixT transposed() const;
         mat3 to_mat3() const;
-        Matrix operator*(const Matrix& other) const;
-        Vector operator*(const Vector& vector) const;
-        Matrix& operator=(const Matrix& other);
-        friend std::ostream& operator<<(std::ostream& os, const Matrix& mat);
+        MatrixT operator*(const MatrixT& other) const;
+        VectorT<T> operator*(const VectorT<T>& vector) const;
+        constexpr MatrixT& operator=(const MatrixT& other) {scalars = other.scalars; return *this;}
+        template<typename U>
+        friend std::ostream& operator<<(std::ostream& os, const MatrixT<U>& mat);
     };
+
+    typedef MatrixT<double> Matrix;
+    typedef MatrixT<float> Matrixf;
 }
@@ -1,57 +1,73 @@
 #pragma once
+#include <RenderEngine/geometry/Vector.hpp>
 #include <ostream>
 #include <cmath>
 
 namespace RenderEngine
 {
-    class Vector;
     class Referential;
 
-    class Quaternion
+    // A quaternion of scalars of type T (float or double). Storage is 16 bytes aligned so that it can be loaded in SIMD registers.
+    template<typename T>
+    class alignas(16) QuaternionT
     {
     public:
-        Quaternion();
-        Quaternion(const Quaternion& other);
-        Quaternion(double w, double x, double y, double z);
-        Quaternion(double radians, const Vector& axis);
-        Quaternion(const Vector& from, const Vector& to);
-        ~Quaternion();
+        constexpr QuaternionT() : w(1), x(0), y(0), z(0) {}
+        constexpr QuaternionT(const QuaternionT& other) : w(other.w), x(other.x), y(other.y), z(other.z) {}
+        constexpr QuaternionT(T W, T X, T Y, T Z) : w(W), x(X), y(Y), z(Z) {}
+        template<typename U>
+        explicit constexpr QuaternionT(const QuaternionT<U>& other) : w(static_cast<T>(other.w)), x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)) {}
+        QuaternionT(T radians, const VectorT<T>& axis);
+        QuaternionT(const VectorT<T>& from, const VectorT<T>& to);
+        ~QuaternionT() = default;
     public:
-        double w = 1.;
-        double x = 0.;
-        double y = 0.;
-        double z = 0.;
+        T w = 1.;
+        T x = 0.;
+        T y = 0.;
+        T z = 0.;
     public:
         ///< Return the norm of the quaternion
-        double norm() const;
+        T norm() const;
+        ///< Return the squared norm of the quaternion
+        constexpr T squared_norm() const {return w*w + x*x + y*y + z*z;}
         ///< Normalize the quaternion so that it's norm is 1
         void normalize();
         ///< Returns the quaternion of unit norm (rotation around an axis without deformation)
-        Quaternion normed() const;
+        QuaternionT normed() const;
         ///< Returns the conjugate quaternion
-        Quaternion conjugate() const;
+        constexpr QuaternionT conjugate() const {return QuaternionT(w, -x, -y, -z);}
         ///< Returns the inverse quaternion
-        Quaternion inverse() const;
+        QuaternionT inverse() const;
+        ///< Rotates a vector, without building the intermediate quaternion products of 'operator*'. Equivalent to (*this) * vector.
+        VectorT<T> rotate(const VectorT<T>& vector) const;
         ///< Returns true if the two quaternions are close enough to be considered equals
-        static bool equal(const Quaternion& q1, const Quaternion& q2, double tolerance=1.0E-6);
+        static bool equal(const QuaternionT& q1, const QuaternionT& q2, T tolerance=static_cast<T>(1.0E-6));
         ///< Dot product of two quaternions
-        static double dot(const Quaternion& q1, const Quaternion& q2);
+        static constexpr T dot(const QuaternionT& q1, const QuaternionT& q2) {return q1.w*q2.w + q1.x*q2.x + q1.y*q2.y + q1.z*q2.z;}
         ///< SLERP of two quaternions (Spherical Linear intERPolation). q1 has weight (1-t) and q2 has weight t.
-        static Quaternion SLERP(const Quaternion& q1, const Quaternion& q2, double t);
+        static QuaternionT SLERP(const QuaternionT& q1, const QuaternionT& q2, T t);
     public:
-        friend std::ostream& operator<<(std::ostream& os, const Quaternion& rot);
-        Quaternion& operator=(const Quaternion& other);
-        Quaternion operator*(const Quaternion& other) const;
-        Vector operator*(const Vector& vector) const;
-        Quaternion operator*(double other) const;
-        friend Quaternion operator*(double other, const Quaternion& quat);
-        Quaternion& operator*=(double other);
-        Quaternion operator/(double other) const;
-        Quaternion& operator/=(double other);
-        Quaternion operator+(const Quaternion& other) const;
-        Quaternion& operator+=(const Quaternion& other);
-        Quaternion operator-(const Quaternion& other) const;
-        Quaternion operator-() const;
-        Quaternion& operator-=(const Quaternion& other);
+        template<typename U>
+        friend std::ostream& operator<<(std::ostream& os, const QuaternionT<U>& rot);
+        constexpr QuaternionT& operator=(const QuaternionT& other) {w = other.w; x = other.x; y = other.y; z = other.z; return *this;}
+        QuaternionT operator*(const QuaternionT& other) const;
+        VectorT<T> operator*(const VectorT<T>& vector) const;
+        constexpr QuaternionT operator*(T other) const {return QuaternionT(w*other, x*other, y*other, z*other);}
+        friend constexpr QuaternionT operator*(T other, const QuaternionT& quat) {return QuaternionT(quat.w*other, quat.x*other, quat.y*other, quat.z*other);}
+        constexpr QuaternionT& operator*=(T other) {w *= other; x *= other; y *= other; z *= other; return *this;}
+        constexpr QuaternionT operator/(T other) const {return QuaternionT(w/other, x/other, y/other, z/other);}
+        constexpr QuaternionT& operator/=(T other) {w /= other; x /= other; y /= other; z /= other; return *this;}
+        constexpr QuaternionT operator+(const QuaternionT& other) const {return QuaternionT(w+other.w, x+other.x, y+other.y, z+other.z);}
+        constexpr QuaternionT& operator+=(const QuaternionT& other) {w += other.w; x += other.x; y += other.y; z += other.z; return *this;}
+        constexpr QuaternionT operator-(const QuaternionT& other) const {return QuaternionT(w-other.w, x-other.x, y-other.y, z-other.z);}
+        constexpr QuaternionT operator-() const {return QuaternionT(-w, -x, -y, -z);}
+        constexpr QuaternionT& operator-=(const QuaternionT& other) {w -= other.w; x -= other.x; y -= other.y; z -= other.z; return *this;}
     };
+
+    // SSE specialization of the quaternion product for floats
+    template<>
+    QuaternionT<float> QuaternionT<float>::operator*(const QuaternionT<float>& other) const;
+
+    typedef QuaternionT<double> Quaternion;
+    typedef QuaternionT<float> Quaternionf;
 }
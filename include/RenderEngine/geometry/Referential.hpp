@@ -1,10 +1,27 @@
 #pragma once
 #include <RenderEngine/geometry/Vector.hpp>
 #include <RenderEngine/geometry/Quaternion.hpp>
+#include <RenderEngine/geometry/Transform.hpp>
 #include <list>
+#include <tuple>
+#include <vector>
+#include <array>
 
 namespace RenderEngine
 {
+    // Coordinates of many referentials in another referential, stored as contiguous arrays of floats (structure of arrays).
+    // The arrays are padded to a multiple of FloatPack::size, only the first 'size' elements are meaningful.
+    struct ReferentialsCoordinates
+    {
+        std::size_t size = 0;
+        std::array<std::vector<float>, 3> position; // x, y, z
+        std::array<std::vector<float>, 4> orientation; // w, x, y, z
+        std::array<std::vector<float>, 9> inverse_rotation; // row major coefficients of the rotation matrix of the inverse orientation
+        std::vector<float> scale;
+    };
+
+    // The coordinates of a referential are written through setters, which mark the referential and all its childrens as needing their absolute coordinates
+    // to be recomputed. Queries on a referential that was not modified (nor any of its parents) since the last query then return the cached absolute coordinates in O(1).
     class Referential
     {
     public:
@@ -18,15 +35,45 @@ namespace RenderEngine
         void detach();
         // Attach this referential to given parent. This methods starts by calling the 'detach' method.
         void attach(Referential& parent);
+        // Position in parent's referential (or in absolute referential if parent is null)
+        const Vector& position() const;
+        void set_position(const Vector& position);
+        // Rotation to apply to transition from a parent referential's (or absolute referential if parent is null) orientation to this referential's
+        const Quaternion& orientation() const;
+        void set_orientation(const Quaternion& orientation);
+        // Scaling applied to all childs of this referential
+        double scale() const;
+        void set_scale(double scale);
+        // Sets the position, orientation and scale at once
+        void set_coordinates(const Vector& position, const Quaternion& orientation, double scale);
         // Converts this referential's coordinates/orientation/scale to absolute coordinates
         std::tuple<Vector, Quaternion, double> absolute_coordinates() const;
         // Converts this referential's coordinates/orientation/scale in another referential
         std::tuple<Vector, Quaternion, double> coordinates_in(const Referential& other) const;
+        // Returns the transform from this referential's coordinates to absolute coordinates, as applied to a mesh drawn at 'absolute_coordinates'
+        Transform absolute_transform() const;
+        // Returns the transform from this referential's coordinates to another referential's coordinates, as applied to a mesh drawn at 'coordinates_in(other)'
+        Transform transform_in(const Referential& other) const;
+        // Converts the coordinates of all the given referentials in another referential, as 'coordinates_in' would, with a vectorized kernel. The 'coordinates' arrays are reused between calls.
+        static void bulk_coordinates_in(const Referential& other, const std::vector<const Referential*>& referentials, ReferentialsCoordinates& coordinates);
     public:
         Referential* parent = nullptr;
         std::list<Referential*> childrens;
-        Vector position; // position in parent's referential (or in absolute referential if parent is null)
-        Quaternion orientation; // rotation to apply to transition from a parent referential's (or absolute referential if parent is null) orientation to this referential's
-        double scale = 1.0; // scaling applied to all childs of this referential
+    protected:
+        Vector _position;
+        Quaternion _orientation;
+        double _scale = 1.0;
+    protected:
+        // Mark this referential and all its childrens as needing their absolute coordinates to be recomputed. The childrens of a dirty referential are always dirty.
+        void _invalidate() const;
+        // Recompute the cached absolute coordinates if this referential is dirty, after those of its dirty parents
+        void _update_cache() const;
+    protected: // cache of absolute coordinates, recomputed lazily when this referential or one of its parents is modified
+        mutable bool _dirty = true;
+        mutable Vector _absolute_position;
+        mutable Quaternion _absolute_orientation;
+        mutable Quaternion _absolute_inverse_orientation;
+        mutable double _absolute_scale = 1.0;
+        mutable Quaternion _inverse_rotation_chain; // inverse of the product of orientations from this referential up to the root, used to convert childrens positions to absolute positions
     };
 }
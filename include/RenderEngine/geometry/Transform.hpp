@@ -0,0 +1,50 @@
+#pragma once
+#include <RenderEngine/graphics/shaders/Types.hpp>
+#include <RenderEngine/geometry/Vector.hpp>
+#include <RenderEngine/geometry/Quaternion.hpp>
+#include <RenderEngine/geometry/Matrix.hpp>
+#include <ostream>
+#include <array>
+#include <tuple>
+
+namespace RenderEngine
+{
+    // A 4x4 affine transformation of scalars of type T (float or double). Only the 3 first rows are stored, the last one being always (0, 0, 0, 1).
+    template<typename T>
+    class alignas(16) TransformT
+    {
+    public:
+        constexpr TransformT() : scalars{{{1., 0., 0., 0.}, {0., 1., 0., 0.}, {0., 0., 1., 0.}}} {}
+        constexpr TransformT(const TransformT& other) : scalars(other.scalars) {}
+        constexpr TransformT(const std::array<std::array<T, 4>, 3>& elements) : scalars(elements) {}
+        // Transform that applies the linear transformation 'matrix', then the translation 'position'
+        TransformT(const MatrixT<T>& matrix, const VectorT<T>& position);
+        // Transform that scales, rotates and then translates, the way a mesh is drawn at the given coordinates
+        TransformT(const VectorT<T>& position, const QuaternionT<T>& orientation, T scale);
+        TransformT(const std::tuple<VectorT<T>, QuaternionT<T>, T>& coordinates);
+        ~TransformT() = default;
+    public:
+        std::array<std::array<T, 4>, 3> scalars = {{{1., 0., 0., 0.}, {0., 1., 0., 0.}, {0., 0., 1., 0.}}};
+    public:
+        // Returns the translation part of the transform
+        constexpr VectorT<T> position() const {return VectorT<T>(scalars[0][3], scalars[1][3], scalars[2][3]);}
+        // Returns the linear part of the transform
+        MatrixT<T> matrix() const;
+        // Returns the inverse transform
+        TransformT inverse() const;
+        // Applies the linear part of the transform only (for directions)
+        VectorT<T> apply_to_direction(const VectorT<T>& direction) const;
+        // Returns a column major mat4 as expected by glsl
+        mat4 to_mat4() const;
+        // Composition of transforms: (A*B) applies B first, then A
+        TransformT operator*(const TransformT& other) const;
+        // Transforms a point
+        VectorT<T> operator*(const VectorT<T>& point) const;
+        constexpr TransformT& operator=(const TransformT& other) {scalars = other.scalars; return *this;}
+        template<typename U>
+        friend std::ostream& operator<<(std::ostream& os, const TransformT<U>& transform);
+    };
+
+    typedef TransformT<double> Transform;
+    typedef TransformT<float> Transformf;
+}
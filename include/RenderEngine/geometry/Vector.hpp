@@ -5,52 +5,62 @@
 
 namespace RenderEngine
 {
-    class Vector
+    // A 3D vector of scalars of type T (float or double). Storage is 16 bytes aligned so that it can be loaded in SIMD registers.
+    template<typename T>
+    class alignas(16) VectorT
     {
     public:
-        double x = 0.;
-        double y = 0.;
-        double z = 0.;
+        T x = 0.;
+        T y = 0.;
+        T z = 0.;
     public:
-        Vector();
-        Vector(const Vector& other);
-        Vector(const std::initializer_list<double>& elements);
-        Vector(double X, double Y, double Z);
-        ~Vector();
+        constexpr VectorT() : x(0), y(0), z(0) {}
+        constexpr VectorT(const VectorT& other) : x(other.x), y(other.y), z(other.z) {}
+        constexpr VectorT(T X, T Y, T Z) : x(X), y(Y), z(Z) {}
+        template<typename U>
+        explicit constexpr VectorT(const VectorT<U>& other) : x(static_cast<T>(other.x)), y(static_cast<T>(other.y)), z(static_cast<T>(other.z)) {}
+        VectorT(const std::initializer_list<T>& elements);
+        ~VectorT() = default;
         ///< Convert to a vec3
         vec3 to_vec3() const;
         ///< Convert to a vec4 (with a trailing 0)
         vec4 to_vec4() const;
         //!< Returns the norm of a Vector
-        double norm() const;
+        T norm() const;
+        //!< Returns the squared norm of a Vector
+        constexpr T squared_norm() const {return x*x + y*y + z*z;}
         ///< Return the vector with unit norm (or the null vector)
-        Vector normed() const;
+        VectorT normed() const;
         ///< Return the vector projected on the given axis
-        Vector projected(const Vector& axis) const;
+        VectorT projected(const VectorT& axis) const;
         ///< Test if two vectors are equal, given a tolerance
-        static bool equal(const Vector& vec1, const Vector& vec2, double tolerance=1.0E-6);
+        static bool equal(const VectorT& vec1, const VectorT& vec2, T tolerance=static_cast<T>(1.0E-6));
         ///< Cross product of two vector
-        static Vector cross(const Vector& vec1, const Vector& vec2);
+        static constexpr VectorT cross(const VectorT& vec1, const VectorT& vec2) {return VectorT(vec1.y*vec2.z-vec2.y*vec1.z, vec1.z*vec2.x-vec2.z*vec1.x, vec1.x*vec2.y-vec2.x*vec1.y);}
         ///< Dot product of two vector
-        static double dot(const Vector& vec1, const Vector& vec2);
+        static constexpr T dot(const VectorT& vec1, const VectorT& vec2) {return vec1.x*vec2.x+vec1.y*vec2.y+vec1.z*vec2.z;}
         ///< Signed angle between two vectors. Such that v2 is v1 rotated by 'angle' around Vector::cross(v1,v2) (if it's norm is superior to 0)
-        static double angle(const Vector& v1, const Vector& v2);
-        Vector& operator=(const Vector& other);
-        Vector operator-() const;
-        friend std::ostream& operator<<(std::ostream& os, const Vector& vec);
-        Vector operator+(const Vector& other) const;
-        Vector operator-(const Vector& other) const;
-        Vector operator*(const Vector& other) const;
-        Vector operator*(const double other) const;
-        friend Vector operator*(double other, const Vector& vec);
-        Vector operator/(const Vector& other) const;
-        Vector operator/(const double other) const;
-        friend Vector operator/(double other, const Vector& vec);
-        Vector& operator+=(const Vector& other);
-        Vector& operator-=(const Vector& other);
-        Vector& operator*=(const Vector& other);
-        Vector& operator*=(const double other);
-        Vector& operator/=(const Vector& other);
-        Vector& operator/=(const double other);
+        static T angle(const VectorT& v1, const VectorT& v2);
+        constexpr VectorT& operator=(const VectorT& other) {x=other.x; y=other.y; z=other.z; return *this;}
+        constexpr VectorT operator-() const {return VectorT(-x, -y, -z);}
+        template<typename U>
+        friend std::ostream& operator<<(std::ostream& os, const VectorT<U>& vec);
+        constexpr VectorT operator+(const VectorT& other) const {return VectorT(x+other.x, y+other.y, z+other.z);}
+        constexpr VectorT operator-(const VectorT& other) const {return VectorT(x-other.x, y-other.y, z-other.z);}
+        constexpr VectorT operator*(const VectorT& other) const {return VectorT(x*other.x, y*other.y, z*other.z);}
+        constexpr VectorT operator*(const T other) const {return VectorT(x*other, y*other, z*other);}
+        friend constexpr VectorT operator*(T other, const VectorT& vec) {return VectorT(vec.x*other, vec.y*other, vec.z*other);}
+        constexpr VectorT operator/(const VectorT& other) const {return VectorT(x/other.x, y/other.y, z/other.z);}
+        constexpr VectorT operator/(const T other) const {return VectorT(x/other, y/other, z/other);}
+        friend constexpr VectorT operator/(T other, const VectorT& vec) {return VectorT(other/vec.x, other/vec.y, other/vec.z);}
+        constexpr VectorT& operator+=(const VectorT& other) {x+=other.x; y+=other.y; z+=other.z; return *this;}
+        constexpr VectorT& operator-=(const VectorT& other) {x-=other.x; y-=other.y; z-=other.z; return *this;}
+        constexpr VectorT& operator*=(const VectorT& other) {x*=other.x; y*=other.y; z*=other.z; return *this;}
+        constexpr VectorT& operator*=(const T other) {x*=other; y*=other; z*=other; return *this;}
+        constexpr VectorT& operator/=(const VectorT& other) {x/=other.x; y/=other.y; z/=other.z; return *this;}
+        constexpr VectorT& operator/=(const T other) {x/=other; y/=other; z/=other; return *this;}
     };
+
+    typedef VectorT<double> Vector;
+    typedef VectorT<float> Vectorf;
 }
@@ -1,4 +1,9 @@
+#include "AnimationClip.hpp"
+#include "AnimationTrack.hpp"
+#include "BoundingBox.hpp"
+#include "BoundingSphere.hpp"
 #include "Matrix.hpp"
 #include "Quaternion.hpp"
 #include "Referential.hpp"
+#include "Transform.hpp"
 #include "Vector.hpp"
\ No newline at end of file
@@ -10,27 +10,45 @@ namespace RenderEngine
     {
         friend class Canvas;
         friend class Image;
+        friend class StagingRing;
+    public:
+        // Memory of the buffer. HOST_VISIBLE memory is persistently mapped and written directly. DEVICE_LOCAL memory is faster to read for the GPU,
+        // and is written through the staging ring of the GPU, unless it happens to be host visible too (on integrated GPUs).
+        enum Memory {HOST_VISIBLE, DEVICE_LOCAL};
     public: // This class is non copyable
         Buffer() = delete;
         Buffer(const Buffer& other) = delete;
         Buffer& operator=(const Buffer& other) = delete;
     public:
-        Buffer(const GPU* gpu, size_t bytes_size, VkBufferUsageFlags usage);
+        Buffer(const GPU* gpu, size_t bytes_size, VkBufferUsageFlags usage, Memory memory=HOST_VISIBLE);
         ~Buffer();
     public:
         const GPU* gpu;
     public:
         std::size_t bytes_size() const;
+        // Returns the memory the buffer was created with
+        Memory memory() const;
+        // Copies data to the buffer. Uploads to a buffer that is not mapped are completed asynchronously (see StagingRing), before the next rendering of a Canvas.
         void upload(const void* data, std::size_t bytes_size, std::size_t offset) const;
+        // Copies data from the buffer. Throws an error if the buffer is not mapped.
         void download(void* data, std::size_t bytes_size, std::size_t offset) const;
+        // Pointer to the persistently mapped memory of the buffer at the given offset, to write data in place instead of uploading it. Written ranges must then be flushed.
+        // Returns nullptr if the buffer's memory is not host visible.
+        void* mapped(std::size_t offset) const;
+        // Makes the writes to a range of the mapped memory visible to the GPU (only needed if the memory is not host coherent)
+        void flush(std::size_t bytes_size, std::size_t offset) const;
     protected:
         VkBuffer _vk_buffer = VK_NULL_HANDLE;
-        VkDeviceMemory _vk_memory = VK_NULL_HANDLE;
+        MemoryAllocation _allocation; // range of memory allocated by the GPU's memory allocator
         void* _data = nullptr;
         std::size_t _bytes_size = 0;
         VkMemoryPropertyFlags _memory_properties = 0;
+        Memory _memory = HOST_VISIBLE;
+        bool _released = false; // set by the owner once the GPU no longer reads the buffer, so that its destruction does not wait for the device to be idle
     protected:
         void _allocate_buffer(VkBufferUsageFlags usage);
         void _allocate_memory(VkMemoryPropertyFlags memory_properties);
+        // Rounds a range of non coherent memory to be flushed or invalidated to multiples of 'nonCoherentAtomSize'
+        void _align_to_atoms(VkMappedMemoryRange& range) const;
     };
 }
\ No newline at end of file
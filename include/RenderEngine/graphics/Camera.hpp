@@ -2,6 +2,7 @@
 #include <RenderEngine/geometry/Referential.hpp>
 #include <RenderEngine/geometry/Matrix.hpp>
 #include <RenderEngine/graphics/shaders/Types.hpp>
+#include <tuple>
 
 
 namespace RenderEngine
@@ -24,6 +25,10 @@ namespace RenderEngine
         float max_distance; // distance in spatial unit beyond which things are not rendered.
         float sensitivity; // light sensitivity of the camera.
         ProjectionType projection_type;
+    public:
+        // Returns the ray going through the center of the pixel (x, y) of a canvas of size (width, height), as (origin, direction, max_distance) in absolute coordinates.
+        // Points of the ray are origin + t*direction with 0 <= t <= max_distance. The origin lies on the near plane of the camera.
+        std::tuple<Vector, Vector, double> ray(double x, double y, uint32_t width, uint32_t height) const;
     };
 
     // Builds a perspective camera, which draws everything in the square pyramid between the camera and max_distance plane, projected onto a point positioned at a 'focal_length' distance behind the camera.
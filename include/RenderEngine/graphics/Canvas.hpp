@@ -6,6 +6,8 @@
 #include <RenderEngine/geometry/Quaternion.hpp>
 #include <RenderEngine/geometry/Vector.hpp>
 #include <RenderEngine/geometry/Matrix.hpp>
+#include <RenderEngine/geometry/Referential.hpp>
+#include <RenderEngine/geometry/Transform.hpp>
 #include <RenderEngine/graphics/Camera.hpp>
 #include <RenderEngine/graphics/Light.hpp>
 #include <RenderEngine/graphics/Color.hpp>
@@ -15,6 +17,8 @@
 namespace RenderEngine
 {
     class Mesh;
+    class Buffer;
+    struct DynamicRegion;
 
     class Canvas
     // A canvas is an RGBA image that can be drawn onto.
@@ -31,6 +35,9 @@ namespace RenderEngine
             Canvas(const GPU* gpu, const VkImage& vk_image, uint32_t width, uint32_t height,
                    AntiAliasing sample_count = AntiAliasing::X1);
             ~Canvas();
+        public:
+            static constexpr float LEVEL_OF_DETAIL_PIXEL_ERROR = 1.f; // largest error, in pixels, of the level of detail of a mesh drawn instead of the full mesh
+            static constexpr std::size_t INSTANCES_CAPACITY = 1024; // number of instance transforms the instance buffer initially holds
         public:
             const GPU* gpu;
             const std::map<const std::string, Image*> images;
@@ -40,6 +47,7 @@ namespace RenderEngine
             bool _recording = false; // boolean that is set to true when commands are beeing recorded on cpu
             bool _rendering = false; // boolean that is set to true when commands have been sent to GPU for rendering, and wait_completion has not been called yet.
             const Shader* _current_shader = nullptr; // Shader currently in use
+            VkPipeline _current_pipeline = VK_NULL_HANDLE; // pipeline currently bound (the current shader's pipeline or one of its variants)
             std::set<const Canvas*> _dependencies;  // Canvas dependencies that must be rendered before this Canvas
             std::set<VkSemaphore> _wait_semaphores;  // Other VkSemaphore that must be waited befoire starting to render (SwapChain image acquisition, ...)
             VkSemaphore _vk_rendered_semaphore = VK_NULL_HANDLE;  // Semaphore to order rendering Canvas dependencies on GPU
@@ -47,9 +55,17 @@ namespace RenderEngine
             std::map<const Shader*, VkFramebuffer> _frame_buffers;
             VkCommandBuffer _vk_command_buffer = VK_NULL_HANDLE;
             VkImageLayout _final_layout = VK_IMAGE_LAYOUT_UNDEFINED;  // The final layout the color image is converted to at the end of the command buffer
+            std::shared_ptr<Buffer> _instances;  // transforms of the instances drawn in the current frame, after an identity transform for the single draws
+            std::size_t _instances_bytes = 0;  // bytes of '_instances' used in the current frame
+            std::vector<std::shared_ptr<Buffer>> _retired_instances;  // instance buffers outgrown in the current frame, kept until the GPU is done reading them
+            std::vector<std::pair<std::shared_ptr<std::vector<DynamicRegion>>, std::size_t>> _dynamic_regions;  // regions of dynamic meshes drawn in the current frame, that can not be uploaded until the GPU is done reading them
         public:
             void clear();  // Clears the canvas
             void draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const std::tuple<Vector, Quaternion, double>& mesh_coordinates_in_camera, bool cull_back_faces=true);  // Record objects to draw in the command buffer. Rendering only starts once the 'render' method is called.
+            void draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const Transform& mesh_to_camera, bool cull_back_faces=true);  // Same as above, with the mesh coordinates given as a precomposed transform (see Referential::transform_in)
+            void draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const ReferentialsCoordinates& coordinates_in_camera, std::size_t index, bool cull_back_faces=true);  // Same as above, with the mesh coordinates read at 'index' from the result of Referential::bulk_coordinates_in
+            void draw_instances(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const Transform* instances_to_camera, std::size_t count, bool cull_back_faces=true);  // Draws the mesh once per transform with a single instanced draw. The instances outside of the view are skipped, and all use the level of detail of the closest one.
+            void draw_instances(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const ReferentialsCoordinates& coordinates_in_camera, bool cull_back_faces=true);  // Same as above, with an instance at each of the coordinates returned by Referential::bulk_coordinates_in
             void light(const Camera& camera, const Light& light, const std::tuple<Vector, Quaternion, double>& light_coordinates_in_camera,
                        Canvas* shadow_map = nullptr);  // light the scene
             void render();  // Send the command buffers to GPU. Does nothing if the canvas is not in recording state, or already in rendering state. This command is asynchrone, and completion is garanteed only once 'wait_completion' is called.
@@ -62,11 +78,18 @@ namespace RenderEngine
             void _allocate_fence(VkFence& fence);
             void _allocate_semaphore(VkSemaphore& semaphore);
             void _record_commands();
+            void _draw_mesh(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const DrawParameters& params, bool cull_back_faces,
+                            float pixels_per_unit, std::size_t instances_offset=0, uint32_t instances_count=1);  // draws 'instances_count' instances whose transforms are read at 'instances_offset' in the instance buffer, then composed with the params' transform
+            void _draw_instances(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const std::vector<mat4>& instances_to_camera, bool cull_back_faces);
+            void _release_regions();  // removes the canvas from the readers of the regions of dynamic meshes it drew
+            void _release_retired_instances();  // frees the instance buffers outgrown in the last frame, once the GPU is done reading them
+            std::size_t _reserve_instances(std::size_t count);  // returns the offset in the instance buffer of room for 'count' transforms, replacing the buffer by a larger one if it is full
+            float _pixels_per_unit(const Mesh& mesh, const DrawParameters& params) const; // size in pixels of a unit of the mesh's coordinates, at the point of its bounding sphere closest to the camera
             void _bind_shader(const Shader* shader, const std::map<const std::string, Image*>& images_pool);
             void _bind_descriptor_set(const Shader* shader,
                 unsigned int descriptor_set_index,
                 const std::map<const std::string, Image*>& images_pool,
-                const std::map<const std::string, Buffer*>& buffers_pool);
+                const std::map<const std::string, VkDescriptorBufferInfo>& buffers_pool);
             void _command_barrier(const std::map<std::string, VkImageLayout>& new_image_layouts, const std::map<const std::string, Image*>& images_pool); // set up a command barrier that ensures next commands will be executed after previous commands are finished, and transition the layout of the given images
     };
 }
\ No newline at end of file
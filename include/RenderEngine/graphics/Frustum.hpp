@@ -0,0 +1,36 @@
+#pragma once
+#include <RenderEngine/graphics/Camera.hpp>
+#include <RenderEngine/graphics/model/Model.hpp>
+#include <RenderEngine/geometry/BoundingBox.hpp>
+#include <RenderEngine/geometry/BoundingSphere.hpp>
+#include <array>
+#include <vector>
+
+namespace RenderEngine
+{
+    // The volume inside of which a camera renders things, expressed in the camera's coordinates.
+    // It is the intersection of half spaces (planes) for perspective and orthographic cameras, and a sphere of radius 'max_distance' for spherical cameras.
+    // The tests are conservative: an object is reported as not visible only if it is entirely outside of the volume.
+    class Frustum
+    {
+    public:
+        Frustum() = delete;
+        // The 'aspect_ratio' is the height/width ratio of the canvas the camera draws into
+        Frustum(const Camera& camera, double aspect_ratio);
+        ~Frustum();
+    public:
+        // Returns true if the sphere, in camera coordinates, intersects the frustum
+        bool intersects(const BoundingSphere& sphere) const;
+        // Returns true if the box, in camera coordinates, intersects the frustum
+        bool intersects(const BoundingBox& box) const;
+        // Returns the indexes of the spheres (given in camera coordinates as arrays of centers and radiuses) that intersect the frustum, with a vectorized kernel
+        std::vector<std::size_t> bulk_intersects(const float* x, const float* y, const float* z, const float* radius, std::size_t count) const;
+        // Returns the models whose mesh's bounding volume is visible by the camera, in the same order. Models without mesh are never visible.
+        // Bounding spheres are tested in bulk, then if 'test_boxes' is true the bounding boxes of the remaining models are tested as well.
+        static std::vector<const Model*> bulk_visible(const Camera& camera, double aspect_ratio, const std::vector<const Model*>& models, bool test_boxes=false);
+    protected:
+        std::vector<std::array<float, 4>> _planes; // (nx, ny, nz, d) of unit normals pointing inside: a point p is inside if dot(n, p) + d >= 0
+        bool _spherical = false; // if true, the volume is the sphere of radius '_radius' centered on the camera
+        float _radius = 0.f;
+    };
+}
@@ -5,7 +5,10 @@
 #include <string>
 #include <memory>
 #include <optional>
+#include <mutex>
 #include <RenderEngine/utilities/External.hpp>
+#include <RenderEngine/graphics/StagingRing.hpp>
+#include <RenderEngine/graphics/MemoryAllocator.hpp>
 
 namespace RenderEngine
 {
@@ -23,6 +26,8 @@ namespace RenderEngine
     friend class Internal;
     friend class Canvas;
     friend class Buffer;
+    friend class StagingRing;
+    friend class MemoryAllocator;
     public:
         enum Type {DISCRETE_GPU=VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
                    INTEGRATED_GPU=VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU,
@@ -55,6 +60,10 @@ namespace RenderEngine
         std::pair<VkImageTiling, VkFormat> depth_format() const;
         // Return whether dynamicaly changing face culling is supported
         bool dynamic_culling_supported() const;
+        // Returns the alignment in bytes required for the offset of a storage buffer range bound to a shader
+        std::size_t storage_buffer_alignment() const;
+        // Returns statistics of the device memory allocated for buffers and images
+        MemoryStatistics memory_statistics() const;
     protected:
         VkPhysicalDevice _physical_device = VK_NULL_HANDLE;
         VkPhysicalDeviceProperties _device_properties{};
@@ -63,10 +72,14 @@ namespace RenderEngine
         std::optional<std::tuple<uint32_t, VkQueue, VkCommandPool>> _graphics_queue; // (queue family, VkQueue, VkCOmmandPool)
         std::optional<std::tuple<uint32_t, VkQueue, VkCommandPool>> _compute_queue; // (queue family, VkQueue, VkCOmmandPool)
         std::optional<std::tuple<uint32_t, VkQueue, VkCommandPool>> _present_queue; // (queue family, VkQueue, VkCOmmandPool)
+        std::optional<std::tuple<uint32_t, VkQueue, VkCommandPool>> _transfer_queue; // (queue family, VkQueue, VkCOmmandPool), the graphics queue if there is no other queue supporting transfers
+        mutable std::mutex _queues_mutex; // locked by every submission to the queues (and device wait), as the queues can be shared between purposes and threads
         std::set<std::string> _enabled_extensions;
         VkDevice _logical_device = VK_NULL_HANDLE;
         std::map<std::string, Shader*> _shaders;
         std::vector<std::shared_ptr<Image>> _default_textures;
+        std::unique_ptr<MemoryAllocator> _memory_allocator; // memory of buffers and images
+        std::unique_ptr<StagingRing> _staging_ring; // uploads to device local buffers
     protected:
         // returns the index of the queue family selected for 'queue_type' purpose. Modifies the 'selected_families_count'.
         std::optional<uint32_t> _select_queue_family(std::vector<VkQueueFamilyProperties>& queue_families,  // all available queue families
@@ -29,14 +29,13 @@ namespace RenderEngine
               const std::optional<uint32_t>& resized_height=std::nullopt);
         // create an image from dimensions and format
         Image(const GPU* gpu, ImageFormat format, uint32_t width, uint32_t height, bool mipmaped=true, AntiAliasing sample_count=AntiAliasing::X1);
-        // Create an image view from an existing VkImage, if vk_device_memory==nullptr, the vk_image won't be destroyed by Image destructor (it is understood to be owned by the swapchain)
-        Image(const GPU* gpu, const VkImage& vk_image, const std::shared_ptr<VkDeviceMemory>& vk_device_memory,
-              ImageFormat format, uint32_t width, uint32_t height, bool mipmaped);
+        // Create an image view from an existing VkImage. The vk_image won't be destroyed by Image destructor (it is understood to be owned by the swapchain)
+        Image(const GPU* gpu, const VkImage& vk_image, ImageFormat format, uint32_t width, uint32_t height, bool mipmaped);
         ~Image();
     protected:
         const GPU* _gpu = nullptr;
         VkImage _vk_image = VK_NULL_HANDLE;
-        std::shared_ptr<VkDeviceMemory> _vk_device_memory = nullptr;  // this is not used, only keeping a reference to avoid premature deallocation
+        MemoryAllocation _allocation;  // memory of the image, allocated by the GPU's memory allocator, or a null allocation if the image is owned by the swapchain
         VkImageView _vk_image_view = VK_NULL_HANDLE;
         VkSampler _vk_sampler = VK_NULL_HANDLE;
         uint32_t _width;
@@ -48,10 +47,8 @@ namespace RenderEngine
     protected:
         // Create a 'vk_image' image from the given properties
         static VkImage _create_vk_image(const GPU* gpu, uint32_t width, uint32_t height, ImageFormat format, uint32_t mip_levels, AntiAliasing sample_count);
-        // Allocate an array of memory in which 'n_images' images similar to 'vk_image' can be stored. Returns the vk_device_memory and offset in memory between two images.
-        static std::tuple<std::shared_ptr<VkDeviceMemory>, std::size_t> _allocate_vk_device_memory(const GPU* gpu, const VkImage& vk_image, uint32_t n_images);
-        // binds the given 'vk_image' to the given offset of a 'vk_device_memory' memory array.
-        static void _bind_image_to_memory(const GPU* gpu, const VkImage& vk_image, const std::shared_ptr<VkDeviceMemory>& vk_device_memory, std::size_t offset);
+        // Allocate device local memory for the 'vk_image' from the GPU's memory allocator, and bind the image to it
+        static MemoryAllocation _allocate_memory(const GPU* gpu, const VkImage& vk_image);
         // return the mip levels count for an image of given width/height
         static uint32_t _mip_levels_count(uint32_t width, uint32_t height);
         // returns the source layout attributes for a given layout transition
@@ -0,0 +1,82 @@
+#pragma once
+#include <RenderEngine/utilities/External.hpp>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    class GPU;
+
+    // A range of GPU memory, allocated by a MemoryAllocator. Resources are bound to 'memory' at 'offset'.
+    struct MemoryAllocation
+    {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        void* mapped = nullptr; // persistently mapped pointer to the range, if the memory is host visible
+        VkMemoryPropertyFlags properties = 0; // properties of the memory type
+    protected:
+        friend class MemoryAllocator;
+        uint32_t _pool = 0; // index of the pool of blocks, unused for dedicated allocations
+        void* _block = nullptr; // block the range belongs to, or nullptr for dedicated allocations
+        uint32_t _range = 0; // index of the range in the block
+    };
+
+    // Statistics of the memory allocated by a MemoryAllocator
+    struct MemoryStatistics
+    {
+        std::size_t blocks_count = 0; // number of memory blocks shared by several allocations
+        std::size_t dedicated_count = 0; // number of allocations in their own memory
+        std::size_t allocations_count = 0; // number of live allocations, dedicated or not
+        std::size_t reserved_bytes = 0; // size of all the memory allocated from the driver
+        std::size_t used_bytes = 0; // size of all the live allocations
+        std::size_t largest_free_range = 0; // size of the largest free range in a block
+    };
+
+    // Allocates the memory of Buffers and Images as ranges of large blocks, so that the number of driver allocations stays low.
+    // There is one pool of blocks per memory type, and per kind of resource (linear buffers, or optimally tiled images) when 'bufferImageGranularity' requires them to be separated.
+    // Ranges of a block are managed with a two level segregated fit allocator (TLSF), in constant time. Resources larger than half a block get a dedicated allocation.
+    // Host visible blocks are persistently mapped. All the methods can be called from several threads.
+    class MemoryAllocator
+    {
+    public: // This class is non copyable
+        MemoryAllocator() = delete;
+        MemoryAllocator(const MemoryAllocator& other) = delete;
+        MemoryAllocator& operator=(const MemoryAllocator& other) = delete;
+    public:
+        // The block size is reduced for small heaps
+        MemoryAllocator(const GPU* gpu, std::size_t block_size=DEFAULT_BLOCK_SIZE);
+        ~MemoryAllocator();
+    public:
+        static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024 * 1024;
+    public:
+        // Allocates memory for a resource with the given requirements, in the first memory type that has all the required 'properties'. 'linear' is true for buffers and linearly tiled images.
+        // Throws an error if there is no suitable memory type, or if the memory is exhausted.
+        MemoryAllocation allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool linear);
+        // Frees an allocation. Blocks left empty are freed, except one per pool.
+        void free(const MemoryAllocation& allocation);
+        // Returns statistics over all the memory types
+        MemoryStatistics statistics() const;
+    protected:
+        struct Block;
+    protected:
+        // Returns the index of the first memory type allowed by 'type_bits' with all the given properties
+        uint32_t _memory_type(uint32_t type_bits, VkMemoryPropertyFlags properties) const;
+        // Allocates memory from the driver, mapping it if it is host visible. Returns false if the memory is exhausted.
+        bool _allocate_device_memory(uint32_t memory_type, std::size_t size, VkDeviceMemory& memory, void*& mapped) const;
+        // Frees memory allocated by '_allocate_device_memory'
+        void _free_device_memory(VkDeviceMemory memory, void* mapped) const;
+    protected:
+        const GPU* _gpu;
+        VkPhysicalDeviceMemoryProperties _memory_properties{};
+        std::size_t _granularity = 1; // bufferImageGranularity
+        std::size_t _atom_size = 1; // nonCoherentAtomSize
+        std::vector<std::size_t> _block_sizes; // size of the blocks of each memory type
+        std::vector<std::vector<std::unique_ptr<Block>>> _pools; // blocks of each pool, two pools per memory type (linear, and optimal tiling resources)
+        std::size_t _dedicated_count = 0;
+        std::size_t _dedicated_bytes = 0;
+        mutable std::mutex _mutex;
+    };
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <RenderEngine/utilities/External.hpp>
+#include <memory>
+#include <optional>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    class GPU;
+    class Buffer;
+
+    // A persistently mapped host buffer, used as a ring to upload data to device local buffers. Data is written in the ring, and copied to its destination
+    // by commands recorded in a batch, submitted to the transfer queue of the GPU. Each submitted batch signals the next value of a timeline semaphore,
+    // and its space in the ring is reused once this value is reached. The recorded copies are submitted when the ring is full, or by 'submit' and 'wait'.
+    // All the methods can be called from several threads.
+    class StagingRing
+    {
+    friend class Canvas;
+    public: // This class is non copyable
+        StagingRing() = delete;
+        StagingRing(const StagingRing& other) = delete;
+        StagingRing& operator=(const StagingRing& other) = delete;
+    public:
+        StagingRing(const GPU* gpu, std::size_t bytes_size);
+        ~StagingRing();
+    public:
+        static constexpr std::size_t DEFAULT_BYTES_SIZE = 32 * 1024 * 1024;
+    public:
+        // Copies the data to the range of the destination buffer starting at 'offset'. Data larger than the ring is copied in several parts.
+        void upload(const Buffer& destination, const void* data, std::size_t bytes_size, std::size_t offset);
+        // Submits the recorded copies to the transfer queue, without waiting for them to complete.
+        // Returns the value of the timeline semaphore signaled once all the submitted copies are completed.
+        uint64_t submit();
+        // Submits the recorded copies, and waits for all the submitted copies to complete. Returns immediately if there is none.
+        void wait();
+    protected:
+        // A command buffer of copies, with the value of the timeline semaphore signaled when they are completed
+        struct Batch
+        {
+            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+            uint64_t value = 0; // value of the timeline semaphore signaled by the batch
+            uint64_t end = 0; // position in the ring after the last byte copied by the batch
+        };
+    protected:
+        // Reserves 'bytes_size' contiguous bytes of the ring (at most its size), releasing the space of completed batches, or waiting for them, if needed.
+        // Returns the offset of the reserved range in the ring buffer.
+        std::size_t _reserve(std::size_t bytes_size);
+        // Releases the space of the submitted batches that are completed. If 'wait' is true, waits for the oldest submitted batch to complete first.
+        void _release(bool wait);
+        // Returns the batch recording copies, beginning a new one if there is none
+        Batch& _recording_batch();
+        // Submits the batch recording copies, if any
+        void _submit();
+    protected:
+        const GPU* _gpu;
+        std::unique_ptr<Buffer> _buffer;
+        VkCommandPool _vk_command_pool = VK_NULL_HANDLE; // pool of the batches, not shared with the other users of the transfer queue
+        VkSemaphore _vk_semaphore = VK_NULL_HANDLE; // timeline semaphore signaled by the submitted batches
+        uint64_t _submitted_value = 0; // value of the timeline semaphore signaled by the last submitted batch
+        std::optional<Batch> _recording; // batch recording copies, not yet submitted
+        std::deque<Batch> _submitted; // submitted batches, from the oldest to the newest
+        std::vector<Batch> _free_batches; // completed batches, reused by next recordings
+        uint64_t _head = 0; // number of bytes reserved since the creation of the ring
+        uint64_t _tail = 0; // number of bytes released since the creation of the ring
+        std::mutex _mutex;
+    };
+}
@@ -1,4 +1,7 @@
 #include "GPU.hpp"
 #include "SwapChain.hpp"
 #include "Canvas.hpp"
-#include "model/Model.hpp"
\ No newline at end of file
+#include "Camera.hpp"
+#include "Frustum.hpp"
+#include "model/Model.hpp"
+#include "model/BoundingVolumeHierarchy.hpp"
\ No newline at end of file
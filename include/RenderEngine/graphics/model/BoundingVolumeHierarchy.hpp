@@ -0,0 +1,84 @@
+#pragma once
+#include <RenderEngine/graphics/model/Model.hpp>
+#include <RenderEngine/graphics/Camera.hpp>
+#include <RenderEngine/geometry/BoundingBox.hpp>
+#include <RenderEngine/geometry/BoundingSphere.hpp>
+#include <unordered_map>
+#include <utility>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // The closest intersection of a ray with the meshes of the models of a BoundingVolumeHierarchy
+    struct RayHit
+    {
+        const Model* model = nullptr; // model hit, or nullptr if nothing was hit
+        std::size_t triangle = 0; // index of the face hit in the mesh
+        double distance = std::numeric_limits<double>::infinity(); // distance along the ray, in units of the ray direction's norm
+        double u = 0.; // barycentric coordinate of the face's second point
+        double v = 0.; // barycentric coordinate of the face's third point (the first one has 1-u-v)
+        UV uv; // interpolated texture coordinates at the hit point
+        Vector position; // hit point in absolute coordinates
+    };
+
+    // A bounding volume hierarchy over the absolute bounding boxes of Models, to answer spatial queries in O(log(n)).
+    // The tree is built with the surface area heuristic and stored as a flat array of nodes, the two childrens of a node being contiguous.
+    // The models must outlive the hierarchy. When models move, 'refit' updates the boxes without changing the tree, 'build' rebuilds it.
+    class BoundingVolumeHierarchy
+    {
+    public:
+        // A node of the tree (32 bytes). Leafs have a non zero 'count' of models starting at index 'first'. Other nodes have their childrens at indexes 'first' and 'first+1'.
+        struct Node
+        {
+            float lower[3];
+            std::uint32_t first;
+            float upper[3];
+            std::uint32_t count;
+        };
+    public:
+        BoundingVolumeHierarchy();
+        BoundingVolumeHierarchy(const std::vector<const Model*>& models);
+        ~BoundingVolumeHierarchy();
+    public:
+        // Rebuilds the tree over the given models. Subtrees are built in parallel when there are enough models. Models without mesh are ignored.
+        void build(const std::vector<const Model*>& models);
+        // Recomputes the boxes of all the models and of all the nodes, without changing the tree
+        void refit();
+        // Recomputes the boxes of the given models, and of the nodes containing them, without changing the tree
+        void refit(const std::vector<const Model*>& moved);
+        // Returns the models whose bounding box intersects the given box, in absolute coordinates
+        std::vector<const Model*> query_box(const BoundingBox& box) const;
+        // Returns the models whose bounding box intersects the given sphere, in absolute coordinates
+        std::vector<const Model*> query_sphere(const BoundingSphere& sphere) const;
+        // Returns the models whose bounding box intersects the frustum of the camera. The 'aspect_ratio' is the height/width ratio of the canvas.
+        std::vector<const Model*> query_frustum(const Camera& camera, double aspect_ratio) const;
+        // Returns the models whose bounding box is hit by the ray, in absolute coordinates, with the distance at which the ray enters the box, sorted from nearest to furthest.
+        // The distance is in units of 'direction' norm.
+        std::vector<std::pair<const Model*, double>> query_ray(const Vector& origin, const Vector& direction, double max_distance=std::numeric_limits<double>::infinity()) const;
+        // Returns true if the ray, in absolute coordinates, hits the mesh of a model closer than 'max_distance' (in units of the direction's norm). The closest hit is then written in 'hit'.
+        bool ray_cast(const Vector& origin, const Vector& direction, RayHit& hit, double max_distance=std::numeric_limits<double>::infinity()) const;
+        // Returns true if a model is visible at the pixel (x, y) of a canvas of size (width, height) drawn with the given camera. The closest hit is then written in 'hit'.
+        bool pick(const Camera& camera, double x, double y, uint32_t width, uint32_t height, RayHit& hit) const;
+        // Returns the nodes of the tree, the root being the first one
+        const std::vector<Node>& nodes() const;
+        // Returns the models in the order of the leafs
+        const std::vector<const Model*>& models() const;
+    protected:
+        // Builds the subtree of the models in [begin, end) with its root at 'nodes[root]'. If 'parallel_depth' is not null, the second child is built in another thread.
+        void _build_subtree(std::vector<Node>& nodes, std::size_t root, std::uint32_t begin, std::uint32_t end, unsigned int parallel_depth);
+        // Sets the box of the node to the union of its childrens' boxes (or of its models' boxes for leafs). Returns true if the box changed.
+        bool _fit_node(std::size_t node);
+        // Returns the models whose box satisfies the predicate, visiting only nodes whose box satisfies it
+        template<typename Predicate>
+        std::vector<const Model*> _query(const Predicate& intersects) const;
+    protected:
+        std::vector<Node> _nodes;
+        std::vector<const Model*> _models; // models in the order of the leafs
+        std::vector<BoundingBox> _boxes; // absolute bounding box of each model, in the order of '_models'
+        std::vector<std::uint32_t> _parents; // parent of each node (the root is its own parent)
+        std::vector<std::uint32_t> _leafs; // leaf containing each model, in the order of '_models'
+        std::unordered_map<const Model*, std::uint32_t> _indexes; // index of each model in '_models'
+    };
+}
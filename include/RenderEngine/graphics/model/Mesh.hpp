@@ -3,28 +3,184 @@
 #include <RenderEngine/graphics/GPU.hpp>
 #include <RenderEngine/graphics/model/Face.hpp>
 #include <RenderEngine/graphics/Buffer.hpp>
+#include <RenderEngine/geometry/BoundingBox.hpp>
+#include <RenderEngine/geometry/BoundingSphere.hpp>
+#include <RenderEngine/graphics/model/TriangleHierarchy.hpp>
+#include <RenderEngine/graphics/model/Simplifier.hpp>
+#include <RenderEngine/graphics/model/Meshlets.hpp>
 #include <memory>
+#include <mutex>
 
 
 namespace RenderEngine
 {
+    class Canvas;
+
+    // A copy of the range of a dynamic mesh in its buffer
+    struct DynamicRegion
+    {
+        std::vector<Canvas*> readers; // canvases whose recorded or rendering commands read the region
+        std::vector<std::pair<std::size_t, std::size_t>> stale; // (offset, size) ranges of the mesh's range modified since the region was written
+    };
+
+    // A mesh is a range of a vertex buffer. The color and material of the vertices are read from the mesh's palette, a small storage buffer indexed by 'Vertex::palette',
+    // so that they are not duplicated in each vertex and can be changed without uploading the vertices again.
+    // Dynamic meshes hold several copies (regions) of their range, so that they can be uploaded at each frame while canvases still render the previous ones:
+    // an upload writes a region that no canvas reads, and makes it the one drawn. A region is read until the canvases that recorded draws of it complete their rendering.
+    // The palette of a dynamic mesh is not copied in the regions: it is set at construction and can not be replaced.
     class Mesh
     {
         friend class Canvas;
+        friend class MeshBuilder;
+        friend class MeshCache;
+    public:
+        // Layout of the vertices in the buffer. COMPACT vertices are quantized (see CompactVertex), with positions relative to the mesh's bounding box.
+        enum VertexFormat {STANDARD, COMPACT};
+        // A simplified version of the mesh, drawn with the mesh's vertices and its own indices, stored after the mesh's indices in its range of the buffer
+        struct LevelOfDetail
+        {
+            uint32_t first_index; // position of the level's first index, relative to the mesh's first index
+            uint32_t indices_count;
+            float error; // estimation of the largest distance to the surface of the full mesh, in the mesh's coordinates
+        };
     public:
         Mesh() = delete;
-        Mesh(const GPU* gpu, const std::vector<Face>& faces);
-        Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, const std::vector<Face>& faces);
+        // Creates a mesh in its own device local buffer. If 'indexed' is true, identical vertices are welded and the mesh is drawn with an index buffer.
+        // If 'levels_of_detail' is true, room is reserved after the indices for simplified versions of the mesh, generated at each upload (see Simplifier).
+        // If 'meshlets' is true, the triangles are reordered at each upload into clusters culled separately when drawn, whose descriptors are stored last in the mesh's range (see Meshlets).
+        Mesh(const GPU* gpu, const std::vector<Face>& faces, bool indexed=false, VertexFormat format=STANDARD, bool levels_of_detail=false, bool meshlets=false);
+        // Creates a mesh from vertices, their palette, and optionally indices (three per triangle), in its own buffers (the vertex buffer being device local)
+        Mesh(const GPU* gpu, const std::vector<Vertex>& vertices, const std::vector<PaletteEntry>& palette, const std::vector<uint32_t>& indices={}, VertexFormat format=STANDARD,
+             bool levels_of_detail=false, bool meshlets=false);
+        // Reserves the range of the buffer starting at 'offset' for the faces, uploaded with 'upload'. The palette of the faces is uploaded in its own buffer.
+        Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, const std::vector<Face>& faces, VertexFormat format=STANDARD, bool levels_of_detail=false, bool meshlets=false);
+        // Creates a mesh from vertices and indices (three per triangle, or none) in the range of the buffer starting at 'offset',
+        // and from their palette in the range of 'palette_buffer' starting at 'palette_offset' (a multiple of GPU::storage_buffer_alignment)
+        Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+             const std::shared_ptr<Buffer>& palette_buffer, std::size_t palette_offset, const std::vector<PaletteEntry>& palette, VertexFormat format=STANDARD,
+             bool levels_of_detail=false, bool meshlets=false);
+        // Reserves the range of the buffer starting at 'offset' for 'vertices_count' vertices and 'indices_count' indices, and the range of 'palette_buffer' starting at 'palette_offset'
+        // for 'palette_capacity' entries. The palette is then uploaded with 'upload_palette', and the vertices written in place with a MeshBuilder.
+        Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, std::size_t vertices_count, std::size_t indices_count,
+             const std::shared_ptr<Buffer>& palette_buffer, std::size_t palette_offset, std::size_t palette_capacity, VertexFormat format=STANDARD,
+             bool levels_of_detail=false, bool meshlets=false);
+        // Creates an empty dynamic mesh in its own host visible buffer, with 'regions' (at least two) regions of room for 'vertices_count' vertices and 'indices_count' indices.
+        // With one region more than the number of frames rendered at the same time, uploads never wait for the GPU.
+        Mesh(const GPU* gpu, std::size_t vertices_count, std::size_t indices_count, const std::vector<PaletteEntry>& palette, std::size_t regions=DYNAMIC_REGIONS,
+             VertexFormat format=STANDARD, bool levels_of_detail=false, bool meshlets=false);
         ~Mesh();
     public:
+        static constexpr std::size_t DYNAMIC_REGIONS = 3;
+    public:
+        // Uploads the faces and their palette, welding the identical vertices if the mesh is indexed. Throws an error if they do not fit in the mesh's ranges of the buffers.
+        // The faces of a dynamic mesh reference the entries of its palette, and an error is thrown if a color or material is missing from it.
         void upload(const std::vector<Face>& faces);
+        // Uploads the vertices, and the indices if any, the indices being stored right after the vertices. Throws an error if they do not fit in the mesh's range of the buffer,
+        // or if a vertex references an entry missing from the palette.
+        void upload(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices={});
+        // Replaces the 'vertices.size()' vertices starting at 'first_vertex', the other vertices and the indices being unchanged. Only the modified ranges are written,
+        // in the region to draw and, when they are reused, in the regions that missed them. The bounding volumes are grown to contain the new vertices
+        // (they are recomputed exactly at the next full upload). Throws an error if the mesh is not dynamic, or is COMPACT,
+        // or has levels of detail or meshlets (that would need to be generated again), or if the vertices are out of the mesh's range.
+        void upload_range(std::size_t first_vertex, const std::vector<Vertex>& vertices);
+        // Replaces the palette without uploading the vertices. Throws an error if it does not fit in the mesh's range of the palette buffer, or if an entry referenced by a vertex is missing,
+        // or if the mesh is dynamic (the palette may still be read by the GPU).
+        void upload_palette(const std::vector<PaletteEntry>& palette);
+        // Colors and materials referenced by the vertices
+        const std::vector<PaletteEntry>& palette() const;
+        // Size of the mesh's range of the buffer
         std::size_t bytes_size() const;
+        // Position of the mesh's range in the buffer. For dynamic meshes, the region written by the last upload, to bind when drawing.
+        std::size_t offset() const;
+        // Returns true if the mesh was created dynamic
+        bool dynamic() const;
+        // Returns true if the mesh is drawn with an index buffer
+        bool indexed() const;
+        // Layout of the vertices in the buffer
+        VertexFormat vertex_format() const;
+        // Size in bytes of a vertex in the buffer
+        std::size_t vertex_size() const;
+        // Number of vertices uploaded
+        uint32_t vertices_count() const;
+        // Number of indices uploaded (0 if the mesh is not indexed)
+        uint32_t indices_count() const;
+        // Simplified versions of the mesh, from the finest to the coarsest. Empty if the mesh was created without levels of detail, or is too small to be simplified.
+        const std::vector<LevelOfDetail>& levels_of_detail() const;
+        // Returns the coarsest level of detail whose error is below 'max_error' (in the mesh's coordinates), or nullptr if the full mesh must be drawn
+        const LevelOfDetail* level_of_detail(float max_error) const;
+        // Clusters of the mesh's triangles, with their bounds in the mesh's coordinates. Empty if the mesh was created without meshlets.
+        const std::vector<Meshlet>& meshlets() const;
+        // Axis aligned bounding box of the mesh's vertices, in the mesh's coordinates. Computed at upload.
+        const BoundingBox& bounding_box() const;
+        // Bounding sphere of the mesh's vertices, in the mesh's coordinates. Computed at upload.
+        const BoundingSphere& bounding_sphere() const;
+        // Returns true if the ray, in the mesh's coordinates, hits a face closer than 'max_distance' (in units of the direction's norm). The closest hit is then written in 'hit'.
+        // The triangle hierarchy is built on first call.
+        bool ray_cast(const Vectorf& origin, const Vectorf& direction, float max_distance, TriangleHit& hit) const;
+        // Returns the UV coordinates of the point hit by a ray
+        UV hit_UV(const TriangleHit& hit) const;
     public:
-        static std::vector<std::shared_ptr<Mesh>> bulk_allocate_meshes(const GPU* gpu, const std::vector<std::vector<Face>>& faces);
-        static std::map<std::string, std::shared_ptr<Mesh>> bulk_allocate_meshes(const GPU* gpu, const std::map<std::string, std::vector<Face>>& faces);
+        // Converts faces to vertices, three per face, and gathers their distinct colors and materials in a palette
+        static std::vector<Vertex> faces_vertices(const std::vector<Face>& faces, std::vector<PaletteEntry>& palette);
+        // Gathers the distinct colors and materials of the faces in a palette, and returns the index in the palette of each face
+        static std::vector<uint32_t> faces_palette(const std::vector<Face>& faces, std::vector<PaletteEntry>& palette);
+        // Writes the vertices of the faces, three per face, in 'vertices' (for example the memory of a MeshBuilder), given the palette index of each face
+        static void faces_vertices(const std::vector<Face>& faces, const std::vector<uint32_t>& palette_indices, Vertex* vertices);
+        // Merges the vertices that are bitwise identical, and returns the indices of the unique vertices for each input vertex
+        static void weld_vertices(const std::vector<Vertex>& vertices, std::vector<Vertex>& unique_vertices, std::vector<uint32_t>& indices);
+        // Quantizes the vertices. Positions are stored as (position - position_offset) / position_scale, which must lie in [0, 1].
+        static std::vector<CompactVertex> compact_vertices(const std::vector<Vertex>& vertices, const vec3& position_offset, float position_scale);
+        static void compact_vertices(const Vertex* vertices, std::size_t count, const vec3& position_offset, float position_scale, CompactVertex* compact);
+        // Size in bytes of a vertex of the given format
+        static std::size_t vertex_size(VertexFormat format);
+        // Size of the range of a buffer needed by a mesh with the given numbers of vertices and indices, to reserve it with the constructor taking these numbers
+        static std::size_t required_bytes_size(std::size_t vertices_count, std::size_t indices_count, VertexFormat format=STANDARD, bool levels_of_detail=false, bool meshlets=false);
+        // Creates meshes sharing a device local vertex buffer and a palette buffer. The meshes are converted and written in the buffers from parallel threads.
+        static std::vector<std::shared_ptr<Mesh>> bulk_allocate_meshes(const GPU* gpu, const std::vector<std::vector<Face>>& faces, bool indexed=false, VertexFormat format=STANDARD,
+                                                                       bool levels_of_detail=false, bool meshlets=false);
+        static std::map<std::string, std::shared_ptr<Mesh>> bulk_allocate_meshes(const GPU* gpu, const std::map<std::string, std::vector<Face>>& faces, bool indexed=false, VertexFormat format=STANDARD,
+                                                                                 bool levels_of_detail=false, bool meshlets=false);
+    protected:
+        // Computes the bounding volumes and the ray cast geometry of the vertices, and makes them the mesh's content. If 'in_place' is true the buffer is mapped, and the vertices
+        // (unless COMPACT) and indices are already written in the mesh's range of it, otherwise they are uploaded there. Throws an error if a vertex references an entry missing from the palette.
+        void _commit(const Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count, bool in_place);
+        // Size of the range of the buffer needed by the vertices and indices, and by their levels of detail and meshlets if they are generated
+        std::size_t _required_bytes_size(std::size_t vertices_count, std::size_t indices_count) const;
+        // Returns a region of the dynamic mesh that is not the one drawn and that no canvas reads, waiting for the rendering canvases reading the next region if there is none.
+        // Throws an error if all the other regions are read by canvases still recording.
+        std::size_t _acquire_region();
+        // Makes the region the one drawn, and the one written by the next commit
+        void _use_region(std::size_t region);
     protected:
         std::shared_ptr<Buffer> _buffer = nullptr;
         std::size_t _offset = 0;
         std::size_t _bytes_size;
+        bool _indexed = false;
+        VertexFormat _vertex_format = STANDARD;
+        bool _generate_levels_of_detail = false;
+        std::vector<LevelOfDetail> _levels_of_detail;
+        bool _generate_meshlets = false;
+        std::vector<Meshlet> _meshlets;
+        std::size_t _meshlets_offset = 0; // position of the meshlet descriptors in the buffer
+        vec3 _position_offset = {0.f, 0.f, 0.f}; // dequantization of compact positions: position = offset + scale * quantized position
+        float _position_scale = 1.f;
+        std::shared_ptr<std::vector<DynamicRegion>> _regions = nullptr; // regions of the dynamic mesh (nullptr if it is not dynamic), shared with the canvases reading them
+        std::size_t _region = 0; // region drawn
+        std::size_t _region_stride = 0; // distance between two regions in the buffer
+        std::vector<Vertex> _dynamic_vertices; // vertices of the dynamic mesh, to write the ranges the regions missed
+        std::shared_ptr<Buffer> _palette_buffer = nullptr;
+        std::size_t _palette_offset = 0;
+        std::size_t _palette_capacity = 1; // number of entries reserved in the palette buffer (at least one, as a storage buffer range can not be empty)
+        std::vector<PaletteEntry> _palette;
+        uint32_t _palette_entries_used = 0; // one plus the largest palette index of the vertices
+        uint32_t _vertices_count = 0;
+        uint32_t _indices_count = 0;
+        BoundingBox _bounding_box;
+        BoundingSphere _bounding_sphere;
+        mutable std::array<std::vector<float>, 3> _positions; // x, y, z of the vertices, kept until the triangle hierarchy is built (gathered again from '_dynamic_vertices' for dynamic meshes)
+        std::vector<vec2> _UVs; // UV of each vertex
+        std::vector<uint32_t> _indices; // indices of the vertices of each triangle (empty if the mesh is not indexed)
+        mutable std::shared_ptr<const TriangleHierarchy> _triangle_hierarchy = nullptr; // built on first ray cast, shared with the ray casts in progress when an upload resets it
+        mutable std::mutex _triangle_hierarchy_mutex;
     };
 }
@@ -0,0 +1,46 @@
+#pragma once
+#include <RenderEngine/graphics/model/Mesh.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // Writes the vertices and indices of a mesh directly in the mapped memory of its buffer, at the mesh's offset, instead of building them in a std::vector and uploading them.
+    // The vertices must reference entries of the mesh's palette, which must be uploaded first. Once everything is written, 'finish' computes the bounding volumes of the mesh
+    // and makes its new vertices visible to the GPU. Builders of meshes with disjoint ranges of a buffer can be used from different threads.
+    // For COMPACT meshes, the float vertices are written in a temporary array and quantized in the buffer by 'finish', as the quantization needs the bounding box.
+    // For buffers that are not mapped (DEVICE_LOCAL memory), the vertices and indices are written in temporary arrays and uploaded by 'finish'.
+    // For dynamic meshes, they are written in a region that no canvas reads, drawn once 'finish' is called.
+    class MeshBuilder
+    {
+    public: // This class is non copyable
+        MeshBuilder() = delete;
+        MeshBuilder(const MeshBuilder& other) = delete;
+        MeshBuilder& operator=(const MeshBuilder& other) = delete;
+    public:
+        // Prepares the writing of 'vertices_count' vertices and 'indices_count' indices (three per triangle, or none). Throws an error if they do not fit in the mesh's range of the buffer.
+        MeshBuilder(Mesh& mesh, std::size_t vertices_count, std::size_t indices_count=0);
+        ~MeshBuilder();
+    public:
+        // The 'vertices_count' vertices to write
+        Vertex* vertices();
+        std::size_t vertices_count() const;
+        // The 'indices_count' indices to write, relative to the first vertex of the mesh
+        uint32_t* indices();
+        std::size_t indices_count() const;
+        // Commits the written vertices and indices to the mesh. Throws an error if a vertex references an entry missing from the palette, or if called twice.
+        void finish();
+    protected:
+        Mesh& _mesh;
+        std::size_t _vertices_count = 0;
+        std::size_t _indices_count = 0;
+        Vertex* _vertices = nullptr;
+        uint32_t* _indices = nullptr;
+        std::vector<Vertex> _staging; // float vertices of COMPACT meshes, or of meshes whose buffer is not mapped
+        std::vector<uint32_t> _staging_indices; // indices of meshes whose buffer is not mapped
+        bool _in_place = true; // true if the buffer is mapped
+        std::size_t _region = 0; // region written, if the mesh is dynamic
+        bool _finished = false;
+    };
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <RenderEngine/graphics/model/Mesh.hpp>
+#include <RenderEngine/graphics/Color.hpp>
+#include <RenderEngine/graphics/model/Material.hpp>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // Files of baked meshes, to skip the parsing and the processing of mesh files (welding, levels of detail, meshlets) on later launches.
+    // A cache file stores the mesh's range of the vertex buffer exactly as it is on the GPU (vertices, indices, indices of the levels of detail, meshlet descriptors),
+    // followed by the palette, the bounding volumes and the descriptors of the levels of detail and meshlets. Loading it is a copy from the mapped file to the buffer,
+    // or the decoding of the vertex and index streams if the file is compressed.
+    // The ray cast geometry is read back from the vertices: ray casts on meshes loaded from COMPACT caches use the quantized positions.
+    // The file stores the hash of the asset it was baked from, and is only valid for the version of the format that wrote it, and for hosts of the same endianness.
+    class MeshCache
+    {
+    public:
+        MeshCache() = delete;
+    public:
+        // Incremented when the layout of the files or of the baked meshes changes, invalidating the existing files
+        static constexpr uint32_t VERSION = 3;
+    public:
+        // Writes the mesh to the file, replacing it. The mesh's buffer must be mapped (HOST_VISIBLE memory), to read its content back.
+        // If 'compressed' is true the vertices and indices are encoded with MeshCodec, and decoded when loaded.
+        static void save(const Mesh& mesh, const std::string& path, uint64_t source_hash, bool compressed=false);
+        // Returns true if the file is a cache of the current version, baked from an asset with the given hash
+        static bool is_valid(const std::string& path, uint64_t source_hash);
+        // Creates a mesh from the file, in its own device local buffer. Throws an error if the file is not valid for the given hash.
+        static std::shared_ptr<Mesh> load(const GPU* gpu, const std::string& path, uint64_t source_hash);
+        // Loads a mesh file (see MeshLoader) through the cache file at 'cache_path': the cache is used if it was baked from the current content of the file (and of the buffers of a glTF file) with the same parameters,
+        // otherwise the mesh file is parsed and the cache is baked again.
+        static std::shared_ptr<Mesh> load_cached(const GPU* gpu, const std::string& path, const std::string& cache_path, bool indexed=true, Mesh::VertexFormat format=Mesh::STANDARD,
+                                                 bool levels_of_detail=false, bool meshlets=false, const Color& color=Color(1.f, 1.f, 1.f, 1.f), const Material& material=Material(),
+                                                 bool compressed=false);
+        // Hash of the content of a file, computed from parallel threads
+        static uint64_t file_hash(const std::string& path);
+    };
+}
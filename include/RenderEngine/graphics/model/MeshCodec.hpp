@@ -0,0 +1,30 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // Lossless compression of the vertex and index streams of mesh files. A stream is an array of records (vertices, or indices) made of 32 bits words.
+    // Each word is replaced by the zigzag coded difference with the same word of the previous record, and the bytes of the differences are transposed
+    // in planes (the first byte of all the records, then the second byte...), where neighbouring vertices give runs of small values.
+    // Planes are stored in groups of 16 bytes, each group packed on 0, 2, 4 or 8 bits per byte. Streams are split in blocks of records encoded independently,
+    // decoded from parallel threads with SIMD instructions (SSE when available).
+    class MeshCodec
+    {
+    public:
+        MeshCodec() = delete;
+    public:
+        // Number of records of a block
+        static constexpr std::size_t BLOCK_RECORDS = 8192;
+    public:
+        // Encodes 'count' vertices of 'stride' bytes (a multiple of 4)
+        static std::vector<char> encode_vertices(const void* vertices, std::size_t count, std::size_t stride);
+        // Decodes 'count' vertices of 'stride' bytes in 'vertices' (for example the mapped memory of a buffer). Returns false if the data is malformed or does not match the count or stride.
+        static bool decode_vertices(const char* data, std::size_t bytes_size, void* vertices, std::size_t count, std::size_t stride);
+        // Encodes 'count' indices, each as its difference with the previous index
+        static std::vector<char> encode_indices(const uint32_t* indices, std::size_t count);
+        // Decodes 'count' indices. Returns false if the data is malformed or does not match the count.
+        static bool decode_indices(const char* data, std::size_t bytes_size, uint32_t* indices, std::size_t count);
+    };
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <RenderEngine/graphics/model/Mesh.hpp>
+#include <RenderEngine/graphics/Color.hpp>
+#include <RenderEngine/graphics/model/Material.hpp>
+#include <RenderEngine/graphics/model/SmoothNormals.hpp>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // Imports the triangles of a mesh file: Wavefront OBJ, PLY (ascii or binary) or glTF 2.0 (.gltf with its buffers, or .glb), chosen by the extension of the file.
+    // The file is memory mapped and parsed in chunks from parallel threads. Its attributes are kept in arrays as the file indexes them,
+    // and 'write' then converts them to vertices straight in the destination memory (for example the memory of a MeshBuilder), without intermediate Faces.
+    // Polygons are split in triangle fans. Vertices without normal get smooth normals (see SmoothNormals), and vertices without UV get (0, 0).
+    // Materials are not imported: all the vertices reference the same palette entry. glTF meshes are placed by the transforms of the nodes of the default scene.
+    class MeshLoader
+    {
+    public: // This class is non copyable
+        MeshLoader() = delete;
+        MeshLoader(const MeshLoader& other) = delete;
+        MeshLoader& operator=(const MeshLoader& other) = delete;
+    public:
+        // Parses the file. Throws an error if it can not be read, if its format is not supported, or if it is malformed.
+        // The normals missing from the file are smoothed across the edges whose triangles make an angle of at most 'smoothing_angle'.
+        MeshLoader(const std::string& path, double smoothing_angle=PI, SmoothNormals::Weighting weighting=SmoothNormals::AREA);
+        ~MeshLoader();
+    public:
+        std::size_t triangles_count() const;
+        // Number of vertices written by 'write'. Indexed vertices are the distinct combinations of position, normal and UV referenced by the triangles.
+        std::size_t vertices_count(bool indexed) const;
+        // Number of indices written by 'write' (0 if not indexed)
+        std::size_t indices_count(bool indexed) const;
+        // Writes 'vertices_count(indexed)' vertices and 'indices_count(indexed)' indices, all referencing the entry 'palette' of the mesh's palette
+        void write(Vertex* vertices, uint32_t* indices, bool indexed, uint32_t palette=0) const;
+        // Creates a mesh of the file's triangles in its own buffer (device local by default), with a palette of a single entry
+        std::shared_ptr<Mesh> mesh(const GPU* gpu, bool indexed=true, Mesh::VertexFormat format=Mesh::STANDARD, bool levels_of_detail=false, bool meshlets=false,
+                                   const Color& color=Color(1.f, 1.f, 1.f, 1.f), const Material& material=Material(), Buffer::Memory memory=Buffer::DEVICE_LOCAL) const;
+    public:
+        // Paths of the files read besides the mesh file itself: the buffers of a .gltf or .glb file which are not embedded
+        static std::vector<std::string> dependencies(const std::string& path);
+    public:
+        static constexpr uint32_t NONE = 0xFFFFFFFF;
+    protected:
+        void _load_obj(const char* begin, const char* end);
+        void _load_ply(const char* begin, const char* end);
+        void _load_gltf(const std::string& path, const char* begin, const char* end);
+        // Checks the indices of the corners, then computes the normals missing from the file and merges the attributes indexed like the positions
+        void _finish(double smoothing_angle, SmoothNormals::Weighting weighting);
+    protected:
+        std::vector<vec3> _positions;
+        std::vector<vec3> _normals;
+        std::vector<vec2> _UVs;
+        std::vector<uint32_t> _corner_positions; // index of the position of each corner of each triangle
+        std::vector<uint32_t> _corner_normals; // index of the normal of each corner, or empty if the normals are indexed like the positions
+        std::vector<uint32_t> _corner_UVs; // index of the UV of each corner (NONE if it has none), or empty if the UVs are indexed like the positions (or absent)
+        std::vector<uint32_t> _welded_corners; // indexed vertex of each corner, if the attributes are not all indexed like the positions
+        std::vector<uint32_t> _welded_vertices; // first corner of each indexed vertex, if the attributes are not all indexed like the positions
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <RenderEngine/graphics/shaders/Types.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    class Frustum;
+
+    // Splits meshes into meshlets: clusters of neighbouring triangles, small enough for their bounds to be tight, so that the parts of a mesh outside of the view
+    // or facing away from the camera can be skipped when drawing it. The triangles are reordered so that each meshlet is a contiguous range of the mesh's triangles.
+    // Meshlets are grown greedily from a seed triangle, adding first the adjacent triangles that bring no new vertex, then the adjacent triangle closest to the meshlet's centroid,
+    // so that meshlets stay compact and their bounding spheres and normal cones tight.
+    class Meshlets
+    {
+    public:
+        Meshlets() = delete;
+    public:
+        static constexpr std::size_t MAX_VERTICES = 64;
+        static constexpr std::size_t MAX_TRIANGLES = 124;
+        // Every meshlet but the last has at least this many triangles: a meshlet is closed when it is full (a triangle brings at most three new vertices),
+        // or when it has no adjacent triangle left and already has this many triangles. Otherwise it is continued from a new seed triangle.
+        static constexpr std::size_t MIN_TRIANGLES = MAX_VERTICES / 3;
+    public:
+        // Splits the triangles into meshlets, and writes in 'triangles_order' the original index of each triangle in the reordered mesh.
+        // If 'indices' is nullptr, the vertices are taken three per triangle, and welded by position to find the adjacent triangles and count the vertices of a meshlet.
+        static std::vector<Meshlet> build(const Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count,
+                                          std::vector<uint32_t>& triangles_order);
+        // Upper bound of the number of meshlets of a mesh with the given number of triangles
+        static std::size_t max_meshlets_count(std::size_t triangles_count);
+        // Returns the indexes of the meshlets that may be visible by a camera, given its frustum and the position of the mesh in camera coordinates.
+        // The bounding spheres are tested against the frustum in bulk, then if 'cull_back_faces' is true the meshlets whose triangles all face away from the camera are removed.
+        // The mesh to camera transform is expected to have the same scale on all axes.
+        static std::vector<std::size_t> visible(const std::vector<Meshlet>& meshlets, const Frustum& frustum, const DrawParameters& params, bool cull_back_faces);
+    };
+}
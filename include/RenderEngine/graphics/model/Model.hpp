@@ -10,6 +10,15 @@ namespace RenderEngine
         Model();
         Model(const std::shared_ptr<Mesh>& _mesh, const Vector& position={}, const Quaternion orientation={}, double scale=1.0, Referential* parent=nullptr);
         ~Model();
+    public:
+        // Returns the bounding box of the mesh in absolute coordinates (empty if there is no mesh)
+        BoundingBox absolute_bounding_box() const;
+        // Returns the bounding sphere of the mesh in absolute coordinates (empty if there is no mesh)
+        BoundingSphere absolute_bounding_sphere() const;
+        // Returns the bounding box of the mesh in another referential's coordinates (empty if there is no mesh)
+        BoundingBox bounding_box_in(const Referential& other) const;
+        // Returns the bounding sphere of the mesh in another referential's coordinates (empty if there is no mesh)
+        BoundingSphere bounding_sphere_in(const Referential& other) const;
     public:
         std::shared_ptr<Mesh> mesh = nullptr;
     };
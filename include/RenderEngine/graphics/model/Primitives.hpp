@@ -0,0 +1,34 @@
+#pragma once
+#include <RenderEngine/graphics/shaders/Types.hpp>
+#include <RenderEngine/geometry/Vector.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // Generators of the same shapes as the Face generators, writing float vertices straight into caller provided memory (a std::vector or the mapped memory of a Buffer),
+    // without building intermediate Faces. The memory must hold the number of vertices (and indices) given by the corresponding '_count' function.
+    // Vertices are written three per triangle, unless stated otherwise, and all reference the entry 'palette' of the mesh's palette.
+    // The subdivisions of large shapes are generated in parallel threads.
+    class Primitives
+    {
+    public:
+        Primitives() = delete;
+    public:
+        static std::size_t quad_vertices_count();
+        static void quad(Vertex* vertices, const Vectorf& p1, const Vectorf& p2, const Vectorf& p3, const Vectorf& p4, uint32_t palette=0);
+        static std::size_t cube_vertices_count();
+        static void cube(Vertex* vertices, float length, uint32_t palette=0);
+        static std::size_t sphere_vertices_count(uint32_t divides);
+        // Sphere made by dividing 'divides' times the sides of the triangular faces of an icosahedron
+        static void sphere(Vertex* vertices, float radius, uint32_t divides=4, bool smooth_normals=true, uint32_t palette=0);
+        static std::size_t indexed_sphere_vertices_count(uint32_t divides);
+        static std::size_t indexed_sphere_indices_count(uint32_t divides);
+        // Same sphere as above with smooth normals, each vertex being shared by the triangles of a face of the icosahedron. Indices are relative to the first vertex.
+        static void indexed_sphere(Vertex* vertices, uint32_t* indices, float radius, uint32_t divides=4, uint32_t palette=0);
+        static std::size_t cylinder_vertices_count(uint32_t divides);
+        static void cylinder(Vertex* vertices, float length, float radius, uint32_t divides=10, bool smooth_normals=true, uint32_t palette=0);
+        static std::size_t cone_vertices_count(uint32_t divides);
+        static void cone(Vertex* vertices, float length, float radius, uint32_t divides=10, bool smooth_normals=true, uint32_t palette=0);
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <RenderEngine/graphics/shaders/Types.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // A simplified version of a mesh: triangles indexing the vertices of the original mesh
+    struct SimplifiedMesh
+    {
+        std::vector<uint32_t> indices; // three per triangle
+        float error = 0.f; // estimation of the largest distance to the original surface, in the mesh's coordinates
+    };
+
+    // Generates levels of detail of a mesh by quadric error metric edge collapse. Vertices are only collapsed onto other vertices, so that the simplified meshes
+    // only need new indices, and can reuse the vertices of the original mesh in its buffer.
+    // Vertices at the same position but with different UVs or palette entries form seams. Seam and border vertices only collapse along their seam or border,
+    // and vertices where seams meet are never collapsed, so that the UV and material boundaries are preserved. Normals do not form seams.
+    class Simplifier
+    {
+    public:
+        Simplifier() = delete;
+    public:
+        static constexpr std::size_t MAX_LEVELS = 4;
+        // Stops before generating a level with less triangles than this
+        static constexpr std::size_t MIN_TRIANGLES = 8;
+    public:
+        // Returns up to 'max_levels' (at most MAX_LEVELS) simplified versions of the triangles, each one with at most half the triangles of the previous one.
+        // Less levels are returned if the mesh can not be simplified enough. If 'indices' is nullptr, the vertices are taken three per triangle.
+        static std::vector<SimplifiedMesh> levels_of_detail(const Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count,
+                                                            std::size_t max_levels=MAX_LEVELS);
+        // Upper bound of the number of indices of all the levels of detail of a mesh with the given number of triangles
+        static std::size_t levels_of_detail_indices_count(std::size_t triangles_count);
+    };
+}
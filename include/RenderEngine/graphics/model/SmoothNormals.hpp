@@ -0,0 +1,35 @@
+#pragma once
+#include <RenderEngine/graphics/shaders/Types.hpp>
+#include <RenderEngine/graphics/model/Face.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace RenderEngine
+{
+    // Computes smooth normals of triangle meshes. Coincident positions are welded with a spatial hash: positions in the same cell of a grid, whose size is
+    // 'weld_tolerance' times the diagonal of the bounding box, share their normals. The normal of a corner is the weighted average of the normals
+    // of the triangles around its welded position that make an angle of at most 'smoothing_angle' with its own triangle, so that sharper edges stay hard.
+    // Triangles are weighted by their area, or by their angle at the welded position (which does not depend on how the surface is triangulated).
+    // Normals are computed from parallel threads.
+    class SmoothNormals
+    {
+    public:
+        SmoothNormals() = delete;
+    public:
+        enum Weighting {AREA, ANGLE};
+    public:
+        // Computes the normals of the triangles whose corners reference the positions 'corners' (or the positions three per triangle, if 'corners' is nullptr).
+        // Fills 'normals' with distinct normals (corners of a welded position with the same normal share it) and returns the index in 'normals' of the normal of each corner.
+        // Corners of degenerate triangles get the average normal of their welded position, or (0, 0, 1) if it has none.
+        static std::vector<uint32_t> generate(const vec3* positions, std::size_t positions_count, const uint32_t* corners, std::size_t corners_count,
+                                              std::vector<vec3>& normals, double smoothing_angle=PI, Weighting weighting=ANGLE, double weld_tolerance=1.0E-6);
+        // Replaces the normals of the faces
+        static void generate(std::vector<Face>& faces, double smoothing_angle=PI, Weighting weighting=ANGLE, double weld_tolerance=1.0E-6);
+        // Replaces the normals of the vertices (taken three per triangle if 'indices' is nullptr). An indexed vertex shared by triangles on both sides of a hard edge
+        // gets the average of the normals of its corners: such vertices must be split (as MeshLoader does) for the edge to stay hard.
+        static void generate(Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count,
+                             double smoothing_angle=PI, Weighting weighting=ANGLE, double weld_tolerance=1.0E-6);
+    };
+}
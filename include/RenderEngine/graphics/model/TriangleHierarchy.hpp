@@ -0,0 +1,58 @@
+#pragma once
+#include <RenderEngine/geometry/Vector.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace RenderEngine
+{
+    // The closest intersection of a ray with the triangles of a TriangleHierarchy
+    struct TriangleHit
+    {
+        std::size_t triangle = 0; // index of the triangle in the order it was given at construction
+        float distance = std::numeric_limits<float>::infinity(); // distance along the ray, in units of the ray direction's norm
+        float u = 0.f; // barycentric coordinate of the triangle's second vertex
+        float v = 0.f; // barycentric coordinate of the triangle's third vertex (the first one has 1-u-v)
+    };
+
+    // A bounding volume hierarchy over triangles in single precision, to intersect rays with a mesh in O(log(n)).
+    // The tree is built with the surface area heuristic and stored as a flat array of nodes, the two childrens of a node being contiguous.
+    class TriangleHierarchy
+    {
+    public:
+        // A node of the tree (32 bytes). Leafs have a non zero 'count' of triangles starting at index 'first'. Other nodes have their childrens at indexes 'first' and 'first+1'.
+        struct Node
+        {
+            float lower[3];
+            std::uint32_t first;
+            float upper[3];
+            std::uint32_t count;
+        };
+    public:
+        TriangleHierarchy() = delete;
+        // Builds the hierarchy from the coordinates of the vertices, the i-th triangle being made of the vertices 3*i, 3*i+1 and 3*i+2
+        TriangleHierarchy(const float* x, const float* y, const float* z, std::size_t triangles_count);
+        ~TriangleHierarchy();
+    public:
+        // Returns true if the ray hits a triangle closer than 'max_distance' (in units of the direction's norm). The closest hit is then written in 'hit'.
+        // Triangles are hit from both sides.
+        bool intersect(const Vectorf& origin, const Vectorf& direction, float max_distance, TriangleHit& hit) const;
+        // Returns the number of triangles
+        std::size_t size() const;
+    protected:
+        // A triangle stored as its first vertex and its two edges, for the ray/triangle intersection
+        struct Triangle
+        {
+            Vectorf vertex;
+            Vectorf edge1;
+            Vectorf edge2;
+        };
+        // Builds the subtree of the triangles in [begin, end) with its root at '_nodes[root]'
+        void _build_subtree(std::size_t root, std::uint32_t begin, std::uint32_t end, std::vector<Vectorf>& centers);
+    protected:
+        std::vector<Node> _nodes;
+        std::vector<Triangle> _triangles; // triangles in the order of the leafs
+        std::vector<std::uint32_t> _indexes; // index at construction of each triangle of '_triangles'
+    };
+}
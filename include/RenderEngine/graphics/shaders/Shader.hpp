@@ -24,6 +24,7 @@ namespace RenderEngine
     protected:
         Shader(const GPU* gpu,
                const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffers, // description of all the data passed through vertex buffer 
+               uint32_t vertex_stride, // size in bytes of a vertex in the vertex buffer (0 if there is none)
                const std::vector<std::pair<std::string, VkFormat>>& output_attachments, // output attachments (images drawn to)
                const std::vector<std::map<std::string, VkDescriptorSetLayoutBinding>>& descriptor_sets, // for each layout set, descriptor of all bindings (textures, Uniform Buffer Objects, ...)
                const std::map<std::string, VkPushConstantRange>& push_constants, // definition of all push constants.
@@ -38,6 +39,7 @@ namespace RenderEngine
         Blending _blending;
         VkRenderPass _vk_render_pass = VK_NULL_HANDLE;
         VkPipeline _vk_pipeline = VK_NULL_HANDLE;  // pipeline
+        VkPipeline _vk_compact_pipeline = VK_NULL_HANDLE;  // variant of the pipeline reading CompactVertex instead of Vertex (only for shaders with Vertex inputs)
         VkPipelineLayout _vk_pipeline_layout = VK_NULL_HANDLE; // pipeline layout
         VkPipelineBindPoint _vk_pipeline_bind_point;
         std::map<VkShaderStageFlagBits, VkShaderModule> _modules;  // shader modules (one for each stage)
@@ -60,12 +62,22 @@ namespace RenderEngine
                                                     const std::map<VkShaderStageFlagBits, std::vector<uint8_t>> shader_stages_bytecode);
         static VkPipeline _create_graphics_pipeline(const GPU& gpu,
                                const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffer,
+                               uint32_t vertex_stride,
                                const std::vector<std::pair<std::string, VkFormat>>& output_attachments,
                                const std::map<VkShaderStageFlagBits, VkShaderModule>& modules,
                                const VkPipelineLayout& pipeline_layout,
                                const VkRenderPass& render_pass,
                                bool depth_test,
-                               Blending blending);
+                               Blending blending,
+                               const VkSpecializationInfo* specialization); // values of the specialization constants of all the stages, or nullptr for their default values
+        // Returns the vertex attributes reading the same inputs from a CompactVertex, or an empty vector if some attributes have no compact counterpart
+        static std::vector<std::pair<std::string, VkVertexInputAttributeDescription>> _compact_vertex_buffers(const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffers);
+        // Throws if the vertex stage bytecode and the vertex attributes do not declare the same input locations, as when the bytecode is outdated
+        static void _check_vertex_inputs(const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffers,
+                                         const std::map<VkShaderStageFlagBits, std::vector<uint8_t>>& shader_stages_bytecode);
+        // Throws if the bytecode of a stage and the descriptor sets used by this stage do not declare the same (set, binding) pairs
+        static void _check_descriptor_sets(const std::vector<std::map<std::string, VkDescriptorSetLayoutBinding>>& descriptor_sets,
+                                           const std::map<VkShaderStageFlagBits, std::vector<uint8_t>>& shader_stages_bytecode);
         static VkPipeline _create_compute_pipeline(const GPU& gpu,
                                const VkPipelineLayout& pipeline_layout,
                                const std::map<VkShaderStageFlagBits, VkShaderModule>& modules);
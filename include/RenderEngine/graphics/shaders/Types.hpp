@@ -61,22 +61,65 @@ namespace RenderEngine
         float pad3;
     };
 
+    struct mat4  // column major
+    {
+        float i1j1;
+        float i1j2;
+        float i1j3;
+        float i1j4;
+
+        float i2j1;
+        float i2j2;
+        float i2j3;
+        float i2j4;
+
+        float i3j1;
+        float i3j2;
+        float i3j3;
+        float i3j4;
+
+        float i4j1;
+        float i4j2;
+        float i4j3;
+        float i4j4;
+    };
+
     struct Vertex
     {
         vec3 position;  // x, y, z
         vec3 normal;  // nx, ny, nz
-        vec4 color;  // r, g, b, a
         vec2 uv; // u, v
-        vec3 material; // metallic, roughness
+        uint32_t palette; // index of the vertex's color and material in the mesh's palette
+    };
+
+    struct CompactVertex  // quantized Vertex (20 bytes instead of 36), decoded by the vertex input formats of the pipeline
+    {
+        uint16_t position[4];  // x, y, z as UNORM16 in the mesh's quantization box, and padding
+        int16_t normal[2];  // unit normal, octahedral-encoded as SNORM16 (decoded by Shader3D.vert)
+        uint16_t uv[2];  // u, v as half floats
+        uint32_t palette;  // index of the vertex's color and material in the mesh's palette
+    };
+
+    struct PaletteEntry  // color and material shared by the vertices of a mesh, read from a storage buffer (std430 layout)
+    {
+        vec4 color;  // r, g, b, a
+        vec4 material;  // metalness, roughness, ambient occlusion, padding
+    };
+
+    struct Meshlet  // cluster of neighbouring triangles of a mesh, with its bounds for culling (std430 layout, to be readable from a storage buffer)
+    {
+        vec4 sphere;  // center x, y, z and radius of the cluster's bounding sphere, in mesh coordinates
+        vec4 cone;  // unit axis x, y, z of the cone containing the triangles' normals, and sine of its half angle (1 if the cluster can not be back facing as a whole)
+        uint32_t first_index;  // first index (or vertex, if the mesh is not indexed) of the cluster's triangles, relative to the mesh's first index (or vertex)
+        uint32_t triangles_count;
+        uint32_t padding[2];
     };
 
     struct DrawParameters
     {
-        vec4 mesh_position;
-        mat3 mesh_inverse_rotation;
+        mat4 mesh_to_camera;  // scale, rotation and translation from mesh coordinates to camera coordinates
         vec4 camera_parameters;
         uint32_t projection_type;
-        float mesh_scale;
     };
 
     struct LightParameters
@@ -4,6 +4,7 @@
 #include <map>
 #include <vector>
 #include <list>
+#include <cstdint>
 #include <math.h>
 
 #include "Macro.hpp"
@@ -25,5 +26,9 @@ namespace RenderEngine
         static std::string simplify_path(const std::string& path);
         ///< Replace all matching substrings 'searched' by 'replacement' in place. Returns the number of replacements.
         static unsigned int replace_substrings(std::string& str, const std::string& searched, const std::string& replacement);
+        ///< Converts a float to the bits of the nearest half precision float (IEEE 754 binary16)
+        static uint16_t to_half(float value);
+        ///< Converts the bits of a half precision float (IEEE 754 binary16) to a float
+        static float from_half(uint16_t half);
     };
 }
@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+namespace RenderEngine
+{
+    // A read only view of a whole file, mapped in memory by the operating system instead of being read in a buffer.
+    // Pages are loaded on first access, so that large files can be parsed from several threads without copying them.
+    class MappedFile
+    {
+    public: // This class is non copyable
+        MappedFile() = delete;
+        MappedFile(const MappedFile& other) = delete;
+        MappedFile& operator=(const MappedFile& other) = delete;
+    public:
+        // Maps the file. Throws an error if it can not be opened or mapped.
+        MappedFile(const std::string& path);
+        ~MappedFile();
+    public:
+        // First byte of the file (nullptr if the file is empty)
+        const char* data() const;
+        // Size of the file in bytes
+        std::size_t size() const;
+    protected:
+        const char* _data = nullptr;
+        std::size_t _size = 0;
+        void* _mapping = nullptr; // handle of the file mapping on Windows
+    };
+}
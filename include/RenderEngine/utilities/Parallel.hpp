@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace RenderEngine
+{
+    // Helpers to split loops over independent items between threads
+    struct Parallel
+    {
+        // Calls 'function(begin, end)' on contiguous ranges covering [0, count), each in its own thread, with at most one range per hardware thread
+        // and at least 'min_range_size' items per range. The calling thread processes the first range. Returns once all ranges are processed.
+        template<typename Function>
+        static void for_ranges(std::size_t count, std::size_t min_range_size, const Function& function)
+        {
+            std::size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+            std::size_t ranges = std::min(hardware_threads, std::max(count / std::max(min_range_size, static_cast<std::size_t>(1)), static_cast<std::size_t>(1)));
+            std::vector<std::thread> threads;
+            for (std::size_t i=1; i<ranges; i++)
+            {
+                threads.emplace_back([&function, count, ranges, i]() {function((count * i) / ranges, (count * (i+1)) / ranges);});
+            }
+            function(0, count / ranges);
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    };
+}
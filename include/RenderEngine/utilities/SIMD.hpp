@@ -0,0 +1,162 @@
+#pragma once
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define RENDERENGINE_SIMD_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define RENDERENGINE_SIMD_SSE
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define RENDERENGINE_SIMD_NEON
+#endif
+
+namespace RenderEngine
+{
+    // A FloatPack is a pack of floats that are processed by a single SIMD instruction (AVX, SSE or NEON depending on the compilation target, or a single float otherwise).
+    // Arrays processed with FloatPacks are expected to have a size that is a multiple of FloatPack::size (see FloatPack::padded_size).
+    struct FloatPack
+    {
+#if defined(RENDERENGINE_SIMD_AVX)
+        static constexpr std::size_t size = 8;
+        __m256 v;
+        FloatPack() : v(_mm256_setzero_ps()) {}
+        FloatPack(__m256 value) : v(value) {}
+        FloatPack(float value) : v(_mm256_set1_ps(value)) {}
+        static FloatPack load(const float* data) {return _mm256_loadu_ps(data);}
+        void store(float* data) const {_mm256_storeu_ps(data, v);}
+        friend FloatPack operator+(FloatPack a, FloatPack b) {return _mm256_add_ps(a.v, b.v);}
+        friend FloatPack operator-(FloatPack a, FloatPack b) {return _mm256_sub_ps(a.v, b.v);}
+        friend FloatPack operator*(FloatPack a, FloatPack b) {return _mm256_mul_ps(a.v, b.v);}
+        friend FloatPack operator/(FloatPack a, FloatPack b) {return _mm256_div_ps(a.v, b.v);}
+        static FloatPack sqrt(FloatPack a) {return _mm256_sqrt_ps(a.v);}
+        static FloatPack min(FloatPack a, FloatPack b) {return _mm256_min_ps(a.v, b.v);}
+        static FloatPack max(FloatPack a, FloatPack b) {return _mm256_max_ps(a.v, b.v);}
+        static FloatPack abs(FloatPack a) {return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v);}
+        // Returns a bit mask with the i-th bit set if a[i] < b[i]
+        static unsigned int less(FloatPack a, FloatPack b) {return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)));}
+        // Returns a[i] if mask[i] is set else b[i], with mask being the result of FloatPack::less
+        static FloatPack select(unsigned int mask, FloatPack a, FloatPack b)
+        {
+            __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            __m256i m = _mm256_set1_epi32(static_cast<int>(mask));
+            __m256 selected = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(m, bits), bits));
+            return _mm256_blendv_ps(b.v, a.v, selected);
+        }
+#elif defined(RENDERENGINE_SIMD_SSE)
+        static constexpr std::size_t size = 4;
+        __m128 v;
+        FloatPack() : v(_mm_setzero_ps()) {}
+        FloatPack(__m128 value) : v(value) {}
+        FloatPack(float value) : v(_mm_set1_ps(value)) {}
+        static FloatPack load(const float* data) {return _mm_loadu_ps(data);}
+        void store(float* data) const {_mm_storeu_ps(data, v);}
+        friend FloatPack operator+(FloatPack a, FloatPack b) {return _mm_add_ps(a.v, b.v);}
+        friend FloatPack operator-(FloatPack a, FloatPack b) {return _mm_sub_ps(a.v, b.v);}
+        friend FloatPack operator*(FloatPack a, FloatPack b) {return _mm_mul_ps(a.v, b.v);}
+        friend FloatPack operator/(FloatPack a, FloatPack b) {return _mm_div_ps(a.v, b.v);}
+        static FloatPack sqrt(FloatPack a) {return _mm_sqrt_ps(a.v);}
+        static FloatPack min(FloatPack a, FloatPack b) {return _mm_min_ps(a.v, b.v);}
+        static FloatPack max(FloatPack a, FloatPack b) {return _mm_max_ps(a.v, b.v);}
+        static FloatPack abs(FloatPack a) {return _mm_andnot_ps(_mm_set1_ps(-0.f), a.v);}
+        // Returns a bit mask with the i-th bit set if a[i] < b[i]
+        static unsigned int less(FloatPack a, FloatPack b) {return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmplt_ps(a.v, b.v)));}
+        // Returns a[i] if mask[i] is set else b[i], with mask being the result of FloatPack::less
+        static FloatPack select(unsigned int mask, FloatPack a, FloatPack b)
+        {
+            __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+            __m128i m = _mm_set1_epi32(static_cast<int>(mask));
+            __m128 selected = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(m, bits), bits));
+            return _mm_or_ps(_mm_and_ps(selected, a.v), _mm_andnot_ps(selected, b.v));
+        }
+#elif defined(RENDERENGINE_SIMD_NEON)
+        static constexpr std::size_t size = 4;
+        float32x4_t v;
+        FloatPack() : v(vdupq_n_f32(0.f)) {}
+        FloatPack(float32x4_t value) : v(value) {}
+        FloatPack(float value) : v(vdupq_n_f32(value)) {}
+        static FloatPack load(const float* data) {return vld1q_f32(data);}
+        void store(float* data) const {vst1q_f32(data, v);}
+        friend FloatPack operator+(FloatPack a, FloatPack b) {return vaddq_f32(a.v, b.v);}
+        friend FloatPack operator-(FloatPack a, FloatPack b) {return vsubq_f32(a.v, b.v);}
+        friend FloatPack operator*(FloatPack a, FloatPack b) {return vmulq_f32(a.v, b.v);}
+#if defined(__aarch64__) || defined(_M_ARM64)
+        friend FloatPack operator/(FloatPack a, FloatPack b) {return vdivq_f32(a.v, b.v);}
+        static FloatPack sqrt(FloatPack a) {return vsqrtq_f32(a.v);}
+#else
+        // 32 bits NEON has no division or square root: they are computed lane by lane, to keep the results exact
+        friend FloatPack operator/(FloatPack a, FloatPack b)
+        {
+            float x[4], y[4];
+            vst1q_f32(x, a.v);
+            vst1q_f32(y, b.v);
+            for (std::size_t i=0; i<4; i++)
+            {
+                x[i] /= y[i];
+            }
+            return vld1q_f32(x);
+        }
+        static FloatPack sqrt(FloatPack a)
+        {
+            float x[4];
+            vst1q_f32(x, a.v);
+            for (std::size_t i=0; i<4; i++)
+            {
+                x[i] = std::sqrt(x[i]);
+            }
+            return vld1q_f32(x);
+        }
+#endif
+        static FloatPack min(FloatPack a, FloatPack b) {return vminq_f32(a.v, b.v);}
+        static FloatPack max(FloatPack a, FloatPack b) {return vmaxq_f32(a.v, b.v);}
+        static FloatPack abs(FloatPack a) {return vabsq_f32(a.v);}
+        // Returns a bit mask with the i-th bit set if a[i] < b[i]
+        static unsigned int less(FloatPack a, FloatPack b)
+        {
+            const uint32x4_t bits = {1, 2, 4, 8};
+            uint32x4_t masked = vandq_u32(vcltq_f32(a.v, b.v), bits);
+#if defined(__aarch64__) || defined(_M_ARM64)
+            return vaddvq_u32(masked);
+#else
+            // 32 bits NEON has no horizontal add across a vector: pairwise adds of the halves
+            uint32x2_t sums = vpadd_u32(vget_low_u32(masked), vget_high_u32(masked));
+            return vget_lane_u32(vpadd_u32(sums, sums), 0);
+#endif
+        }
+        // Returns a[i] if mask[i] is set else b[i], with mask being the result of FloatPack::less
+        static FloatPack select(unsigned int mask, FloatPack a, FloatPack b)
+        {
+            const uint32x4_t bits = {1, 2, 4, 8};
+            uint32x4_t selected = vtstq_u32(vdupq_n_u32(mask), bits);
+            return vbslq_f32(selected, a.v, b.v);
+        }
+#else
+        static constexpr std::size_t size = 1;
+        float v;
+        FloatPack() : v(0.f) {}
+        FloatPack(float value) : v(value) {}
+        static FloatPack load(const float* data) {return *data;}
+        void store(float* data) const {*data = v;}
+        friend FloatPack operator+(FloatPack a, FloatPack b) {return a.v + b.v;}
+        friend FloatPack operator-(FloatPack a, FloatPack b) {return a.v - b.v;}
+        friend FloatPack operator*(FloatPack a, FloatPack b) {return a.v * b.v;}
+        friend FloatPack operator/(FloatPack a, FloatPack b) {return a.v / b.v;}
+        static FloatPack sqrt(FloatPack a) {return std::sqrt(a.v);}
+        static FloatPack min(FloatPack a, FloatPack b) {return std::min(a.v, b.v);}
+        static FloatPack max(FloatPack a, FloatPack b) {return std::max(a.v, b.v);}
+        static FloatPack abs(FloatPack a) {return std::abs(a.v);}
+        // Returns a bit mask with the i-th bit set if a[i] < b[i]
+        static unsigned int less(FloatPack a, FloatPack b) {return (a.v < b.v) ? 1 : 0;}
+        // Returns a[i] if mask[i] is set else b[i], with mask being the result of FloatPack::less
+        static FloatPack select(unsigned int mask, FloatPack a, FloatPack b) {return (mask & 1) ? a : b;}
+#endif
+        friend FloatPack operator-(FloatPack a) {return FloatPack(0.f) - a;}
+        // Mask with all lanes set
+        static constexpr unsigned int all = (1u << size) - 1u;
+        // Returns the smallest multiple of FloatPack::size that is greater or equal to n
+        static constexpr std::size_t padded_size(std::size_t n) {return ((n + size - 1) / size) * size;}
+    };
+}
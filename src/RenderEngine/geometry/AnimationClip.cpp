@@ -0,0 +1,129 @@
+#include <RenderEngine/geometry/AnimationClip.hpp>
+#include <RenderEngine/utilities/SIMD.hpp>
+#include <algorithm>
+#include <cmath>
+using namespace RenderEngine;
+
+// The SLERP approximation corrects the interpolation weight 't' of a normalized linear interpolation,
+// with polynomials fitted on the cosine 'd' of the angle between the two quaternions:
+// t' = t + t*(t-0.5)*(t-1)*(A*(t-0.5)² + B), with A and B polynomials of d.
+// The angular error is below 1e-3 radians, without any acos, sin or division other than the final normalization.
+
+AnimationClip::AnimationClip(bool _looping) : looping(_looping)
+{
+}
+
+AnimationClip::~AnimationClip()
+{
+}
+
+double AnimationClip::duration() const
+{
+    double longest = 0.;
+    for (const AnimationTrack& track : tracks)
+    {
+        longest = std::max(longest, track.duration());
+    }
+    return longest;
+}
+
+void AnimationClip::apply(double time)
+{
+    double clip_duration = duration();
+    if (looping && clip_duration > 0.)
+    {
+        time = std::fmod(time, clip_duration);
+        if (time < 0.)
+        {
+            time += clip_duration;
+        }
+    }
+    // gather the keyframes surrounding the time of each track
+    std::size_t padded_size = FloatPack::padded_size(tracks.size());
+    _weights.resize(padded_size);
+    for (std::size_t k=0; k<8; k++)
+    {
+        _from[k].resize(padded_size);
+        _to[k].resize(padded_size);
+    }
+    for (std::size_t n=0; n<tracks.size(); n++)
+    {
+        const AnimationTrack& track = tracks[n];
+        if (track.size() == 0)
+        {
+            _weights[n] = 0.f;
+            continue;
+        }
+        std::size_t i = track.segment(static_cast<float>(time));
+        std::size_t j = std::min(i+1, track.size()-1);
+        float duration = track.times[j] - track.times[i];
+        _weights[n] = (duration > 0.f) ? std::max(0.f, std::min(1.f, (static_cast<float>(time) - track.times[i]) / duration)) : 0.f;
+        for (std::size_t k=0; k<3; k++)
+        {
+            _from[k][n] = track.positions[k][i];
+            _to[k][n] = track.positions[k][j];
+        }
+        for (std::size_t k=0; k<4; k++)
+        {
+            _from[3+k][n] = track.orientations[k][i];
+            _to[3+k][n] = track.orientations[k][j];
+        }
+        _from[7][n] = track.scales[i];
+        _to[7][n] = track.scales[j];
+    }
+    // vectorized interpolation, results are written back in '_from'
+    const FloatPack zero(0.f), one(1.f), half(0.5f);
+    for (std::size_t n=0; n<padded_size; n+=FloatPack::size)
+    {
+        FloatPack t = FloatPack::load(&_weights[n]);
+        FloatPack s = one - t;
+        for (std::size_t k : {0, 1, 2, 7})
+        {
+            (FloatPack::load(&_from[k][n])*s + FloatPack::load(&_to[k][n])*t).store(&_from[k][n]);
+        }
+        FloatPack aw = FloatPack::load(&_from[3][n]), ax = FloatPack::load(&_from[4][n]), ay = FloatPack::load(&_from[5][n]), az = FloatPack::load(&_from[6][n]);
+        FloatPack bw = FloatPack::load(&_to[3][n]), bx = FloatPack::load(&_to[4][n]), by = FloatPack::load(&_to[5][n]), bz = FloatPack::load(&_to[6][n]);
+        FloatPack cosine = aw*bw + ax*bx + ay*by + az*bz;
+        FloatPack d = FloatPack::abs(cosine);
+        FloatPack A = FloatPack(1.0904f) + d*(FloatPack(-3.2452f) + d*(FloatPack(3.55645f) - d*FloatPack(1.43519f)));
+        FloatPack B = FloatPack(0.848013f) + d*(FloatPack(-1.06021f) + d*FloatPack(0.215638f));
+        FloatPack centered = t - half;
+        FloatPack corrected = t + t*centered*(t - one)*(A*centered*centered + B);
+        FloatPack first = one - corrected;
+        // take the shortest path, the quaternions q and -q being the same rotation
+        FloatPack second = FloatPack::select(FloatPack::less(cosine, zero), -corrected, corrected);
+        FloatPack w = aw*first + bw*second;
+        FloatPack x = ax*first + bx*second;
+        FloatPack y = ay*first + by*second;
+        FloatPack z = az*first + bz*second;
+        FloatPack squared_norm = w*w + x*x + y*y + z*z;
+        FloatPack inverse_norm = FloatPack::select(FloatPack::less(zero, squared_norm), one / FloatPack::sqrt(squared_norm), zero);
+        (w*inverse_norm).store(&_from[3][n]);
+        (x*inverse_norm).store(&_from[4][n]);
+        (y*inverse_norm).store(&_from[5][n]);
+        (z*inverse_norm).store(&_from[6][n]);
+    }
+    // scatter the results in the targets
+    for (std::size_t n=0; n<tracks.size(); n++)
+    {
+        const AnimationTrack& track = tracks[n];
+        if (track.size() == 0 || track.target == nullptr)
+        {
+            continue;
+        }
+        track.target->set_coordinates(Vector(_from[0][n], _from[1][n], _from[2][n]), Quaternion(_from[3][n], _from[4][n], _from[5][n], _from[6][n]), _from[7][n]);
+    }
+}
+
+Quaternion AnimationClip::approximate_SLERP(const Quaternion& q1, const Quaternion& q2, double t)
+{
+    double cosine = Quaternion::dot(q1, q2);
+    double d = std::abs(cosine);
+    double A = 1.0904 + d*(-3.2452 + d*(3.55645 - d*1.43519));
+    double B = 0.848013 + d*(-1.06021 + d*0.215638);
+    double centered = t - 0.5;
+    double corrected = t + t*centered*(t - 1.)*(A*centered*centered + B);
+    Quaternion q = q1*(1. - corrected) + q2*((cosine < 0.) ? -corrected : corrected);
+    double norm = q.norm();
+    return (norm > 0.) ? q / norm : Quaternion(0., 0., 0., 0.);
+}
@@ -0,0 +1,84 @@
+#include <RenderEngine/geometry/AnimationTrack.hpp>
+#include <RenderEngine/geometry/AnimationClip.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <algorithm>
+using namespace RenderEngine;
+
+AnimationTrack::AnimationTrack(Referential* _target) : target(_target)
+{
+}
+
+AnimationTrack::~AnimationTrack()
+{
+}
+
+void AnimationTrack::add_keyframe(double time, const Vector& position, const Quaternion& orientation, double scale)
+{
+    if (times.size() > 0 && time < times.back())
+    {
+        THROW_ERROR("Keyframes must be added by increasing time");
+    }
+    Quaternion q = orientation / orientation.norm();
+    times.push_back(static_cast<float>(time));
+    positions[0].push_back(static_cast<float>(position.x));
+    positions[1].push_back(static_cast<float>(position.y));
+    positions[2].push_back(static_cast<float>(position.z));
+    orientations[0].push_back(static_cast<float>(q.w));
+    orientations[1].push_back(static_cast<float>(q.x));
+    orientations[2].push_back(static_cast<float>(q.y));
+    orientations[3].push_back(static_cast<float>(q.z));
+    scales.push_back(static_cast<float>(scale));
+}
+
+std::size_t AnimationTrack::size() const
+{
+    return times.size();
+}
+
+double AnimationTrack::duration() const
+{
+    return (times.size() > 0) ? times.back() : 0.;
+}
+
+std::size_t AnimationTrack::segment(float time) const
+{
+    std::size_t n = times.size();
+    if (n < 2 || time < times[1])
+    {
+        _segment = 0;
+    }
+    else if (time >= times[n-2])
+    {
+        _segment = n-2;
+    }
+    else if (_segment+1 < n && times[_segment] <= time && time < times[_segment+1])
+    {
+        // same segment as the previous call
+    }
+    else if (_segment+2 < n && times[_segment+1] <= time && time < times[_segment+2])
+    {
+        _segment++;
+    }
+    else
+    {
+        _segment = static_cast<std::size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
+    }
+    return _segment;
+}
+
+std::tuple<Vector, Quaternion, double> AnimationTrack::sample(double time) const
+{
+    if (times.size() == 0)
+    {
+        return std::make_tuple(Vector(), Quaternion(), 1.0);
+    }
+    std::size_t i = segment(static_cast<float>(time));
+    std::size_t j = std::min(i+1, times.size()-1);
+    double duration = times[j] - times[i];
+    double t = (duration > 0.) ? std::max(0., std::min(1., (time - times[i]) / duration)) : 0.;
+    Vector p1(positions[0][i], positions[1][i], positions[2][i]);
+    Vector p2(positions[0][j], positions[1][j], positions[2][j]);
+    Quaternion q1(orientations[0][i], orientations[1][i], orientations[2][i], orientations[3][i]);
+    Quaternion q2(orientations[0][j], orientations[1][j], orientations[2][j], orientations[3][j]);
+    return std::make_tuple(p1*(1-t) + p2*t, AnimationClip::approximate_SLERP(q1, q2, t), scales[i]*(1-t) + scales[j]*t);
+}
@@ -0,0 +1,124 @@
+#include <RenderEngine/geometry/BoundingBox.hpp>
+#include <RenderEngine/utilities/SIMD.hpp>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+using namespace RenderEngine;
+
+BoundingBox::BoundingBox()
+{
+    double inf = std::numeric_limits<double>::infinity();
+    lower = Vector(inf, inf, inf);
+    upper = Vector(-inf, -inf, -inf);
+}
+
+BoundingBox::BoundingBox(const Vector& _lower, const Vector& _upper) : lower(_lower), upper(_upper)
+{
+}
+
+BoundingBox::~BoundingBox()
+{
+}
+
+bool BoundingBox::is_empty() const
+{
+    return (lower.x > upper.x) || (lower.y > upper.y) || (lower.z > upper.z);
+}
+
+Vector BoundingBox::center() const
+{
+    return (lower + upper) * 0.5;
+}
+
+Vector BoundingBox::half_extents() const
+{
+    return (upper - lower) * 0.5;
+}
+
+BoundingBox BoundingBox::expanded(const Vector& point) const
+{
+    return BoundingBox(Vector(std::min(lower.x, point.x), std::min(lower.y, point.y), std::min(lower.z, point.z)),
+                       Vector(std::max(upper.x, point.x), std::max(upper.y, point.y), std::max(upper.z, point.z)));
+}
+
+BoundingBox BoundingBox::merged(const BoundingBox& other) const
+{
+    return BoundingBox(Vector(std::min(lower.x, other.lower.x), std::min(lower.y, other.lower.y), std::min(lower.z, other.lower.z)),
+                       Vector(std::max(upper.x, other.upper.x), std::max(upper.y, other.upper.y), std::max(upper.z, other.upper.z)));
+}
+
+BoundingBox BoundingBox::transformed(const Transform& transform) const
+{
+    if (is_empty())
+    {
+        return BoundingBox();
+    }
+    // The center is transformed as a point, and the half extents by the absolute values of the linear part
+    Vector c = transform * center();
+    Vector e = half_extents();
+    const std::array<std::array<double, 4>, 3>& m = transform.scalars;
+    Vector extents(std::abs(m[0][0])*e.x + std::abs(m[0][1])*e.y + std::abs(m[0][2])*e.z,
+                   std::abs(m[1][0])*e.x + std::abs(m[1][1])*e.y + std::abs(m[1][2])*e.z,
+                   std::abs(m[2][0])*e.x + std::abs(m[2][1])*e.y + std::abs(m[2][2])*e.z);
+    return BoundingBox(c - extents, c + extents);
+}
+
+BoundingBox BoundingBox::from_points(const float* x, const float* y, const float* z, std::size_t count)
+{
+    if (count == 0)
+    {
+        return BoundingBox();
+    }
+    float inf = std::numeric_limits<float>::infinity();
+    FloatPack min_x(inf), min_y(inf), min_z(inf);
+    FloatPack max_x(-inf), max_y(-inf), max_z(-inf);
+    std::size_t packed = (count / FloatPack::size) * FloatPack::size;
+    for (std::size_t i=0; i<packed; i+=FloatPack::size)
+    {
+        FloatPack px = FloatPack::load(&x[i]);
+        FloatPack py = FloatPack::load(&y[i]);
+        FloatPack pz = FloatPack::load(&z[i]);
+        min_x = FloatPack::min(min_x, px);
+        min_y = FloatPack::min(min_y, py);
+        min_z = FloatPack::min(min_z, pz);
+        max_x = FloatPack::max(max_x, px);
+        max_y = FloatPack::max(max_y, py);
+        max_z = FloatPack::max(max_z, pz);
+    }
+    // horizontal reduction of the packs, then the remaining points
+    float lanes[6][FloatPack::size];
+    min_x.store(lanes[0]);
+    min_y.store(lanes[1]);
+    min_z.store(lanes[2]);
+    max_x.store(lanes[3]);
+    max_y.store(lanes[4]);
+    max_z.store(lanes[5]);
+    float bounds[6] = {inf, inf, inf, -inf, -inf, -inf};
+    for (std::size_t j=0; j<FloatPack::size; j++)
+    {
+        for (std::size_t k=0; k<3; k++)
+        {
+            bounds[k] = std::min(bounds[k], lanes[k][j]);
+            bounds[k+3] = std::max(bounds[k+3], lanes[k+3][j]);
+        }
+    }
+    for (std::size_t i=packed; i<count; i++)
+    {
+        bounds[0] = std::min(bounds[0], x[i]);
+        bounds[1] = std::min(bounds[1], y[i]);
+        bounds[2] = std::min(bounds[2], z[i]);
+        bounds[3] = std::max(bounds[3], x[i]);
+        bounds[4] = std::max(bounds[4], y[i]);
+        bounds[5] = std::max(bounds[5], z[i]);
+    }
+    return BoundingBox(Vector(bounds[0], bounds[1], bounds[2]), Vector(bounds[3], bounds[4], bounds[5]));
+}
+
+namespace RenderEngine
+{
+    std::ostream& operator<<(std::ostream& os, const BoundingBox& box)
+    {
+        os << "[" << box.lower << ", " << box.upper << "]";
+        return os;
+    }
+}
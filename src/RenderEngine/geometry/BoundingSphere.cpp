@@ -0,0 +1,109 @@
+#include <RenderEngine/geometry/BoundingSphere.hpp>
+#include <RenderEngine/geometry/BoundingBox.hpp>
+#include <RenderEngine/utilities/SIMD.hpp>
+#include <algorithm>
+#include <cmath>
+using namespace RenderEngine;
+
+BoundingSphere::BoundingSphere()
+{
+}
+
+BoundingSphere::BoundingSphere(const Vector& _center, double _radius) : center(_center), radius(_radius)
+{
+}
+
+BoundingSphere::~BoundingSphere()
+{
+}
+
+bool BoundingSphere::is_empty() const
+{
+    return radius < 0.;
+}
+
+BoundingSphere BoundingSphere::merged(const BoundingSphere& other) const
+{
+    if (other.is_empty())
+    {
+        return *this;
+    }
+    if (is_empty())
+    {
+        return other;
+    }
+    Vector offset = other.center - center;
+    double distance = offset.norm();
+    if (distance + other.radius <= radius)
+    {
+        return *this;
+    }
+    if (distance + radius <= other.radius)
+    {
+        return other;
+    }
+    // the merged sphere touches the far sides of both spheres
+    double merged_radius = 0.5 * (distance + radius + other.radius);
+    return BoundingSphere(center + offset * ((merged_radius - radius) / distance), merged_radius);
+}
+
+BoundingSphere BoundingSphere::transformed(const Transform& transform) const
+{
+    if (is_empty())
+    {
+        return BoundingSphere();
+    }
+    // The radius is scaled by the largest stretch of the linear part. It is the largest column norm for a similarity (orthogonal columns of same norm),
+    // otherwise the Frobenius norm is used as an upper bound.
+    const std::array<std::array<double, 4>, 3>& m = transform.scalars;
+    Vector columns[3] = {Vector(m[0][0], m[1][0], m[2][0]), Vector(m[0][1], m[1][1], m[2][1]), Vector(m[0][2], m[1][2], m[2][2])};
+    double squared_norms[3] = {columns[0].squared_norm(), columns[1].squared_norm(), columns[2].squared_norm()};
+    double largest = std::max(squared_norms[0], std::max(squared_norms[1], squared_norms[2]));
+    double tolerance = 1.0E-9 * largest;
+    bool orthogonal = std::abs(Vector::dot(columns[0], columns[1])) <= tolerance
+                   && std::abs(Vector::dot(columns[0], columns[2])) <= tolerance
+                   && std::abs(Vector::dot(columns[1], columns[2])) <= tolerance;
+    double stretch = orthogonal ? largest : (squared_norms[0] + squared_norms[1] + squared_norms[2]);
+    return BoundingSphere(transform * center, radius * std::sqrt(stretch));
+}
+
+BoundingSphere BoundingSphere::from_points(const float* x, const float* y, const float* z, std::size_t count)
+{
+    if (count == 0)
+    {
+        return BoundingSphere();
+    }
+    Vector c = BoundingBox::from_points(x, y, z, count).center();
+    FloatPack cx(static_cast<float>(c.x)), cy(static_cast<float>(c.y)), cz(static_cast<float>(c.z));
+    FloatPack max_d2(0.f);
+    std::size_t packed = (count / FloatPack::size) * FloatPack::size;
+    for (std::size_t i=0; i<packed; i+=FloatPack::size)
+    {
+        FloatPack dx = FloatPack::load(&x[i]) - cx;
+        FloatPack dy = FloatPack::load(&y[i]) - cy;
+        FloatPack dz = FloatPack::load(&z[i]) - cz;
+        max_d2 = FloatPack::max(max_d2, dx*dx + dy*dy + dz*dz);
+    }
+    float lanes[FloatPack::size];
+    max_d2.store(lanes);
+    double d2 = 0.;
+    for (std::size_t j=0; j<FloatPack::size; j++)
+    {
+        d2 = std::max(d2, static_cast<double>(lanes[j]));
+    }
+    for (std::size_t i=packed; i<count; i++)
+    {
+        d2 = std::max(d2, (Vector(x[i], y[i], z[i]) - c).squared_norm());
+    }
+    // relative margin so that float rounding of the coordinates never puts a point outside of the sphere
+    return BoundingSphere(c, std::sqrt(d2) * (1. + 1.0E-6));
+}
+
+namespace RenderEngine
+{
+    std::ostream& operator<<(std::ostream& os, const BoundingSphere& sphere)
+    {
+        os << "(" << sphere.center << ", " << sphere.radius << ")";
+        return os;
+    }
+}
@@ -3,49 +3,30 @@
 #include <RenderEngine/geometry/Quaternion.hpp>
 using namespace RenderEngine;
 
-Matrix::Matrix()
+template<typename T>
+MatrixT<T>::MatrixT(const QuaternionT<T>& quat)
 {
-}
-
-Matrix::Matrix(const Matrix& other)
-{
-    *this = other;
-}
-
-Matrix::Matrix(const Vector& diagonal)
-{
-    scalars[0][0] = diagonal.x;
-    scalars[1][1] = diagonal.y;
-    scalars[2][2] = diagonal.z;
-}
-
-Matrix::Matrix(const std::array<std::array<double, 3>, 3>& elements)
-{
-    scalars = elements;
-}
-
-Matrix::Matrix(const Quaternion& quat)
-{
-    scalars[0][0] = std::pow(quat.w, 2.) + std::pow(quat.x, 2.) - std::pow(quat.y, 2.) - std::pow(quat.z, 2.);
+    const T ww = quat.w*quat.w;
+    const T xx = quat.x*quat.x;
+    const T yy = quat.y*quat.y;
+    const T zz = quat.z*quat.z;
+    scalars[0][0] = ww + xx - yy - zz;
     scalars[0][1] = 2*quat.x*quat.y - 2*quat.w*quat.z;
     scalars[0][2] = 2*quat.w*quat.y + 2*quat.x*quat.z;
 
     scalars[1][0] = 2*quat.w*quat.z + 2*quat.x*quat.y;
-    scalars[1][1] = std::pow(quat.w, 2.) - std::pow(quat.x, 2.) + std::pow(quat.y, 2.) - std::pow(quat.z, 2.);
+    scalars[1][1] = ww - xx + yy - zz;
     scalars[1][2] = 2*quat.y*quat.z - 2*quat.w*quat.x;
 
     scalars[2][0] = 2*quat.x*quat.z - 2*quat.w*quat.y;
     scalars[2][1] = 2*quat.w*quat.x + 2*quat.y*quat.z;
-    scalars[2][2] = std::pow(quat.w, 2.) - std::pow(quat.x, 2.) - std::pow(quat.y, 2.) + std::pow(quat.z, 2.);
-}
-
-Matrix::~Matrix()
-{
+    scalars[2][2] = ww - xx - yy + zz;
 }
 
-Matrix Matrix::transposed() const
+template<typename T>
+MatrixT<T> MatrixT<T>::transposed() const
 {
-    Matrix result;
+    MatrixT result;
     for (unsigned int i=0; i<3; i++)
     {
         for (unsigned int j=0; j<3; j++)
@@ -56,7 +37,8 @@ Matrix Matrix::transposed() const
     return result;
 }
 
-mat3 Matrix::to_mat3() const
+template<typename T>
+mat3 MatrixT<T>::to_mat3() const
 {
     return {static_cast<float>(scalars[0][0]),
             static_cast<float>(scalars[0][1]),
@@ -72,9 +54,10 @@ mat3 Matrix::to_mat3() const
             0.f};
 }
 
-Matrix Matrix::operator*(const Matrix& other) const
+template<typename T>
+MatrixT<T> MatrixT<T>::operator*(const MatrixT& other) const
 {
-    Matrix result;
+    MatrixT result;
     for (unsigned int i=0; i<3; i++)
     {
         for (unsigned int j=0; j<3; j++)
@@ -88,22 +71,18 @@ Matrix Matrix::operator*(const Matrix& other) const
     return result;
 }
 
-Vector Matrix::operator*(const Vector& vector) const
+template<typename T>
+VectorT<T> MatrixT<T>::operator*(const VectorT<T>& vector) const
 {
     return {vector.x * scalars[0][0] + vector.y * scalars[0][1] + vector.z * scalars[0][2],
             vector.x * scalars[1][0] + vector.y * scalars[1][1] + vector.z * scalars[1][2],
             vector.x * scalars[2][0] + vector.y * scalars[2][1] + vector.z * scalars[2][2]};
 }
 
-Matrix& Matrix::operator=(const Matrix& other)
-{
-    scalars = other.scalars;
-    return *this;
-}
-
 namespace RenderEngine
 {
-    std::ostream& operator<<(std::ostream& os, const Matrix& mat)
+    template<typename T>
+    std::ostream& operator<<(std::ostream& os, const MatrixT<T>& mat)
     {
         for (unsigned int i=0; i<3; i++)
         {
@@ -124,4 +103,9 @@ namespace RenderEngine
         os << std::endl;
         return os;
     }
+
+    template class MatrixT<float>;
+    template class MatrixT<double>;
+    template std::ostream& operator<<(std::ostream& os, const MatrixT<float>& mat);
+    template std::ostream& operator<<(std::ostream& os, const MatrixT<double>& mat);
 }
@@ -1,104 +1,94 @@
 #include <RenderEngine/geometry/Quaternion.hpp>
 #include <RenderEngine/geometry/Vector.hpp>
 #include <RenderEngine/utilities/Macro.hpp>
+#include <RenderEngine/utilities/SIMD.hpp>
+#include <algorithm>
 
 using namespace RenderEngine;
 
-Quaternion::Quaternion()
+template<typename T>
+QuaternionT<T>::QuaternionT(T radians, const VectorT<T>& axis)
 {
-}
-
-Quaternion::Quaternion(const Quaternion& other)
-{
-    w = other.w;
-    x = other.x;
-    y = other.y;
-    z = other.z;
-}
-
-Quaternion::Quaternion(double W, double X, double Y, double Z)
-{
-    w = W;
-    x = X;
-    y = Y;
-    z = Z;
-}
-
-Quaternion::Quaternion(double radians, const Vector& axis)
-{
-    Vector normed = axis.normed();
+    VectorT<T> normed = axis.normed();
+    T s = std::sin(radians/2);
     w = std::cos(radians/2);
-    x = normed.x*std::sin(radians/2);
-    y = normed.y*std::sin(radians/2);
-    z = normed.z*std::sin(radians/2);
+    x = normed.x*s;
+    y = normed.y*s;
+    z = normed.z*s;
 }
 
-Quaternion::Quaternion(const Vector& from, const Vector& to)
+template<typename T>
+QuaternionT<T>::QuaternionT(const VectorT<T>& from, const VectorT<T>& to)
 {
-    double radians = Vector::angle(from, to) * PI / 180.;
-    Vector axis = Vector::cross(from, to).normed();
+    T radians = static_cast<T>(VectorT<T>::angle(from, to) * PI / 180.);
+    VectorT<T> axis = VectorT<T>::cross(from, to).normed();
     //If 'from' is in the opposite direction of 'to', they are rotated by 180°, and there is an infinite number of axis to choose from.
     if (axis.norm() < 1.0E-6 && std::abs(radians) > 1.0E-3)
     {
-        Vector n1 = Vector::cross(from, {1., 0., 0.}).normed();
+        VectorT<T> n1 = VectorT<T>::cross(from, {1., 0., 0.}).normed();
         if (n1.norm() > 1.0E-6)
         {
-            axis = Vector::cross(from, n1).normed();
+            axis = VectorT<T>::cross(from, n1).normed();
         }
         else
         {
-            n1 = Vector::cross(from, {0., 1., 0.});
-            axis = Vector::cross(from, n1).normed();
+            n1 = VectorT<T>::cross(from, {0., 1., 0.});
+            axis = VectorT<T>::cross(from, n1).normed();
         }
     }
-    w = cos(radians/2);
-    x = axis.x*sin(radians/2);
-    y = axis.y*sin(radians/2);
-    z = axis.z*sin(radians/2);
-}
-
-Quaternion::~Quaternion()
-{
+    T s = std::sin(radians/2);
+    w = std::cos(radians/2);
+    x = axis.x*s;
+    y = axis.y*s;
+    z = axis.z*s;
 }
 
-double Quaternion::norm() const
+template<typename T>
+T QuaternionT<T>::norm() const
 {
-    return std::sqrt(std::pow(w, 2) + std::pow(x, 2) + std::pow(y, 2) + std::pow(z, 2));
+    return std::sqrt(squared_norm());
 }
 
-void Quaternion::normalize()
+template<typename T>
+void QuaternionT<T>::normalize()
 {
-    double n = norm();
+    T n = norm();
     if (n > 0.)
     {
         *this /= n;
     }
 }
 
-Quaternion Quaternion::normed() const
+template<typename T>
+QuaternionT<T> QuaternionT<T>::normed() const
 {
-    double n = norm();
+    T n = norm();
     if (n > 0.)
     {
         return *this / (n*n);
     }
-    return Quaternion(0., 0., 0., 0.);
+    return QuaternionT(0., 0., 0., 0.);
 }
 
-Quaternion Quaternion::conjugate() const
+template<typename T>
+QuaternionT<T> QuaternionT<T>::inverse() const
 {
-    return Quaternion(w, -x, -y, -z);
+    return conjugate()/squared_norm();
 }
 
-Quaternion Quaternion::inverse() const
+template<typename T>
+VectorT<T> QuaternionT<T>::rotate(const VectorT<T>& vector) const
 {
-    double squared_norm = std::pow(w, 2) + std::pow(x, 2) + std::pow(y, 2) + std::pow(z, 2);
-    return conjugate()/squared_norm;
+    // v' = v + (w*t + u x t)/|q|² with u the vector part of the quaternion and t = 2 u x v
+    VectorT<T> u(x, y, z);
+    VectorT<T> t = VectorT<T>::cross(u, vector) * static_cast<T>(2);
+    return vector + (w*t + VectorT<T>::cross(u, t)) / squared_norm();
 }
 
-bool Quaternion::equal(const Quaternion& q1, const Quaternion& q2, double tolerance)
+template<typename T>
+bool QuaternionT<T>::equal(const QuaternionT& q1, const QuaternionT& q2, T tolerance)
 {
-    double n = (q1-q2).norm();
+    T n = (q1-q2).norm();
 	if (n < tolerance)
 	{
 		return true;
@@ -106,20 +96,16 @@ bool Quaternion::equal(const Quaternion& q1, const Quaternion& q2, double tolera
 	return false;
 }
 
-double Quaternion::dot(const Quaternion& q1, const Quaternion& q2)
-{
-    return q1.w*q2.w + q1.x*q2.x + q1.y*q2.y + q1.z*q2.z;
-}
-
-Quaternion Quaternion::SLERP(const Quaternion& Q1, const Quaternion& Q2, double t)
+template<typename T>
+QuaternionT<T> QuaternionT<T>::SLERP(const QuaternionT& Q1, const QuaternionT& Q2, T t)
 {
-    t = std::max(0., std::min(t, 1.));
-    Quaternion q1(Q1.normed());
-    Quaternion q2(Q2.normed());
-    double dot = Quaternion::dot(q1, q2);
+    t = std::max(static_cast<T>(0), std::min(t, static_cast<T>(1)));
+    QuaternionT q1(Q1.normed());
+    QuaternionT q2(Q2.normed());
+    T dot = QuaternionT::dot(q1, q2);
     if (dot > 0.9999)
     {
-        Quaternion q = q1*(1.-t) + q2*t;
+        QuaternionT q = q1*(1-t) + q2*t;
         return q.normed();
     }
     if (dot < 0.)
@@ -127,109 +113,70 @@ Quaternion Quaternion::SLERP(const Quaternion& Q1, const Quaternion& Q2, double
         q2 = -q2;
         dot = -dot;
     }
-    double theta = acos(dot);
-    double s1 = sin(theta*(1.-t))/sin(theta);
-    double s2 = sin(theta*t)/sin(theta);
+    T theta = std::acos(dot);
+    T sin_theta = std::sin(theta);
+    T s1 = std::sin(theta*(1-t))/sin_theta;
+    T s2 = std::sin(theta*t)/sin_theta;
     return s1*q1 + s2*q2;
 }
 
-namespace RenderEngine
-{
-    std::ostream& operator<<(std::ostream& os, const Quaternion& rot)
-    {
-        os << "(" << rot.w << ", " << rot.x << ", " << rot.y << ", " << rot.z << ")";
-        return os;
-    }
-}
-
-Quaternion& Quaternion::operator=(const Quaternion& other)
+template<typename T>
+QuaternionT<T> QuaternionT<T>::operator*(const QuaternionT& other) const
 {
-    w = other.w;
-    x = other.x;
-    y = other.y;
-    z = other.z;
-    return *this;
-}
-
-Quaternion Quaternion::operator*(const Quaternion& other) const
-{
-    Vector u1(x, y, z);
-    Vector u2(other.x, other.y, other.z);
-    Vector u = w*u2 + other.w*u1 + Vector::cross(u1, u2);
-    return Quaternion(w*other.w - Vector::dot(u1, u2), u.x, u.y, u.z);
-}
-
-Vector Quaternion::operator*(const Vector& vector) const
-{
-    Quaternion result(*this * Quaternion(0., vector.x, vector.y, vector.z) * inverse());
-    return Vector(result.x, result.y, result.z);
-}
-
-Quaternion Quaternion::operator*(double other) const
-{
-    return Quaternion(w*other, x*other, y*other, z*other);
+    return QuaternionT(w*other.w - x*other.x - y*other.y - z*other.z,
+                       w*other.x + other.w*x + y*other.z - z*other.y,
+                       w*other.y + other.w*y + z*other.x - x*other.z,
+                       w*other.z + other.w*z + x*other.y - y*other.x);
 }
 
 namespace RenderEngine
 {
-    Quaternion operator*(double other, const Quaternion& quat)
+    template<>
+    QuaternionT<float> QuaternionT<float>::operator*(const QuaternionT<float>& other) const
     {
-            return Quaternion(quat.w*other, quat.x*other, quat.y*other, quat.z*other);
+#if defined(RENDERENGINE_SIMD_SSE) || defined(RENDERENGINE_SIMD_AVX)
+        // lanes are (w, x, y, z)
+        __m128 a = _mm_load_ps(&w);
+        __m128 b = _mm_load_ps(&other.w);
+        __m128 a_w = _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 a_x = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 a_y = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2));
+        __m128 a_z = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3));
+        // a_w * (bw, bx, by, bz) + a_x * (-bx, bw, -bz, by) + a_y * (-by, bz, bw, -bx) + a_z * (-bz, -by, bx, bw)
+        __m128 b_x = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.f, 1.f, -1.f, 1.f));
+        __m128 b_y = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(-1.f, 1.f, 1.f, -1.f));
+        __m128 b_z = _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(-1.f, -1.f, 1.f, 1.f));
+        __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a_w, b), _mm_mul_ps(a_x, b_x)),
+                              _mm_add_ps(_mm_mul_ps(a_y, b_y), _mm_mul_ps(a_z, b_z)));
+        QuaternionT<float> result;
+        _mm_store_ps(&result.w, r);
+        return result;
+#else
+        return QuaternionT<float>(w*other.w - x*other.x - y*other.y - z*other.z,
+                                  w*other.x + other.w*x + y*other.z - z*other.y,
+                                  w*other.y + other.w*y + z*other.x - x*other.z,
+                                  w*other.z + other.w*z + x*other.y - y*other.x);
+#endif
     }
 }
 
-Quaternion& Quaternion::operator*=(double other)
-{
-    w *= other;
-    x *= other;
-    y *= other;
-    z *= other;
-    return *this;
-}
-
-Quaternion Quaternion::operator/(double other) const
-{
-    return Quaternion(w/other, x/other, y/other, z/other);
-}
-
-Quaternion& Quaternion::operator/=(double other)
-{
-    w /= other;
-    x /= other;
-    y /= other;
-    z /= other;
-    return *this;
-}
-
-Quaternion Quaternion::operator+(const Quaternion& other) const
+template<typename T>
+VectorT<T> QuaternionT<T>::operator*(const VectorT<T>& vector) const
 {
-    return Quaternion(w+other.w, x+other.x, y+other.y, z+other.z);
+    return rotate(vector);
 }
 
-Quaternion& Quaternion::operator+=(const Quaternion& other)
-{
-    w += other.w;
-    x += other.x;
-    y += other.y;
-    z += other.z;
-    return *this;
-}
-
-Quaternion Quaternion::operator-(const Quaternion& other) const
-{
-    return Quaternion(w-other.w, x-other.x, y-other.y, z-other.z);
-}
-
-Quaternion Quaternion::operator-() const
+namespace RenderEngine
 {
-    return Quaternion(-w, -x, -y, -z);
-}
+    template<typename T>
+    std::ostream& operator<<(std::ostream& os, const QuaternionT<T>& rot)
+    {
+        os << "(" << rot.w << ", " << rot.x << ", " << rot.y << ", " << rot.z << ")";
+        return os;
+    }
 
-Quaternion& Quaternion::operator-=(const Quaternion& other)
-{
-    w -= other.w;
-    x -= other.x;
-    y -= other.y;
-    z -= other.z;
-    return *this;
+    template class QuaternionT<float>;
+    template class QuaternionT<double>;
+    template std::ostream& operator<<(std::ostream& os, const QuaternionT<float>& rot);
+    template std::ostream& operator<<(std::ostream& os, const QuaternionT<double>& rot);
 }
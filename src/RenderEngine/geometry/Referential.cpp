@@ -1,16 +1,18 @@
 #include <RenderEngine/geometry/Referential.hpp>
+#include <RenderEngine/geometry/Matrix.hpp>
+#include <RenderEngine/utilities/SIMD.hpp>
 using namespace RenderEngine;
 
-Referential::Referential(const Vector& _position, const Quaternion _orientation, double _scale, Referential* _parent)
+Referential::Referential(const Vector& position, const Quaternion orientation, double scale, Referential* _parent)
 {
     parent = _parent;
     if (_parent != nullptr)
     {
         parent->childrens.push_back(this);
     }
-    position = _position;
-    orientation = _orientation;
-    scale = _scale;
+    _position = position;
+    _orientation = orientation;
+    _scale = scale;
 }
 
 Referential::Referential(const Referential& other)
@@ -22,9 +24,14 @@ Referential::~Referential()
 {
     for (Referential* child : childrens)
     {
-        child->position = orientation.inverse() * child->position + position;
-        child->orientation = child->orientation * orientation;
+        child->_position = _orientation.inverse() * child->_position + _position;
+        child->_orientation = child->_orientation * _orientation;
         child->parent = parent;
+        if (parent != nullptr)
+        {
+            parent->childrens.push_back(child);
+        }
+        child->_invalidate();
     }
     if (parent != nullptr)
     {
@@ -43,16 +50,59 @@ Referential& Referential::operator=(const Referential& other)
     {
         coordinates = other.coordinates_in(*parent);
     }
-    std::tie(position, orientation, scale) = coordinates;
+    std::tie(_position, _orientation, _scale) = coordinates;
+    _invalidate();
     return *this;
 }
 
+const Vector& Referential::position() const
+{
+    return _position;
+}
+
+void Referential::set_position(const Vector& position)
+{
+    _position = position;
+    _invalidate();
+}
+
+const Quaternion& Referential::orientation() const
+{
+    return _orientation;
+}
+
+void Referential::set_orientation(const Quaternion& orientation)
+{
+    _orientation = orientation;
+    _invalidate();
+}
+
+double Referential::scale() const
+{
+    return _scale;
+}
+
+void Referential::set_scale(double scale)
+{
+    _scale = scale;
+    _invalidate();
+}
+
+void Referential::set_coordinates(const Vector& position, const Quaternion& orientation, double scale)
+{
+    _position = position;
+    _orientation = orientation;
+    _scale = scale;
+    _invalidate();
+}
+
 void Referential::detach()
 {
     if (parent != nullptr)
     {
         parent->childrens.remove(this);
         parent = nullptr;
+        _invalidate();
     }
 }
 
@@ -61,30 +111,166 @@ void Referential::attach(Referential& _parent)
     detach();
     parent = &_parent;
     _parent.childrens.push_back(this);
+    _invalidate();
 }
 
 std::tuple<Vector, Quaternion, double> Referential::absolute_coordinates() const
 {
-    Vector abs_position = position;
-    Quaternion abs_orientation = orientation;
-    double abs_scale = scale;
-    Referential* parent = this->parent;
-    while (parent != nullptr)
+    _update_cache();
+    return std::make_tuple(_absolute_position, _absolute_orientation, _absolute_scale);
+}
+
+std::tuple<Vector, Quaternion, double> Referential::coordinates_in(const Referential& other) const
+{
+    _update_cache();
+    other._update_cache();
+    const Quaternion& inverse_orientation = other._absolute_inverse_orientation;
+    return std::make_tuple(inverse_orientation * (_absolute_position - other._absolute_position) / other._absolute_scale,
+                           inverse_orientation * _absolute_orientation,
+                           _absolute_scale / other._absolute_scale);
+}
+
+Transform Referential::absolute_transform() const
+{
+    _update_cache();
+    return Transform(_absolute_position, _absolute_orientation, _absolute_scale);
+}
+
+Transform Referential::transform_in(const Referential& other) const
+{
+    _update_cache();
+    other._update_cache();
+    const Quaternion& inverse_orientation = other._absolute_inverse_orientation;
+    return Transform(inverse_orientation * (_absolute_position - other._absolute_position) / other._absolute_scale,
+                     inverse_orientation * _absolute_orientation,
+                     _absolute_scale / other._absolute_scale);
+}
+
+void Referential::bulk_coordinates_in(const Referential& other, const std::vector<const Referential*>& referentials, ReferentialsCoordinates& coordinates)
+{
+    // resize the arrays
+    coordinates.size = referentials.size();
+    std::size_t padded_size = FloatPack::padded_size(referentials.size());
+    for (std::vector<float>& array : coordinates.position)
+    {
+        array.resize(padded_size, 0.f);
+    }
+    for (std::vector<float>& array : coordinates.orientation)
+    {
+        array.resize(padded_size, 0.f);
+    }
+    for (std::vector<float>& array : coordinates.inverse_rotation)
     {
-        abs_position = (parent->orientation.inverse() * abs_position) * parent->scale + parent->position;
-        abs_orientation = parent->orientation * abs_orientation;
-        abs_scale = abs_scale * parent->scale;
-        parent = parent->parent;
+        array.resize(padded_size, 0.f);
+    }
+    coordinates.scale.resize(padded_size, 0.f);
+    // gather absolute coordinates. Positions are substracted in double precision to avoid precision loss far from origin.
+    other._update_cache();
+    for (std::size_t i=0; i<referentials.size(); i++)
+    {
+        const Referential* referential = referentials[i];
+        referential->_update_cache();
+        Vector relative_position = referential->_absolute_position - other._absolute_position;
+        coordinates.position[0][i] = static_cast<float>(relative_position.x);
+        coordinates.position[1][i] = static_cast<float>(relative_position.y);
+        coordinates.position[2][i] = static_cast<float>(relative_position.z);
+        coordinates.orientation[0][i] = static_cast<float>(referential->_absolute_orientation.w);
+        coordinates.orientation[1][i] = static_cast<float>(referential->_absolute_orientation.x);
+        coordinates.orientation[2][i] = static_cast<float>(referential->_absolute_orientation.y);
+        coordinates.orientation[3][i] = static_cast<float>(referential->_absolute_orientation.z);
+        coordinates.scale[i] = static_cast<float>(referential->_absolute_scale / other._absolute_scale);
+    }
+    // rotation matrix of 'other' inverse orientation, normalized so that it is a pure rotation like Quaternion::operator*(const Vector&)
+    const Quaternion& q = other._absolute_inverse_orientation;
+    Matrix rotation(q);
+    double factor = 1.0 / (Quaternion::dot(q, q) * other._absolute_scale);
+    FloatPack m[3][3];
+    for (unsigned int i=0; i<3; i++)
+    {
+        for (unsigned int j=0; j<3; j++)
+        {
+            m[i][j] = FloatPack(static_cast<float>(rotation.scalars[i][j] * factor));
+        }
+    }
+    const FloatPack cw(static_cast<float>(q.w)), cx(static_cast<float>(q.x)), cy(static_cast<float>(q.y)), cz(static_cast<float>(q.z));
+    const FloatPack two(2.f);
+    // vectorized pass
+    for (std::size_t i=0; i<padded_size; i+=FloatPack::size)
+    {
+        // position in 'other' referential
+        FloatPack x = FloatPack::load(&coordinates.position[0][i]);
+        FloatPack y = FloatPack::load(&coordinates.position[1][i]);
+        FloatPack z = FloatPack::load(&coordinates.position[2][i]);
+        (m[0][0]*x + m[0][1]*y + m[0][2]*z).store(&coordinates.position[0][i]);
+        (m[1][0]*x + m[1][1]*y + m[1][2]*z).store(&coordinates.position[1][i]);
+        (m[2][0]*x + m[2][1]*y + m[2][2]*z).store(&coordinates.position[2][i]);
+        // orientation in 'other' referential
+        FloatPack qw = FloatPack::load(&coordinates.orientation[0][i]);
+        FloatPack qx = FloatPack::load(&coordinates.orientation[1][i]);
+        FloatPack qy = FloatPack::load(&coordinates.orientation[2][i]);
+        FloatPack qz = FloatPack::load(&coordinates.orientation[3][i]);
+        FloatPack w = cw*qw - cx*qx - cy*qy - cz*qz;
+        x = cw*qx + cx*qw + cy*qz - cz*qy;
+        y = cw*qy - cx*qz + cy*qw + cz*qx;
+        z = cw*qz + cx*qy - cy*qx + cz*qw;
+        w.store(&coordinates.orientation[0][i]);
+        x.store(&coordinates.orientation[1][i]);
+        y.store(&coordinates.orientation[2][i]);
+        z.store(&coordinates.orientation[3][i]);
+        // rotation matrix of the inverse orientation, as Matrix(orientation.inverse()) would
+        FloatPack squared_norm = w*w + x*x + y*y + z*z;
+        FloatPack inverse_norm = FloatPack::select(FloatPack::less(FloatPack(0.f), squared_norm), FloatPack(1.f) / squared_norm, FloatPack(0.f));
+        FloatPack a = w*inverse_norm;
+        FloatPack b = -x*inverse_norm;
+        FloatPack c = -y*inverse_norm;
+        FloatPack d = -z*inverse_norm;
+        (a*a + b*b - c*c - d*d).store(&coordinates.inverse_rotation[0][i]);
+        (two*(b*c - a*d)).store(&coordinates.inverse_rotation[1][i]);
+        (two*(a*c + b*d)).store(&coordinates.inverse_rotation[2][i]);
+        (two*(a*d + b*c)).store(&coordinates.inverse_rotation[3][i]);
+        (a*a - b*b + c*c - d*d).store(&coordinates.inverse_rotation[4][i]);
+        (two*(c*d - a*b)).store(&coordinates.inverse_rotation[5][i]);
+        (two*(b*d - a*c)).store(&coordinates.inverse_rotation[6][i]);
+        (two*(a*b + c*d)).store(&coordinates.inverse_rotation[7][i]);
+        (a*a - b*b - c*c + d*d).store(&coordinates.inverse_rotation[8][i]);
     }
-    return std::make_tuple(abs_position, abs_orientation, abs_scale);
 }
 
-std::tuple<Vector, Quaternion, double> Referential::coordinates_in(const Referential& other) const
+void Referential::_invalidate() const
 {
-    std::tuple<Vector, Quaternion, double> this_coordinates = absolute_coordinates();
-    std::tuple<Vector, Quaternion, double> other_coordinates = other.absolute_coordinates();
-    Quaternion inverse_orientation = std::get<1>(other_coordinates).inverse();
-    return std::make_tuple(inverse_orientation * (std::get<0>(this_coordinates) - std::get<0>(other_coordinates)) / std::get<2>(other_coordinates),
-                           inverse_orientation * std::get<1>(this_coordinates),
-                           std::get<2>(this_coordinates) / std::get<2>(other_coordinates));
+    if (_dirty)
+    {
+        return;  // childrens of a dirty referential are already dirty
+    }
+    _dirty = true;
+    for (const Referential* child : childrens)
+    {
+        child->_invalidate();
+    }
+}
+
+void Referential::_update_cache() const
+{
+    // a clean referential has clean parents, as modifying a parent invalidates its childrens
+    if (!_dirty)
+    {
+        return;
+    }
+    if (parent == nullptr)
+    {
+        _absolute_position = _position;
+        _absolute_orientation = _orientation;
+        _absolute_scale = _scale;
+        _inverse_rotation_chain = _orientation.inverse();
+    }
+    else
+    {
+        parent->_update_cache();
+        _absolute_position = (parent->_inverse_rotation_chain * _position) * parent->_absolute_scale + parent->_absolute_position;
+        _absolute_orientation = parent->_absolute_orientation * _orientation;
+        _absolute_scale = _scale * parent->_absolute_scale;
+        _inverse_rotation_chain = parent->_inverse_rotation_chain * _orientation.inverse();
+    }
+    _absolute_inverse_orientation = _absolute_orientation.inverse();
+    _dirty = false;
 }
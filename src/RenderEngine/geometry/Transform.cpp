@@ -0,0 +1,162 @@
+#include <RenderEngine/geometry/Transform.hpp>
+using namespace RenderEngine;
+
+template<typename T>
+TransformT<T>::TransformT(const MatrixT<T>& matrix, const VectorT<T>& position)
+{
+    for (unsigned int i=0; i<3; i++)
+    {
+        for (unsigned int j=0; j<3; j++)
+        {
+            scalars[i][j] = matrix.scalars[i][j];
+        }
+    }
+    scalars[0][3] = position.x;
+    scalars[1][3] = position.y;
+    scalars[2][3] = position.z;
+}
+
+template<typename T>
+TransformT<T>::TransformT(const VectorT<T>& position, const QuaternionT<T>& orientation, T scale)
+{
+    // Matrix(q) is the rotation matrix of q multiplied by |q|²
+    MatrixT<T> rotation(orientation);
+    T factor = scale / orientation.squared_norm();
+    for (unsigned int i=0; i<3; i++)
+    {
+        for (unsigned int j=0; j<3; j++)
+        {
+            scalars[i][j] = rotation.scalars[i][j] * factor;
+        }
+    }
+    scalars[0][3] = position.x;
+    scalars[1][3] = position.y;
+    scalars[2][3] = position.z;
+}
+
+template<typename T>
+TransformT<T>::TransformT(const std::tuple<VectorT<T>, QuaternionT<T>, T>& coordinates) :
+    TransformT(std::get<0>(coordinates), std::get<1>(coordinates), std::get<2>(coordinates))
+{
+}
+
+template<typename T>
+MatrixT<T> TransformT<T>::matrix() const
+{
+    return MatrixT<T>({{{scalars[0][0], scalars[0][1], scalars[0][2]},
+                        {scalars[1][0], scalars[1][1], scalars[1][2]},
+                        {scalars[2][0], scalars[2][1], scalars[2][2]}}});
+}
+
+template<typename T>
+TransformT<T> TransformT<T>::inverse() const
+{
+    const std::array<std::array<T, 4>, 3>& m = scalars;
+    // inverse of the linear part with the cofactors
+    T c00 = m[1][1]*m[2][2] - m[1][2]*m[2][1];
+    T c01 = m[1][2]*m[2][0] - m[1][0]*m[2][2];
+    T c02 = m[1][0]*m[2][1] - m[1][1]*m[2][0];
+    T determinant = m[0][0]*c00 + m[0][1]*c01 + m[0][2]*c02;
+    T inverse_determinant = (determinant != 0) ? 1 / determinant : 0;
+    TransformT result;
+    std::array<std::array<T, 4>, 3>& r = result.scalars;
+    r[0][0] = c00 * inverse_determinant;
+    r[0][1] = (m[0][2]*m[2][1] - m[0][1]*m[2][2]) * inverse_determinant;
+    r[0][2] = (m[0][1]*m[1][2] - m[0][2]*m[1][1]) * inverse_determinant;
+    r[1][0] = c01 * inverse_determinant;
+    r[1][1] = (m[0][0]*m[2][2] - m[0][2]*m[2][0]) * inverse_determinant;
+    r[1][2] = (m[0][2]*m[1][0] - m[0][0]*m[1][2]) * inverse_determinant;
+    r[2][0] = c02 * inverse_determinant;
+    r[2][1] = (m[0][1]*m[2][0] - m[0][0]*m[2][1]) * inverse_determinant;
+    r[2][2] = (m[0][0]*m[1][1] - m[0][1]*m[1][0]) * inverse_determinant;
+    // inverse translation
+    for (unsigned int i=0; i<3; i++)
+    {
+        r[i][3] = -(r[i][0]*m[0][3] + r[i][1]*m[1][3] + r[i][2]*m[2][3]);
+    }
+    return result;
+}
+
+template<typename T>
+VectorT<T> TransformT<T>::apply_to_direction(const VectorT<T>& direction) const
+{
+    return VectorT<T>(scalars[0][0]*direction.x + scalars[0][1]*direction.y + scalars[0][2]*direction.z,
+                      scalars[1][0]*direction.x + scalars[1][1]*direction.y + scalars[1][2]*direction.z,
+                      scalars[2][0]*direction.x + scalars[2][1]*direction.y + scalars[2][2]*direction.z);
+}
+
+template<typename T>
+mat4 TransformT<T>::to_mat4() const
+{
+    return {static_cast<float>(scalars[0][0]),
+            static_cast<float>(scalars[1][0]),
+            static_cast<float>(scalars[2][0]),
+            0.f,
+            static_cast<float>(scalars[0][1]),
+            static_cast<float>(scalars[1][1]),
+            static_cast<float>(scalars[2][1]),
+            0.f,
+            static_cast<float>(scalars[0][2]),
+            static_cast<float>(scalars[1][2]),
+            static_cast<float>(scalars[2][2]),
+            0.f,
+            static_cast<float>(scalars[0][3]),
+            static_cast<float>(scalars[1][3]),
+            static_cast<float>(scalars[2][3]),
+            1.f};
+}
+
+template<typename T>
+TransformT<T> TransformT<T>::operator*(const TransformT& other) const
+{
+    TransformT result;
+    const std::array<std::array<T, 4>, 3>& b = other.scalars;
+    for (unsigned int i=0; i<3; i++)
+    {
+        const std::array<T, 4>& a = scalars[i];
+        result.scalars[i][0] = a[0]*b[0][0] + a[1]*b[1][0] + a[2]*b[2][0];
+        result.scalars[i][1] = a[0]*b[0][1] + a[1]*b[1][1] + a[2]*b[2][1];
+        result.scalars[i][2] = a[0]*b[0][2] + a[1]*b[1][2] + a[2]*b[2][2];
+        result.scalars[i][3] = a[0]*b[0][3] + a[1]*b[1][3] + a[2]*b[2][3] + a[3];
+    }
+    return result;
+}
+
+template<typename T>
+VectorT<T> TransformT<T>::operator*(const VectorT<T>& point) const
+{
+    return VectorT<T>(scalars[0][0]*point.x + scalars[0][1]*point.y + scalars[0][2]*point.z + scalars[0][3],
+                      scalars[1][0]*point.x + scalars[1][1]*point.y + scalars[1][2]*point.z + scalars[1][3],
+                      scalars[2][0]*point.x + scalars[2][1]*point.y + scalars[2][2]*point.z + scalars[2][3]);
+}
+
+namespace RenderEngine
+{
+    template<typename T>
+    std::ostream& operator<<(std::ostream& os, const TransformT<T>& transform)
+    {
+        for (unsigned int i=0; i<3; i++)
+        {
+            os << "\n{";
+            for (unsigned int j=0; j<4; j++)
+            {
+                os << transform.scalars[i][j];
+                if (j < 3)
+                {
+                    os << ",\t";
+                }
+                else
+                {
+                    os << "}";
+                }
+            }
+        }
+        os << "\n{0,\t0,\t0,\t1}" << std::endl;
+        return os;
+    }
+
+    template class TransformT<float>;
+    template class TransformT<double>;
+    template std::ostream& operator<<(std::ostream& os, const TransformT<float>& transform);
+    template std::ostream& operator<<(std::ostream& os, const TransformT<double>& transform);
+}
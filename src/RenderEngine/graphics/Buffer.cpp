@@ -1,22 +1,38 @@
 #include <RenderEngine/graphics/Buffer.hpp>
 #include <RenderEngine/utilities/Macro.hpp>
+#include <algorithm>
 using namespace RenderEngine;
 
 
-Buffer::Buffer(const GPU* _gpu, size_t bytes_size, VkBufferUsageFlags usage) : gpu(_gpu), _bytes_size(bytes_size)
+Buffer::Buffer(const GPU* _gpu, size_t bytes_size, VkBufferUsageFlags usage, Memory memory) : gpu(_gpu), _bytes_size(bytes_size), _memory(memory)
 {
-    _allocate_buffer(usage);
-    _allocate_memory(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (_memory == DEVICE_LOCAL)
+    {
+        _allocate_buffer(usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        _allocate_memory(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+    else
+    {
+        _allocate_buffer(usage);
+        _allocate_memory(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
 }
 
 Buffer::~Buffer()
 {
-    vkDeviceWaitIdle(gpu->_logical_device);
-    // delete memory
-    vkUnmapMemory(gpu->_logical_device, _vk_memory);
-    vkFreeMemory(gpu->_logical_device, _vk_memory, nullptr);
-    // delete buffer
+    // copies to this buffer might still be recorded in the staging ring
+    if (_data == nullptr)
+    {
+        gpu->_staging_ring->wait();
+    }
+    if (!_released)
+    {
+        std::lock_guard<std::mutex> lock(gpu->_queues_mutex);
+        vkDeviceWaitIdle(gpu->_logical_device);
+    }
+    // delete buffer, then its memory
     vkDestroyBuffer(gpu->_logical_device, _vk_buffer, nullptr);
+    gpu->_memory_allocator->free(_allocation);
 }
 
 size_t Buffer::bytes_size() const
@@ -24,32 +40,64 @@ size_t Buffer::bytes_size() const
     return _bytes_size;
 }
 
+Buffer::Memory Buffer::memory() const
+{
+    return _memory;
+}
+
 void Buffer::upload(const void* data, std::size_t bytes_size, std::size_t offset) const
 {
-    memcpy(reinterpret_cast<uint8_t*>(_data)+offset, data, bytes_size);
-    if (!(_memory_properties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    if (_data == nullptr)
     {
-        VkMappedMemoryRange  mem_range{};
-        mem_range.memory = _vk_memory;
-        mem_range.offset = offset;
-        mem_range.size = bytes_size;
-        vkFlushMappedMemoryRanges(gpu->_logical_device, 1, &mem_range);
+        gpu->_staging_ring->upload(*this, data, bytes_size, offset);
+        return;
     }
+    memcpy(reinterpret_cast<uint8_t*>(_data)+offset, data, bytes_size);
+    flush(bytes_size, offset);
 }
 
 void Buffer::download(void* data, std::size_t bytes_size, std::size_t offset) const
 {
+    if (_data == nullptr)
+    {
+        THROW_ERROR("Can not download data from a buffer that is not host visible");
+    }
     memcpy(data, reinterpret_cast<uint8_t*>(_data)+offset, bytes_size);
     if (!(_memory_properties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
     {
-        VkMappedMemoryRange  mem_range{};
-        mem_range.memory = _vk_memory;
-        mem_range.offset = offset;
+        VkMappedMemoryRange mem_range{};
+        mem_range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        mem_range.memory = _allocation.memory;
+        mem_range.offset = _allocation.offset + offset;
         mem_range.size = bytes_size;
+        _align_to_atoms(mem_range);
         vkInvalidateMappedMemoryRanges(gpu->_logical_device, 1, &mem_range);
     }
 }
 
+void* Buffer::mapped(std::size_t offset) const
+{
+    if (_data == nullptr)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<uint8_t*>(_data)+offset;
+}
+
+void Buffer::flush(std::size_t bytes_size, std::size_t offset) const
+{
+    if (!(_memory_properties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        VkMappedMemoryRange mem_range{};
+        mem_range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        mem_range.memory = _allocation.memory;
+        mem_range.offset = _allocation.offset + offset;
+        mem_range.size = bytes_size;
+        _align_to_atoms(mem_range);
+        vkFlushMappedMemoryRanges(gpu->_logical_device, 1, &mem_range);
+    }
+}
+
 void Buffer::_allocate_buffer(VkBufferUsageFlags usage)
 {
     VkBufferCreateInfo bufferInfo{};
@@ -57,6 +105,19 @@ void Buffer::_allocate_buffer(VkBufferUsageFlags usage)
     bufferInfo.size = _bytes_size;
     bufferInfo.usage = usage;
     bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    // buffers written by the transfer queue are shared with the graphics queue, if they are from different families
+    uint32_t families[2] = {0, 0};
+    if (gpu->_graphics_queue.has_value() && gpu->_transfer_queue.has_value())
+    {
+        families[0] = std::get<0>(gpu->_graphics_queue.value());
+        families[1] = std::get<0>(gpu->_transfer_queue.value());
+    }
+    if ((usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT) && (families[0] != families[1]))
+    {
+        bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        bufferInfo.queueFamilyIndexCount = 2;
+        bufferInfo.pQueueFamilyIndices = families;
+    }
     if (vkCreateBuffer(gpu->_logical_device, &bufferInfo, nullptr, &_vk_buffer) != VK_SUCCESS)
     {
         THROW_ERROR("failed to create vertex buffer!");
@@ -67,36 +128,18 @@ void Buffer::_allocate_memory(VkMemoryPropertyFlags memory_properties)
 {
     VkMemoryRequirements memRequirements;
     vkGetBufferMemoryRequirements(gpu->_logical_device, _vk_buffer, &memRequirements);
-    // finding memory type
-    uint32_t memoryTypeIndex = std::numeric_limits<uint32_t>::max();
-    VkPhysicalDeviceMemoryProperties mem_properties;
-    vkGetPhysicalDeviceMemoryProperties(gpu->_physical_device, &mem_properties);
-    for (uint32_t i = 0; i < mem_properties.memoryTypeCount; i++)
-    {
-        if ((memRequirements.memoryTypeBits & (1 << i))
-            &&
-            ((mem_properties.memoryTypes[i].propertyFlags & memory_properties) == memory_properties))
-        {
-            memoryTypeIndex = i;
-            _memory_properties = mem_properties.memoryTypes[i].propertyFlags;
-            break;
-        }
-    }
-    if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
-    {
-        THROW_ERROR("Failed to find suitable memory type.");
-    }
-    // allocate memory
-    std::size_t required_memory_bytes = ((memRequirements.size / memRequirements.alignment) + (memRequirements.size % memRequirements.alignment == 0 ? 0 : 1)) * memRequirements.alignment;
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = required_memory_bytes;
-    allocInfo.memoryTypeIndex = memoryTypeIndex;
-    if (vkAllocateMemory(gpu->_logical_device, &allocInfo, nullptr, &_vk_memory) != VK_SUCCESS)
-    {
-        THROW_ERROR("failed to allocate buffer memory!");
-    }
-    // bind and map
-    vkBindBufferMemory(gpu->_logical_device, _vk_buffer, _vk_memory, 0);
-    vkMapMemory(gpu->_logical_device, _vk_memory, 0, _bytes_size, 0, reinterpret_cast<void**>(&_data));
-}
\ No newline at end of file
+    _allocation = gpu->_memory_allocator->allocate(memRequirements, memory_properties, true);
+    _memory_properties = _allocation.properties;
+    // bind, the memory of host visible types being persistently mapped by the allocator
+    vkBindBufferMemory(gpu->_logical_device, _vk_buffer, _allocation.memory, _allocation.offset);
+    _data = _allocation.mapped;
+}
+
+void Buffer::_align_to_atoms(VkMappedMemoryRange& range) const
+{
+    // the allocator aligns allocations of non coherent memory to the atom size, so the aligned range stays in the buffer's allocation
+    VkDeviceSize atom_size = std::max<VkDeviceSize>(gpu->_device_properties.limits.nonCoherentAtomSize, 1);
+    VkDeviceSize end = std::min(((range.offset + range.size + atom_size - 1) / atom_size) * atom_size, static_cast<VkDeviceSize>(_allocation.offset + _allocation.size));
+    range.offset = (range.offset / atom_size) * atom_size;
+    range.size = end - range.offset;
+}
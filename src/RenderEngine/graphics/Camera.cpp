@@ -1,4 +1,5 @@
 #include <RenderEngine/graphics/Camera.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
 #include <cmath>  // for tan
 using namespace RenderEngine;
 
@@ -18,6 +19,41 @@ Camera::~Camera()
 {
 }
 
+std::tuple<Vector, Vector, double> Camera::ray(double x, double y, uint32_t width, uint32_t height) const
+{
+    // normalized device coordinates of the pixel's center, inverted through the projections of Shader3D.vert
+    double x_ndc = 2.0 * (x + 0.5) / width - 1.0;
+    double y_ndc = 2.0 * (y + 0.5) / height - 1.0;
+    double half_width = 0.5 * aperture_width;
+    double half_height = 0.5 * aperture_width * height / width;
+    Vector origin;
+    Vector direction(0., 0., 1.);
+    double distance = max_distance;
+    if (projection_type == ProjectionType::PERSPECTIVE)
+    {
+        // rays go from the focal point, 'focal_length' behind the camera, through the projection plane
+        origin = Vector(x_ndc * half_width, y_ndc * half_height, 0.);
+        direction = Vector(origin.x, origin.y, focal_length);
+        distance = (max_distance - focal_length) / focal_length;
+    }
+    else if (projection_type == ProjectionType::ORTHOGRAPHIC)
+    {
+        origin = Vector(x_ndc * half_width, y_ndc * half_height, 0.);
+    }
+    else if (projection_type == ProjectionType::EQUIRECTANGULAR)
+    {
+        double theta = (x_ndc + 1.0) * PI / 2.0;
+        double phi = y_ndc * PI;
+        direction = Vector(std::sin(theta) * std::sin(phi), std::cos(theta), std::sin(theta) * std::cos(phi));
+    }
+    else
+    {
+        distance = 0.;
+    }
+    Transform to_absolute = absolute_transform();
+    return std::make_tuple(to_absolute * origin, to_absolute.apply_to_direction(direction), distance);
+}
+
 PerspectiveCamera::PerspectiveCamera(float horizontal_field_of_view, float sensitivity, float focal_length, float max_distance,
                                      Vector position, Quaternion orientation, double scale, Referential* parent) :
     Camera(sensitivity,
@@ -1,10 +1,35 @@
 #include <RenderEngine/render_engine.hpp>
 #include <RenderEngine/graphics/Canvas.hpp>
 #include <RenderEngine/graphics/model/Mesh.hpp>
+#include <RenderEngine/graphics/Frustum.hpp>
+#include <RenderEngine/graphics/Buffer.hpp>
 #include <RenderEngine/graphics/shaders/Types.hpp>
 #include <RenderEngine/utilities/Macro.hpp>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 using namespace RenderEngine;
 
+namespace
+{
+    const mat4 IDENTITY = {1.f, 0.f, 0.f, 0.f,
+                           0.f, 1.f, 0.f, 0.f,
+                           0.f, 0.f, 1.f, 0.f,
+                           0.f, 0.f, 0.f, 1.f};
+
+    // Mesh to camera matrix of the coordinates at 'index' in the result of Referential::bulk_coordinates_in
+    mat4 bulk_mesh_to_camera(const ReferentialsCoordinates& coordinates_in_camera, std::size_t index)
+    {
+        // the rotation is the transposed of the inverse rotation
+        const std::array<std::vector<float>, 9>& m = coordinates_in_camera.inverse_rotation;
+        const float s = coordinates_in_camera.scale[index];
+        return mat4({m[0][index]*s, m[1][index]*s, m[2][index]*s, 0.f,
+                     m[3][index]*s, m[4][index]*s, m[5][index]*s, 0.f,
+                     m[6][index]*s, m[7][index]*s, m[8][index]*s, 0.f,
+                     coordinates_in_camera.position[0][index], coordinates_in_camera.position[1][index], coordinates_in_camera.position[2][index], 1.f});
+    }
+}
+
 
 Canvas::Canvas(const GPU* _gpu, uint32_t _width, uint32_t _height, bool mip_maped, AntiAliasing sample_count) :
     gpu(_gpu),
@@ -22,12 +47,14 @@ Canvas::Canvas(const GPU* _gpu, uint32_t _width, uint32_t _height, bool mip_mape
     _allocate_command_buffer(_vk_command_buffer, std::get<2>(gpu->_graphics_queue.value()));
     _allocate_fence(_vk_fence);
     _allocate_semaphore(_vk_rendered_semaphore);
+    _instances = std::make_shared<Buffer>(gpu, INSTANCES_CAPACITY * sizeof(mat4), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, Buffer::HOST_VISIBLE);
+    _instances->upload(&IDENTITY, sizeof(mat4), 0);
 }
 
 
 Canvas::Canvas(const GPU* _gpu, const VkImage& vk_image, uint32_t _width, uint32_t _height, AntiAliasing sample_count) :
     gpu(_gpu),
-    images({{"color", new Image(_gpu, vk_image, nullptr, ImageFormat::RGBA, _width, _height, false)},
+    images({{"color", new Image(_gpu, vk_image, ImageFormat::RGBA, _width, _height, false)},
             {"albedo", new Image(_gpu, ImageFormat::RGBA, _width, _height, false)},
             {"normal", new Image(_gpu, ImageFormat::NORMAL, _width, _height, false)},
             {"material", new Image(_gpu, ImageFormat::MATERIAL, _width, _height, false)},
@@ -41,12 +68,19 @@ Canvas::Canvas(const GPU* _gpu, const VkImage& vk_image, uint32_t _width, uint32
     _allocate_command_buffer(_vk_command_buffer, std::get<2>(gpu->_graphics_queue.value()));
     _allocate_fence(_vk_fence);
     _allocate_semaphore(_vk_rendered_semaphore);
+    _instances = std::make_shared<Buffer>(gpu, INSTANCES_CAPACITY * sizeof(mat4), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, Buffer::HOST_VISIBLE);
+    _instances->upload(&IDENTITY, sizeof(mat4), 0);
 }
 
 
 Canvas::~Canvas()
 {
-    vkDeviceWaitIdle(gpu->_logical_device);
+    {
+        std::lock_guard<std::mutex> lock(gpu->_queues_mutex);
+        vkDeviceWaitIdle(gpu->_logical_device);
+    }
+    _release_regions();
+    _release_retired_instances();
     vkDestroySemaphore(gpu->_logical_device, _vk_rendered_semaphore, nullptr);
     vkDestroyFence(gpu->_logical_device, _vk_fence, nullptr);
     vkFreeCommandBuffers(gpu->_logical_device, std::get<2>(gpu->_graphics_queue.value()), 1, &_vk_command_buffer);
@@ -111,10 +145,141 @@ void Canvas::clear(Color _color)
 
 
 void Canvas::draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const std::tuple<Vector, Quaternion, double>& mesh_coordinates_in_camera, bool cull_back_faces)
+{
+    draw(camera, mesh, Transform(mesh_coordinates_in_camera), cull_back_faces);
+}
+
+
+void Canvas::draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const Transform& mesh_to_camera, bool cull_back_faces)
+{
+    DrawParameters params = {mesh_to_camera.to_mat4(),
+                             vec4({camera.aperture_width, (camera.aperture_width*height)/width, camera.focal_length, camera.max_distance}),
+                             static_cast<uint32_t>(camera.projection_type)};
+    _draw_mesh(camera, mesh, params, cull_back_faces, _pixels_per_unit(*mesh, params));
+}
+
+
+void Canvas::draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const ReferentialsCoordinates& coordinates_in_camera, std::size_t index, bool cull_back_faces)
+{
+    DrawParameters params = {bulk_mesh_to_camera(coordinates_in_camera, index),
+                             vec4({camera.aperture_width, (camera.aperture_width*height)/width, camera.focal_length, camera.max_distance}),
+                             static_cast<uint32_t>(camera.projection_type)};
+    _draw_mesh(camera, mesh, params, cull_back_faces, _pixels_per_unit(*mesh, params));
+}
+
+
+void Canvas::draw_instances(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const Transform* instances_to_camera, std::size_t count, bool cull_back_faces)
+{
+    std::vector<mat4> matrices(count);
+    for (std::size_t i=0; i<count; i++)
+    {
+        matrices[i] = instances_to_camera[i].to_mat4();
+    }
+    _draw_instances(camera, mesh, matrices, cull_back_faces);
+}
+
+
+void Canvas::draw_instances(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const ReferentialsCoordinates& coordinates_in_camera, bool cull_back_faces)
+{
+    std::vector<mat4> matrices(coordinates_in_camera.size);
+    for (std::size_t i=0; i<coordinates_in_camera.size; i++)
+    {
+        matrices[i] = bulk_mesh_to_camera(coordinates_in_camera, i);
+    }
+    _draw_instances(camera, mesh, matrices, cull_back_faces);
+}
+
+
+void Canvas::_draw_instances(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const std::vector<mat4>& instances_to_camera, bool cull_back_faces)
+{
+    DrawParameters params = {IDENTITY,
+                             vec4({camera.aperture_width, (camera.aperture_width*height)/width, camera.focal_length, camera.max_distance}),
+                             static_cast<uint32_t>(camera.projection_type)};
+    // the bounding spheres of the instances in camera coordinates are tested against the frustum in bulk
+    const BoundingSphere& sphere = mesh->bounding_sphere();
+    if (sphere.radius < 0.)
+    {
+        return;
+    }
+    std::size_t count = instances_to_camera.size();
+    std::vector<float> x(count), y(count), z(count), radius(count);
+    const Vector& c = sphere.center;
+    for (std::size_t i=0; i<count; i++)
+    {
+        const mat4& m = instances_to_camera[i];
+        float scale = std::sqrt(std::max({m.i1j1*m.i1j1 + m.i1j2*m.i1j2 + m.i1j3*m.i1j3,
+                                          m.i2j1*m.i2j1 + m.i2j2*m.i2j2 + m.i2j3*m.i2j3,
+                                          m.i3j1*m.i3j1 + m.i3j2*m.i3j2 + m.i3j3*m.i3j3}));
+        x[i] = m.i1j1*c.x + m.i2j1*c.y + m.i3j1*c.z + m.i4j1;
+        y[i] = m.i1j2*c.x + m.i2j2*c.y + m.i3j2*c.z + m.i4j2;
+        z[i] = m.i1j3*c.x + m.i2j3*c.y + m.i3j3*c.z + m.i4j3;
+        radius[i] = static_cast<float>(sphere.radius) * scale;
+    }
+    std::vector<std::size_t> visible = Frustum(camera, static_cast<double>(height)/width).bulk_intersects(x.data(), y.data(), z.data(), radius.data(), count);
+    if (visible.size() == 0)
+    {
+        return;
+    }
+    else if (visible.size() == 1)
+    {
+        // a single instance is a single draw, with its meshlets culled
+        params.mesh_to_camera = instances_to_camera[visible.front()];
+        _draw_mesh(camera, mesh, params, cull_back_faces, _pixels_per_unit(*mesh, params));
+        return;
+    }
+    // the visible transforms are written in the instance buffer, and the level of detail is chosen for the closest instance
+    std::size_t offset = _reserve_instances(visible.size());
+    mat4* transforms = static_cast<mat4*>(_instances->mapped(offset));
+    float pixels_per_unit = 0.f;
+    for (std::size_t i=0; i<visible.size(); i++)
+    {
+        transforms[i] = instances_to_camera[visible[i]];
+        if (mesh->_levels_of_detail.size() > 0)
+        {
+            DrawParameters instance_params = params;
+            instance_params.mesh_to_camera = transforms[i];
+            pixels_per_unit = std::max(pixels_per_unit, _pixels_per_unit(*mesh, instance_params));
+        }
+    }
+    _instances->flush(visible.size() * sizeof(mat4), offset);
+    _draw_mesh(camera, mesh, params, cull_back_faces, pixels_per_unit, offset, static_cast<uint32_t>(visible.size()));
+}
+
+
+std::size_t Canvas::_reserve_instances(std::size_t count)
+{
+    std::size_t alignment = gpu->storage_buffer_alignment();
+    std::size_t offset = ((_instances_bytes + alignment - 1) / alignment) * alignment;
+    if (offset + count * sizeof(mat4) > _instances->bytes_size())
+    {
+        // the draws recorded in this frame may still read the full buffer: it is released once the canvas fence signals
+        std::size_t first = ((sizeof(mat4) + alignment - 1) / alignment) * alignment;
+        _retired_instances.push_back(_instances);
+        _instances = std::make_shared<Buffer>(gpu, std::max(2 * _instances->bytes_size(), first + count * sizeof(mat4)), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, Buffer::HOST_VISIBLE);
+        _instances->upload(&IDENTITY, sizeof(mat4), 0);
+        offset = first;
+    }
+    _instances_bytes = offset + count * sizeof(mat4);
+    return offset;
+}
+
+
+void Canvas::_draw_mesh(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const DrawParameters& params, bool cull_back_faces,
+                        float pixels_per_unit, std::size_t instances_offset, uint32_t instances_count)
 {
     _record_commands();
     Shader* shader = gpu->_shaders.at("3D");
     _bind_shader(shader, images);
+    // bind the pipeline variant reading the mesh's vertex format
+    VkPipeline pipeline = (mesh->_vertex_format == Mesh::COMPACT) ? shader->_vk_compact_pipeline : shader->_vk_pipeline;
+    if (pipeline != _current_pipeline)
+    {
+        vkCmdBindPipeline(_vk_command_buffer, shader->_vk_pipeline_bind_point, pipeline);
+        _current_pipeline = pipeline;
+    }
+    // bind the mesh's palette, and the transforms of the instances (the identity for single draws)
+    _bind_descriptor_set(shader, 0, images, {{"palette", {mesh->_palette_buffer->_vk_buffer, mesh->_palette_offset, mesh->_palette_capacity * sizeof(PaletteEntry)}},
+                                             {"instances", {_instances->_vk_buffer, instances_offset, instances_count * sizeof(mat4)}}});
     // set culling mode
     if (gpu->dynamic_culling_supported())
     {
@@ -123,17 +288,87 @@ void Canvas::draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const
     // set mesh vertices
     std::vector<VkBuffer> vertex_buffers = {mesh->_buffer->_vk_buffer};
     std::vector<VkDeviceSize> offsets(vertex_buffers.size(), mesh->_offset);
+    if (mesh->_regions != nullptr)
+    {
+        // the drawn region of a dynamic mesh must not be uploaded until the rendering is complete
+        std::vector<Canvas*>& readers = (*mesh->_regions)[mesh->_region].readers;
+        if (std::find(readers.begin(), readers.end(), this) == readers.end())
+        {
+            readers.push_back(this);
+            _dynamic_regions.emplace_back(mesh->_regions, mesh->_region);
+        }
+    }
     vkCmdBindVertexBuffers(_vk_command_buffer, 0, vertex_buffers.size(), vertex_buffers.data(), offsets.data());
     // set shader parameters
     VkPushConstantRange mesh_range = shader->_push_constants.at("params");
-    DrawParameters params = {std::get<0>(mesh_coordinates_in_camera).to_vec4(),
-                             Matrix(std::get<1>(mesh_coordinates_in_camera).inverse()).to_mat3(),
-                             vec4({camera.aperture_width, (camera.aperture_width*height)/width, camera.focal_length, camera.max_distance}),
-                             static_cast<uint32_t>(camera.projection_type),
-                             static_cast<float>(std::get<2>(mesh_coordinates_in_camera))};
-    vkCmdPushConstants(_vk_command_buffer, shader->_vk_pipeline_layout, mesh_range.stageFlags, mesh_range.offset, mesh_range.size, &params);
-    // send a command to command buffer
-    vkCmdDraw(_vk_command_buffer, mesh->bytes_size()/sizeof(Vertex), 1, 0, 0);
+    if (mesh->_vertex_format == Mesh::COMPACT)
+    {
+        // compact positions are read in [0, 1]: the dequantization 'offset + scale * position' is composed into the mesh to camera matrix
+        DrawParameters compact_params = params;
+        mat4& m = compact_params.mesh_to_camera;
+        const vec3& o = mesh->_position_offset;
+        const float s = mesh->_position_scale;
+        m.i4j1 += m.i1j1*o.x + m.i2j1*o.y + m.i3j1*o.z;
+        m.i4j2 += m.i1j2*o.x + m.i2j2*o.y + m.i3j2*o.z;
+        m.i4j3 += m.i1j3*o.x + m.i2j3*o.y + m.i3j3*o.z;
+        m.i1j1 *= s; m.i1j2 *= s; m.i1j3 *= s;
+        m.i2j1 *= s; m.i2j2 *= s; m.i2j3 *= s;
+        m.i3j1 *= s; m.i3j2 *= s; m.i3j3 *= s;
+        vkCmdPushConstants(_vk_command_buffer, shader->_vk_pipeline_layout, mesh_range.stageFlags, mesh_range.offset, mesh_range.size, &compact_params);
+    }
+    else
+    {
+        vkCmdPushConstants(_vk_command_buffer, shader->_vk_pipeline_layout, mesh_range.stageFlags, mesh_range.offset, mesh_range.size, &params);
+    }
+    // send a command to command buffer, drawing the coarsest level of detail whose error is smaller than a pixel, or else the visible meshlets of the full mesh
+    // (for single draws only, as instances see the meshlets from different points of view). Indices are stored right after the vertices.
+    const Mesh::LevelOfDetail* level = nullptr;
+    if (mesh->_levels_of_detail.size() > 0)
+    {
+        level = mesh->level_of_detail(LEVEL_OF_DETAIL_PIXEL_ERROR / pixels_per_unit);
+    }
+    if (level != nullptr)
+    {
+        vkCmdBindIndexBuffer(_vk_command_buffer, mesh->_buffer->_vk_buffer, mesh->_offset + mesh->_vertices_count * mesh->vertex_size(), VK_INDEX_TYPE_UINT32);
+        vkCmdDrawIndexed(_vk_command_buffer, level->indices_count, instances_count, level->first_index, 0, 0);
+    }
+    else if (mesh->_meshlets.size() > 0 && instances_count == 1)
+    {
+        // only the meshlets that may be visible are drawn, the consecutive ones being merged into a single draw
+        std::vector<std::size_t> visible = Meshlets::visible(mesh->_meshlets, Frustum(camera, static_cast<double>(height)/width), params, cull_back_faces);
+        if (mesh->_indices_count > 0)
+        {
+            vkCmdBindIndexBuffer(_vk_command_buffer, mesh->_buffer->_vk_buffer, mesh->_offset + mesh->_vertices_count * mesh->vertex_size(), VK_INDEX_TYPE_UINT32);
+        }
+        for (std::size_t i=0; i<visible.size();)
+        {
+            const Meshlet& first = mesh->_meshlets[visible[i]];
+            uint32_t count = 0;
+            std::size_t j = i;
+            for (; j<visible.size() && visible[j] == visible[i] + (j - i); j++)
+            {
+                count += 3 * mesh->_meshlets[visible[j]].triangles_count;
+            }
+            if (mesh->_indices_count > 0)
+            {
+                vkCmdDrawIndexed(_vk_command_buffer, count, 1, first.first_index, 0, 0);
+            }
+            else
+            {
+                vkCmdDraw(_vk_command_buffer, count, 1, first.first_index, 0);
+            }
+            i = j;
+        }
+    }
+    else if (mesh->_indices_count > 0)
+    {
+        vkCmdBindIndexBuffer(_vk_command_buffer, mesh->_buffer->_vk_buffer, mesh->_offset + mesh->_vertices_count * mesh->vertex_size(), VK_INDEX_TYPE_UINT32);
+        vkCmdDrawIndexed(_vk_command_buffer, mesh->_indices_count, instances_count, 0, 0, 0);
+    }
+    else
+    {
+        vkCmdDraw(_vk_command_buffer, mesh->_vertices_count, instances_count, 0, 0);
+    }
     // register layout transitions
     for (std::pair<std::string, VkImageLayout> layout : shader->_final_layouts)
     {
@@ -141,6 +376,51 @@ void Canvas::draw(const Camera& camera, const std::shared_ptr<Mesh>& mesh, const
     }
 }
 
+float Canvas::_pixels_per_unit(const Mesh& mesh, const DrawParameters& params) const
+{
+    const mat4& m = params.mesh_to_camera;
+    const BoundingSphere& sphere = mesh.bounding_sphere();
+    if (sphere.radius < 0.)
+    {
+        return std::numeric_limits<float>::infinity();
+    }
+    // largest scale of the mesh axes, and bounding sphere in camera coordinates
+    float scale = std::sqrt(std::max({m.i1j1*m.i1j1 + m.i1j2*m.i1j2 + m.i1j3*m.i1j3,
+                                      m.i2j1*m.i2j1 + m.i2j2*m.i2j2 + m.i2j3*m.i2j3,
+                                      m.i3j1*m.i3j1 + m.i3j2*m.i3j2 + m.i3j3*m.i3j3}));
+    const Vector& c = sphere.center;
+    float x = m.i1j1*c.x + m.i2j1*c.y + m.i3j1*c.z + m.i4j1;
+    float y = m.i1j2*c.x + m.i2j2*c.y + m.i3j2*c.z + m.i4j2;
+    float z = m.i1j3*c.x + m.i2j3*c.y + m.i3j3*c.z + m.i4j3;
+    float radius = static_cast<float>(sphere.radius) * scale;
+    const float aperture_width = params.camera_parameters.r;
+    const float focal_length = params.camera_parameters.b;
+    // a length at the point of the sphere closest to the camera is projected on the aperture, that spans the width of the canvas
+    if (params.projection_type == ProjectionType::PERSPECTIVE)
+    {
+        float depth = z - radius;
+        if (depth <= 0.f)
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+        return scale * width * focal_length / ((depth + focal_length) * aperture_width);
+    }
+    else if (params.projection_type == ProjectionType::ORTHOGRAPHIC)
+    {
+        return scale * width / aperture_width;
+    }
+    else if (params.projection_type == ProjectionType::EQUIRECTANGULAR)
+    {
+        float distance = std::sqrt(x*x + y*y + z*z) - radius;
+        if (distance <= 0.f)
+        {
+            return std::numeric_limits<float>::infinity();
+        }
+        return scale * width / (2.f * static_cast<float>(PI) * distance);
+    }
+    return std::numeric_limits<float>::infinity();
+}
+
 
 void Canvas::light(const Camera& camera, const Light& light, const std::tuple<Vector, Quaternion, double>& light_coordinates_in_camera, Canvas* shadow_map)
 {
@@ -217,9 +497,19 @@ void Canvas::render()
         wait_semaphores.push_back(semaphore);
         wait_stages.push_back(VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
     }
+    // the uploads to device local buffers must be completed before they are read
+    wait_semaphores.push_back(gpu->_staging_ring->_vk_semaphore);
+    wait_stages.push_back(VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    std::vector<uint64_t> wait_values(wait_semaphores.size(), 0); // ignored for binary semaphores
+    wait_values.back() = gpu->_staging_ring->submit();
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.waitSemaphoreValueCount = wait_values.size();
+    timelineInfo.pWaitSemaphoreValues = wait_values.data();
     // submit graphic commands
     VkSubmitInfo submitInfo{};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = &timelineInfo;
     submitInfo.waitSemaphoreCount = wait_semaphores.size();
     submitInfo.pWaitSemaphores = wait_semaphores.data();
     submitInfo.pWaitDstStageMask = wait_stages.data();
@@ -227,9 +517,12 @@ void Canvas::render()
     submitInfo.pCommandBuffers = &_vk_command_buffer;
     submitInfo.signalSemaphoreCount = 1;
     submitInfo.pSignalSemaphores = &_vk_rendered_semaphore;
-    if (vkQueueSubmit(std::get<1>(gpu->_graphics_queue.value()), 1, &submitInfo, _vk_fence) != VK_SUCCESS)
     {
-        THROW_ERROR("failed to submit draw command buffer!");
+        std::lock_guard<std::mutex> lock(gpu->_queues_mutex);
+        if (vkQueueSubmit(std::get<1>(gpu->_graphics_queue.value()), 1, &submitInfo, _vk_fence) != VK_SUCCESS)
+        {
+            THROW_ERROR("failed to submit draw command buffer!");
+        }
     }
     // set the rendering flag
     _recording = false;
@@ -313,6 +606,33 @@ void Canvas::wait_completion()
         vkResetFences(gpu->_logical_device, 1, &_vk_fence);
         _rendering = false;
     }
+    if (!_recording)
+    {
+        _release_regions();
+        _release_retired_instances();
+    }
+}
+
+
+void Canvas::_release_regions()
+{
+    for (const std::pair<std::shared_ptr<std::vector<DynamicRegion>>, std::size_t>& region : _dynamic_regions)
+    {
+        std::vector<Canvas*>& readers = (*region.first)[region.second].readers;
+        readers.erase(std::remove(readers.begin(), readers.end(), this), readers.end());
+    }
+    _dynamic_regions.clear();
+}
+
+
+void Canvas::_release_retired_instances()
+{
+    // the canvas fence has signalled: the buffers can be destroyed without waiting for the whole device
+    for (const std::shared_ptr<Buffer>& buffer : _retired_instances)
+    {
+        buffer->_released = true;
+    }
+    _retired_instances.clear();
 }
 
 
@@ -356,6 +676,7 @@ void Canvas::_record_commands()
         scissor.offset = {0, 0};
         scissor.extent = {width, height};
         vkCmdSetScissor(_vk_command_buffer, 0, 1, &scissor);
+        _instances_bytes = sizeof(mat4);
         // setup the recording flag
         _recording = true;
     }
@@ -415,6 +736,7 @@ void Canvas::_bind_shader(const Shader* shader, const std::map<const std::string
     {
         // bind new shader pipeline
         vkCmdBindPipeline(_vk_command_buffer, shader->_vk_pipeline_bind_point, shader->_vk_pipeline);
+        _current_pipeline = shader->_vk_pipeline;
         if (shader->_vk_render_pass != VK_NULL_HANDLE)
         {
             // clear values are used only for attachments with loadOp VK_ATTACHMENT_LOAD_OP_CLEAR
@@ -439,13 +761,17 @@ void Canvas::_bind_shader(const Shader* shader, const std::map<const std::string
     }
     // set new shader pointer
     _current_shader = shader;
+    if (shader == nullptr)
+    {
+        _current_pipeline = VK_NULL_HANDLE;
+    }
 }
 
 
 void Canvas::_bind_descriptor_set(const Shader* shader,
     unsigned int descriptor_set_index,
     const std::map<const std::string, Image*>& images_pool,
-    const std::map<const std::string, Buffer*>& buffers_pool)
+    const std::map<const std::string, VkDescriptorBufferInfo>& buffers_pool)
 {
     std::vector<VkWriteDescriptorSet> descriptors;
     std::deque<VkDescriptorBufferInfo> buffers;
@@ -466,10 +792,9 @@ void Canvas::_bind_descriptor_set(const Shader* shader,
             samplers.push_back({image->_vk_sampler, image->_vk_image_view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL});
             descriptor_set_binding.pImageInfo = &samplers.back();
         }
-        else if (descriptor.second.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+        else if (descriptor.second.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || descriptor.second.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
         {
-            Buffer* buffer = buffers_pool.at(descriptor.first);
-            buffers.push_back({buffer->_vk_buffer, 0, VK_WHOLE_SIZE});
+            buffers.push_back(buffers_pool.at(descriptor.first));
             descriptor_set_binding.pBufferInfo = &buffers.back();
         }
         else
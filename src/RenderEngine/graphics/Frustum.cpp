@@ -0,0 +1,193 @@
+#include <RenderEngine/graphics/Frustum.hpp>
+#include <RenderEngine/utilities/SIMD.hpp>
+#include <cmath>
+using namespace RenderEngine;
+
+Frustum::Frustum(const Camera& camera, double aspect_ratio)
+{
+    // The planes are deduced from the projections of Shader3D.vert, with the camera looking toward +z
+    double half_width = 0.5 * camera.aperture_width;
+    double half_height = 0.5 * camera.aperture_width * aspect_ratio;
+    double f = camera.focal_length;
+    double D = camera.max_distance;
+    if (camera.projection_type == ProjectionType::PERSPECTIVE)
+    {
+        // |x| <= (z+f)*half_width/f, |y| <= (z+f)*half_height/f and 0 <= z <= D-f
+        double kx = half_width / f;
+        double ky = half_height / f;
+        double nx = std::sqrt(1. + kx*kx);
+        double ny = std::sqrt(1. + ky*ky);
+        _planes.push_back({static_cast<float>(-1./nx), 0.f, static_cast<float>(kx/nx), static_cast<float>(kx*f/nx)});
+        _planes.push_back({static_cast<float>(1./nx), 0.f, static_cast<float>(kx/nx), static_cast<float>(kx*f/nx)});
+        _planes.push_back({0.f, static_cast<float>(-1./ny), static_cast<float>(ky/ny), static_cast<float>(ky*f/ny)});
+        _planes.push_back({0.f, static_cast<float>(1./ny), static_cast<float>(ky/ny), static_cast<float>(ky*f/ny)});
+        _planes.push_back({0.f, 0.f, 1.f, 0.f});
+        _planes.push_back({0.f, 0.f, -1.f, static_cast<float>(D - f)});
+    }
+    else if (camera.projection_type == ProjectionType::ORTHOGRAPHIC)
+    {
+        // |x| <= half_width, |y| <= half_height and 0 <= z <= D
+        _planes.push_back({-1.f, 0.f, 0.f, static_cast<float>(half_width)});
+        _planes.push_back({1.f, 0.f, 0.f, static_cast<float>(half_width)});
+        _planes.push_back({0.f, -1.f, 0.f, static_cast<float>(half_height)});
+        _planes.push_back({0.f, 1.f, 0.f, static_cast<float>(half_height)});
+        _planes.push_back({0.f, 0.f, 1.f, 0.f});
+        _planes.push_back({0.f, 0.f, -1.f, static_cast<float>(D)});
+    }
+    else if (camera.projection_type == ProjectionType::EQUIRECTANGULAR)
+    {
+        _spherical = true;
+        _radius = camera.max_distance;
+    }
+}
+
+Frustum::~Frustum()
+{
+}
+
+bool Frustum::intersects(const BoundingSphere& sphere) const
+{
+    if (sphere.is_empty())
+    {
+        return false;
+    }
+    if (_spherical)
+    {
+        return sphere.center.norm() - sphere.radius <= _radius;
+    }
+    for (const std::array<float, 4>& plane : _planes)
+    {
+        if (plane[0]*sphere.center.x + plane[1]*sphere.center.y + plane[2]*sphere.center.z + plane[3] < -sphere.radius)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::intersects(const BoundingBox& box) const
+{
+    if (box.is_empty())
+    {
+        return false;
+    }
+    if (_spherical)
+    {
+        // distance from the camera to the closest point of the box
+        Vector closest(std::max(box.lower.x, std::min(0., box.upper.x)),
+                       std::max(box.lower.y, std::min(0., box.upper.y)),
+                       std::max(box.lower.z, std::min(0., box.upper.z)));
+        return closest.norm() <= _radius;
+    }
+    Vector c = box.center();
+    Vector e = box.half_extents();
+    for (const std::array<float, 4>& plane : _planes)
+    {
+        // signed distance of the box's corner that is the furthest inside along the plane's normal
+        double distance = plane[0]*c.x + plane[1]*c.y + plane[2]*c.z + plane[3]
+                        + std::abs(plane[0])*e.x + std::abs(plane[1])*e.y + std::abs(plane[2])*e.z;
+        if (distance < 0.)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::size_t> Frustum::bulk_intersects(const float* x, const float* y, const float* z, const float* radius, std::size_t count) const
+{
+    std::vector<std::size_t> visible;
+    visible.reserve(count);
+    std::size_t packed = (count / FloatPack::size) * FloatPack::size;
+    const FloatPack zero(0.f);
+    // vectorized pass: a bit of 'outside' is set for each sphere that is entirely outside of one of the planes (or of the sphere)
+    for (std::size_t i=0; i<packed; i+=FloatPack::size)
+    {
+        FloatPack cx = FloatPack::load(&x[i]);
+        FloatPack cy = FloatPack::load(&y[i]);
+        FloatPack cz = FloatPack::load(&z[i]);
+        FloatPack r = FloatPack::load(&radius[i]);
+        unsigned int outside = FloatPack::less(r, zero);
+        if (_spherical)
+        {
+            FloatPack distance = FloatPack::sqrt(cx*cx + cy*cy + cz*cz) - r;
+            outside |= FloatPack::less(FloatPack(_radius), distance);
+        }
+        for (const std::array<float, 4>& plane : _planes)
+        {
+            FloatPack distance = FloatPack(plane[0])*cx + FloatPack(plane[1])*cy + FloatPack(plane[2])*cz + FloatPack(plane[3]);
+            outside |= FloatPack::less(distance, -r);
+        }
+        for (std::size_t j=0; j<FloatPack::size; j++)
+        {
+            if (!(outside & (1u << j)))
+            {
+                visible.push_back(i+j);
+            }
+        }
+    }
+    for (std::size_t i=packed; i<count; i++)
+    {
+        if (intersects(BoundingSphere(Vector(x[i], y[i], z[i]), radius[i])))
+        {
+            visible.push_back(i);
+        }
+    }
+    return visible;
+}
+
+std::vector<const Model*> Frustum::bulk_visible(const Camera& camera, double aspect_ratio, const std::vector<const Model*>& models, bool test_boxes)
+{
+    Frustum frustum(camera, aspect_ratio);
+    // coordinates of the models in the camera's referential
+    std::vector<const Referential*> referentials(models.begin(), models.end());
+    ReferentialsCoordinates coordinates;
+    Referential::bulk_coordinates_in(camera, referentials, coordinates);
+    // bounding spheres of the meshes, in mesh coordinates (models without mesh get an empty sphere of negative radius)
+    std::size_t padded_size = FloatPack::padded_size(models.size());
+    std::array<std::vector<float>, 4> spheres; // x, y, z, radius
+    for (std::vector<float>& array : spheres)
+    {
+        array.resize(padded_size, 0.f);
+    }
+    for (std::size_t i=0; i<models.size(); i++)
+    {
+        const BoundingSphere sphere = (models[i]->mesh == nullptr) ? BoundingSphere() : models[i]->mesh->bounding_sphere();
+        spheres[0][i] = static_cast<float>(sphere.center.x);
+        spheres[1][i] = static_cast<float>(sphere.center.y);
+        spheres[2][i] = static_cast<float>(sphere.center.z);
+        spheres[3][i] = static_cast<float>(sphere.radius);
+    }
+    // spheres in camera coordinates, transformed the way Canvas::draw transforms the mesh: p + scale * M * center, with M the transposed 'inverse_rotation'
+    for (std::size_t i=0; i<padded_size; i+=FloatPack::size)
+    {
+        FloatPack s = FloatPack::load(&coordinates.scale[i]);
+        FloatPack cx = FloatPack::load(&spheres[0][i]);
+        FloatPack cy = FloatPack::load(&spheres[1][i]);
+        FloatPack cz = FloatPack::load(&spheres[2][i]);
+        FloatPack r = FloatPack::load(&spheres[3][i]);
+        FloatPack m[9];
+        for (std::size_t k=0; k<9; k++)
+        {
+            m[k] = FloatPack::load(&coordinates.inverse_rotation[k][i]);
+        }
+        (FloatPack::load(&coordinates.position[0][i]) + s*(m[0]*cx + m[3]*cy + m[6]*cz)).store(&spheres[0][i]);
+        (FloatPack::load(&coordinates.position[1][i]) + s*(m[1]*cx + m[4]*cy + m[7]*cz)).store(&spheres[1][i]);
+        (FloatPack::load(&coordinates.position[2][i]) + s*(m[2]*cx + m[5]*cy + m[8]*cz)).store(&spheres[2][i]);
+        // the columns of M are orthogonal and of same norm, so the radius is scaled by the norm of any of them
+        FloatPack stretch = FloatPack::sqrt(m[0]*m[0] + m[1]*m[1] + m[2]*m[2]) * FloatPack::abs(s);
+        FloatPack::select(FloatPack::less(r, FloatPack(0.f)), r, r*stretch).store(&spheres[3][i]);
+    }
+    std::vector<std::size_t> indexes = frustum.bulk_intersects(spheres[0].data(), spheres[1].data(), spheres[2].data(), spheres[3].data(), models.size());
+    std::vector<const Model*> visible;
+    visible.reserve(indexes.size());
+    for (std::size_t i : indexes)
+    {
+        if (test_boxes && !frustum.intersects(models[i]->bounding_box_in(camera)))
+        {
+            continue;
+        }
+        visible.push_back(models[i]);
+    }
+    return visible;
+}
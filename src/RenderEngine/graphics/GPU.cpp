@@ -51,6 +51,7 @@ GPU::GPU(VkPhysicalDevice device, const Window& window, const std::vector<const
     std::map<uint32_t, uint32_t> selected_families_count; // number of purpose each queue is selected for
     std::optional<uint32_t> graphics_family = _select_queue_family(queue_families, VK_QUEUE_GRAPHICS_BIT, selected_families_count);
     std::optional<uint32_t> compute_family = _select_queue_family(queue_families, VK_QUEUE_COMPUTE_BIT, selected_families_count);
+    std::optional<uint32_t> transfer_family = _select_queue_family(queue_families, VK_QUEUE_TRANSFER_BIT, selected_families_count);
     bool graphics_queue_is_present_queue = false;
     std::optional<uint32_t> present_family;
     if (swap_chain_supported)
@@ -73,6 +74,18 @@ GPU::GPU(VkPhysicalDevice device, const Window& window, const std::vector<const
     VkPhysicalDeviceExtendedDynamicStateFeaturesEXT ext_dynamic_state {};
     ext_dynamic_state.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
     ext_dynamic_state.extendedDynamicState = true;
+    // the staging ring signals the completion of uploads with a timeline semaphore
+    VkPhysicalDeviceTimelineSemaphoreFeatures timeline_semaphore {};
+    timeline_semaphore.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+    VkPhysicalDeviceFeatures2 features {};
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = &timeline_semaphore;
+    vkGetPhysicalDeviceFeatures2(_physical_device, &features);
+    if (!timeline_semaphore.timelineSemaphore)
+    {
+        THROW_ERROR("timeline semaphores are not supported by the device");
+    }
+    timeline_semaphore.pNext = _dynamic_culling_supported ? &ext_dynamic_state : nullptr;
     VkDeviceCreateInfo device_info = {};
     device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     device_info.pQueueCreateInfos = selected_families.data();
@@ -82,7 +95,7 @@ GPU::GPU(VkPhysicalDevice device, const Window& window, const std::vector<const
     device_info.enabledExtensionCount = enabled_extensions.size();
     device_info.enabledLayerCount = validation_layers.size();
     device_info.ppEnabledLayerNames = validation_layers.data();
-    device_info.pNext = _dynamic_culling_supported ? &ext_dynamic_state : nullptr;
+    device_info.pNext = &timeline_semaphore;
     if (vkCreateDevice(_physical_device, &device_info, nullptr, &_logical_device) != VK_SUCCESS)
     {
         THROW_ERROR("failed to create logical device");
@@ -90,6 +103,11 @@ GPU::GPU(VkPhysicalDevice device, const Window& window, const std::vector<const
     // retrieve the queues handle
     _graphics_queue = _query_queue_handle(graphics_family, selected_families_count);
     _compute_queue = _query_queue_handle(compute_family, selected_families_count);
+    _transfer_queue = _query_queue_handle(transfer_family, selected_families_count);
+    if (!_transfer_queue.has_value())
+    {
+        _transfer_queue = _graphics_queue;
+    }
     if (graphics_queue_is_present_queue)
     {
         _present_queue = _graphics_queue;
@@ -98,21 +116,27 @@ GPU::GPU(VkPhysicalDevice device, const Window& window, const std::vector<const
     {
         _present_queue = _query_queue_handle(present_family, selected_families_count);
     }
+    // initialize the allocator of buffers and images memory
+    _memory_allocator.reset(new MemoryAllocator(this));
     // initialize shader
     _shaders["3D"] = new Shader3D(this);
     _shaders["Demo"] = new ShaderDemo(this);
     _shaders["Light"] = new ShaderLight(this);
     _shaders["Shadow"] = new ShaderShadow(this);
     _shaders["Clear"] = new ShaderClear(this);
+    // initialize the staging ring of uploads to device local buffers
+    _staging_ring.reset(new StagingRing(this, StagingRing::DEFAULT_BYTES_SIZE));
 }
 
 GPU::~GPU()
 {
     _default_textures.clear();
+    _staging_ring.reset();
     for (std::pair<std::string, Shader*> shader : _shaders)
     {
         delete shader.second;
     }
+    _memory_allocator.reset();
     bool graphics_queue_is_present_queue = (_graphics_queue == _present_queue);
     if (_graphics_queue.has_value())
     {
@@ -126,6 +150,10 @@ GPU::~GPU()
     {
         vkDestroyCommandPool(_logical_device, std::get<2>(_present_queue.value()), nullptr);
     }
+    if (_transfer_queue.has_value() && (_transfer_queue != _graphics_queue))
+    {
+        vkDestroyCommandPool(_logical_device, std::get<2>(_transfer_queue.value()), nullptr);
+    }
     vkDeviceWaitIdle(_logical_device);
     vkDestroyDevice(_logical_device, nullptr);
 }
@@ -286,6 +314,16 @@ bool GPU::dynamic_culling_supported() const
     return _dynamic_culling_supported;
 }
 
+std::size_t GPU::storage_buffer_alignment() const
+{
+    return static_cast<std::size_t>(_device_properties.limits.minStorageBufferOffsetAlignment);
+}
+
+MemoryStatistics GPU::memory_statistics() const
+{
+    return _memory_allocator->statistics();
+}
+
 std::optional<uint32_t> GPU::_select_present_queue_family(std::vector<VkQueueFamilyProperties>& queue_families,
                                                           const Window& window, std::map<uint32_t, uint32_t>& selected_families_count,
                                                           const std::optional<uint32_t>& graphics_family, bool& graphics_queue_is_present_queue) const
@@ -4,6 +4,7 @@
 #include <stb/stb_image.h>
 #include <stb/stb_image_write.h>
 #include <stb/stb_image_resize.h>
+#include <limits>
 
 using namespace RenderEngine;
 
@@ -37,8 +38,7 @@ Image::Image(const GPU* gpu, const std::string& file_path, ImageFormat format,
     _format = format;
     _mip_levels = _mip_levels_count(_width, _height);
     _vk_image = _create_vk_image(gpu, _width, _height, _format, _mip_levels, AntiAliasing::X1);
-    _vk_device_memory = std::get<0>(_allocate_vk_device_memory(gpu, _vk_image, 1));
-    _bind_image_to_memory(gpu, _vk_image, _vk_device_memory, 0);
+    _allocation = _allocate_memory(gpu, _vk_image);
     _create_vk_image_view();
     _create_vk_sampler();
     upload_data(pixels);
@@ -51,17 +51,14 @@ Image::Image(const GPU* gpu, ImageFormat format, uint32_t width, uint32_t height
     _format = format;
     _mip_levels = (mipmaped ? _mip_levels_count(_width, _height) : 1);
     _vk_image = _create_vk_image(gpu, width, height, format, _mip_levels, sample_count);
-    _vk_device_memory = std::get<0>(_allocate_vk_device_memory(gpu, _vk_image, 1));
-    _bind_image_to_memory(gpu, _vk_image, _vk_device_memory, 0);
+    _allocation = _allocate_memory(gpu, _vk_image);
     _create_vk_image_view();
     _create_vk_sampler();
 }
 
-Image::Image(const GPU* gpu, const VkImage& vk_image, const std::shared_ptr<VkDeviceMemory>& vk_device_memory,
-             ImageFormat format, uint32_t width, uint32_t height, bool mipmaped) : _gpu(gpu)
+Image::Image(const GPU* gpu, const VkImage& vk_image, ImageFormat format, uint32_t width, uint32_t height, bool mipmaped) : _gpu(gpu)
 {
     _vk_image = vk_image;
-    _vk_device_memory = vk_device_memory;
     _width = width;
     _height = height;
     _format = format;
@@ -76,9 +73,10 @@ Image::~Image()
     vkDestroySampler(_gpu->_logical_device, _vk_sampler, nullptr);
     vkDestroyImageView(_gpu->_logical_device, _vk_image_view, nullptr);
     // If the image is owned (not created by the swapchain), destroy it
-    if (_vk_device_memory.get() != nullptr)
+    if (_allocation.memory != VK_NULL_HANDLE)
     {
         vkDestroyImage(_gpu->_logical_device, _vk_image, nullptr);
+        _gpu->_memory_allocator->free(_allocation);
     }
 }
 
@@ -136,49 +134,13 @@ VkImage Image::_create_vk_image(const GPU* gpu, uint32_t width, uint32_t height,
     return vk_image;
 }
 
-std::tuple<std::shared_ptr<VkDeviceMemory>, std::size_t> Image::_allocate_vk_device_memory(const GPU* gpu, const VkImage& vk_image, uint32_t n_images)
+MemoryAllocation Image::_allocate_memory(const GPU* gpu, const VkImage& vk_image)
 {
-    // query required memory properties
     VkMemoryRequirements mem_requirements;
     vkGetImageMemoryRequirements(gpu->_logical_device, vk_image, &mem_requirements);
-    std::size_t required_memory_bytes = ((mem_requirements.size / mem_requirements.alignment) + (mem_requirements.size % mem_requirements.alignment == 0 ? 0 : 1)) * mem_requirements.alignment;
-    // find suitable memory type/heap
-    uint32_t memoryTypeIndex = std::numeric_limits<uint32_t>::max();
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(gpu->_physical_device, &memProperties);
-    VkMemoryPropertyFlagBits memory_requirements = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-        if ((mem_requirements.memoryTypeBits & (1 << i))
-            &&
-            ((memProperties.memoryTypes[i].propertyFlags & memory_requirements) == memory_requirements))
-        {
-            memoryTypeIndex = i;
-            break;
-        }
-    }
-    if (memoryTypeIndex == std::numeric_limits<uint32_t>::max())
-    {
-        THROW_ERROR("failed to find suitable memory type!");
-    }
-    // allocate device memory
-    std::shared_ptr<VkDeviceMemory> vk_device_memory(
-        new VkDeviceMemory(),
-        [gpu](VkDeviceMemory* vk_device_memory){vkFreeMemory(gpu->_logical_device, *vk_device_memory, nullptr);delete vk_device_memory;}
-    );
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = required_memory_bytes * n_images;
-    allocInfo.memoryTypeIndex = memoryTypeIndex;
-    if (vkAllocateMemory(gpu->_logical_device, &allocInfo, nullptr, vk_device_memory.get()) != VK_SUCCESS)
-    {
-        THROW_ERROR("failed to allocate image memory!");
-    }
-    return std::make_pair(vk_device_memory, required_memory_bytes);
-}
-
-void Image::_bind_image_to_memory(const GPU* gpu, const VkImage& vk_image, const std::shared_ptr<VkDeviceMemory>& vk_device_memory, std::size_t offset)
-{
-    vkBindImageMemory(gpu->_logical_device, vk_image, *vk_device_memory.get(), offset);
+    MemoryAllocation allocation = gpu->_memory_allocator->allocate(mem_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false);
+    vkBindImageMemory(gpu->_logical_device, vk_image, allocation.memory, allocation.offset);
+    return allocation;
 }
 
 uint32_t Image::_mip_levels_count(uint32_t width, uint32_t height)
@@ -236,26 +198,10 @@ void Image::_create_vk_image_view()
 std::vector<std::shared_ptr<Image>> Image::bulk_allocate_images(const GPU* gpu, uint32_t n_images, ImageFormat format, uint32_t width, uint32_t height, bool mipmaped)
 {
     std::vector<std::shared_ptr<Image>> images;
-    if (n_images == 0)
-    {
-        return images;
-    }
-    std::vector<VkImage> vk_images;
-    for (uint32_t i=0; i<n_images; i++)
-    {
-        vk_images.push_back(_create_vk_image(gpu, width, height, format, _mip_levels_count(width, height), AntiAliasing::X1));
-    }
-    std::size_t offset;
-    std::shared_ptr<VkDeviceMemory> vk_device_memory;
-    std::tie(vk_device_memory, offset) = _allocate_vk_device_memory(gpu, vk_images[0], vk_images.size());
+    // the memory allocator packs the images in shared blocks of memory
     for (uint32_t i=0; i<n_images; i++)
     {
-        _bind_image_to_memory(gpu, vk_images[i], vk_device_memory, i*offset);
-    }
-    for (uint32_t i=0; i<n_images; i++)
-    {
-        Image* image = new Image(gpu, vk_images[i], vk_device_memory, format, width, height, mipmaped);
-        images.emplace_back(image);
+        images.emplace_back(new Image(gpu, format, width, height, mipmaped));
     }
     return images;
 }
@@ -528,8 +474,20 @@ void Image::_end_single_time_commands(VkCommandBuffer commandBuffer)
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &commandBuffer;
-    vkQueueSubmit(std::get<1>(_current_queue.value()), 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(std::get<1>(_current_queue.value()));
+    // wait on a fence rather than on the queue, so that the queue is not locked while the commands execute
+    VkFence fence;
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    if (vkCreateFence(_gpu->_logical_device, &fenceInfo, nullptr, &fence) != VK_SUCCESS)
+    {
+        THROW_ERROR("failed to create VkFence");
+    }
+    {
+        std::lock_guard<std::mutex> lock(_gpu->_queues_mutex);
+        vkQueueSubmit(std::get<1>(_current_queue.value()), 1, &submitInfo, fence);
+    }
+    vkWaitForFences(_gpu->_logical_device, 1, &fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    vkDestroyFence(_gpu->_logical_device, fence, nullptr);
     vkFreeCommandBuffers(_gpu->_logical_device, std::get<2>(_current_queue.value()), 1, &commandBuffer);
 }
 
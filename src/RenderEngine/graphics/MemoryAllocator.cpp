@@ -0,0 +1,471 @@
+#include <RenderEngine/graphics/MemoryAllocator.hpp>
+#include <RenderEngine/graphics/GPU.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <algorithm>
+#include <limits>
+using namespace RenderEngine;
+
+namespace
+{
+    // Each power of two of range sizes is subdivided in SL_COUNT free lists
+    constexpr uint32_t SL_LOG2 = 4;
+    constexpr uint32_t SL_COUNT = 1 << SL_LOG2;
+    constexpr uint32_t FL_COUNT = 64 - SL_LOG2 + 1;
+    constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+    // Heaps up to this size get blocks of an eighth of their size
+    constexpr std::size_t SMALL_HEAP_SIZE = 1024 * 1024 * 1024;
+
+    // Index of the highest set bit of a non zero value
+    uint32_t highest_bit(uint64_t value)
+    {
+        uint32_t bit = 0;
+        for (uint32_t shift = 32; shift > 0; shift /= 2)
+        {
+            if (value >> shift)
+            {
+                value >>= shift;
+                bit += shift;
+            }
+        }
+        return bit;
+    }
+
+    // Index of the lowest set bit of a non zero value
+    uint32_t lowest_bit(uint64_t value)
+    {
+        return highest_bit(value & (~value + 1));
+    }
+
+    std::size_t align_up(std::size_t value, std::size_t alignment)
+    {
+        return ((value + alignment - 1) / alignment) * alignment;
+    }
+
+    // Free list of ranges of the given size
+    void mapping(std::size_t size, uint32_t& fl, uint32_t& sl)
+    {
+        if (size < SL_COUNT)
+        {
+            fl = 0;
+            sl = static_cast<uint32_t>(size);
+        }
+        else
+        {
+            uint32_t log2 = highest_bit(size);
+            fl = log2 - SL_LOG2 + 1;
+            sl = static_cast<uint32_t>(size >> (log2 - SL_LOG2)) - SL_COUNT;
+        }
+    }
+}
+
+// A block of device memory, divided in contiguous ranges that are either free or allocated
+struct MemoryAllocator::Block
+{
+    struct Range
+    {
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        bool free = true;
+        uint32_t prev_physical = NONE; // neighbour ranges in the block
+        uint32_t next_physical = NONE;
+        uint32_t prev_free = NONE; // neighbour ranges in the free list, if free
+        uint32_t next_free = NONE;
+    };
+
+    Block(VkDeviceMemory _memory, void* _mapped, std::size_t _size) : memory(_memory), mapped(_mapped), size(_size)
+    {
+        std::fill(sl_bitmaps, sl_bitmaps+FL_COUNT, 0);
+        std::fill(&heads[0][0], &heads[0][0]+FL_COUNT*SL_COUNT, NONE);
+        Range range;
+        range.size = size;
+        ranges.push_back(range);
+        _insert_free(0);
+    }
+
+    // Allocates a range of the block. Returns false if there is no free range large enough.
+    bool allocate(std::size_t bytes_size, std::size_t alignment, MemoryAllocation& allocation)
+    {
+        // the searched size accounts for the worst alignment padding, and is rounded up to the next free list, so that any range of the found list fits
+        std::size_t searched_size = bytes_size + alignment - 1;
+        if (searched_size > size)
+        {
+            return false;
+        }
+        std::size_t rounded_size = searched_size;
+        if (searched_size >= SL_COUNT)
+        {
+            rounded_size += (std::size_t(1) << (highest_bit(searched_size) - SL_LOG2)) - 1;
+        }
+        uint32_t fl, sl;
+        mapping(rounded_size, fl, sl);
+        uint32_t index = _find_free(fl, sl);
+        if (index == NONE)
+        {
+            // the ranges of the list of the searched size might be large enough
+            mapping(searched_size, fl, sl);
+            for (index = heads[fl][sl]; index != NONE && ranges[index].size < searched_size; index = ranges[index].next_free);
+            if (index == NONE)
+            {
+                return false;
+            }
+        }
+        _remove_free(index);
+        // the alignment padding and the remaining bytes are split in free ranges
+        std::size_t padding = align_up(ranges[index].offset, alignment) - ranges[index].offset;
+        if (padding > 0)
+        {
+            uint32_t front = _split(index, padding);
+            _insert_free(front);
+            index = ranges[front].next_physical;
+        }
+        if (ranges[index].size > bytes_size)
+        {
+            uint32_t back = ranges[_split(index, bytes_size)].next_physical;
+            _insert_free(back);
+        }
+        Range& range = ranges[index];
+        range.free = false;
+        used_bytes += range.size;
+        allocations_count++;
+        allocation.memory = memory;
+        allocation.offset = range.offset;
+        allocation.size = range.size;
+        allocation.mapped = (mapped == nullptr ? nullptr : reinterpret_cast<uint8_t*>(mapped) + range.offset);
+        allocation._block = this;
+        allocation._range = index;
+        return true;
+    }
+
+    // Frees an allocated range, merging it with its free neighbours
+    void free(uint32_t index)
+    {
+        ranges[index].free = true;
+        used_bytes -= ranges[index].size;
+        allocations_count--;
+        uint32_t prev = ranges[index].prev_physical;
+        if (prev != NONE && ranges[prev].free)
+        {
+            _remove_free(prev);
+            _merge(prev);
+            index = prev;
+        }
+        uint32_t next = ranges[index].next_physical;
+        if (next != NONE && ranges[next].free)
+        {
+            _remove_free(next);
+            _merge(index);
+        }
+        _insert_free(index);
+    }
+
+    // Size of the largest free range
+    std::size_t largest_free_range() const
+    {
+        if (fl_bitmap == 0)
+        {
+            return 0;
+        }
+        uint32_t fl = highest_bit(fl_bitmap);
+        uint32_t sl = highest_bit(sl_bitmaps[fl]);
+        std::size_t largest = 0;
+        for (uint32_t index = heads[fl][sl]; index != NONE; index = ranges[index].next_free)
+        {
+            largest = std::max(largest, ranges[index].size);
+        }
+        return largest;
+    }
+
+    // Returns the first range of the first non empty free list at or above (fl, sl), or NONE
+    uint32_t _find_free(uint32_t fl, uint32_t sl) const
+    {
+        if (fl >= FL_COUNT)
+        {
+            return NONE;
+        }
+        uint32_t sl_map = sl_bitmaps[fl] & (~0u << sl);
+        if (sl_map == 0)
+        {
+            uint64_t fl_map = (fl+1 < FL_COUNT) ? (fl_bitmap & (~uint64_t(0) << (fl+1))) : 0;
+            if (fl_map == 0)
+            {
+                return NONE;
+            }
+            fl = lowest_bit(fl_map);
+            sl_map = sl_bitmaps[fl];
+        }
+        return heads[fl][lowest_bit(sl_map)];
+    }
+
+    void _insert_free(uint32_t index)
+    {
+        uint32_t fl, sl;
+        mapping(ranges[index].size, fl, sl);
+        Range& range = ranges[index];
+        range.free = true;
+        range.prev_free = NONE;
+        range.next_free = heads[fl][sl];
+        if (range.next_free != NONE)
+        {
+            ranges[range.next_free].prev_free = index;
+        }
+        heads[fl][sl] = index;
+        fl_bitmap |= (uint64_t(1) << fl);
+        sl_bitmaps[fl] |= (1u << sl);
+    }
+
+    void _remove_free(uint32_t index)
+    {
+        uint32_t fl, sl;
+        mapping(ranges[index].size, fl, sl);
+        Range& range = ranges[index];
+        if (range.prev_free != NONE)
+        {
+            ranges[range.prev_free].next_free = range.next_free;
+        }
+        else
+        {
+            heads[fl][sl] = range.next_free;
+        }
+        if (range.next_free != NONE)
+        {
+            ranges[range.next_free].prev_free = range.prev_free;
+        }
+        range.prev_free = NONE;
+        range.next_free = NONE;
+        if (heads[fl][sl] == NONE)
+        {
+            sl_bitmaps[fl] &= ~(1u << sl);
+            if (sl_bitmaps[fl] == 0)
+            {
+                fl_bitmap &= ~(uint64_t(1) << fl);
+            }
+        }
+    }
+
+    // Splits a range that is in no free list in two, the first one being 'bytes_size' long. Returns the index of the first range.
+    uint32_t _split(uint32_t index, std::size_t bytes_size)
+    {
+        uint32_t second;
+        if (unused_ranges.size() > 0)
+        {
+            second = unused_ranges.back();
+            unused_ranges.pop_back();
+        }
+        else
+        {
+            second = static_cast<uint32_t>(ranges.size());
+            ranges.emplace_back();
+        }
+        Range& first = ranges[index];
+        Range& range = ranges[second];
+        range.offset = first.offset + bytes_size;
+        range.size = first.size - bytes_size;
+        range.free = first.free;
+        range.prev_physical = index;
+        range.next_physical = first.next_physical;
+        if (first.next_physical != NONE)
+        {
+            ranges[first.next_physical].prev_physical = second;
+        }
+        first.size = bytes_size;
+        first.next_physical = second;
+        return index;
+    }
+
+    // Merges a range with its next physical range. Neither of them must be in a free list.
+    void _merge(uint32_t index)
+    {
+        Range& range = ranges[index];
+        uint32_t next = range.next_physical;
+        range.size += ranges[next].size;
+        range.next_physical = ranges[next].next_physical;
+        if (range.next_physical != NONE)
+        {
+            ranges[range.next_physical].prev_physical = index;
+        }
+        ranges[next] = Range();
+        unused_ranges.push_back(next);
+    }
+
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    void* mapped = nullptr;
+    std::size_t size = 0;
+    std::size_t used_bytes = 0;
+    std::size_t allocations_count = 0;
+    std::vector<Range> ranges;
+    std::vector<uint32_t> unused_ranges; // indices of ranges that were merged, reused by the next splits
+    uint64_t fl_bitmap = 0; // bit i is set if a list of sl_bitmaps[i] is not empty
+    uint32_t sl_bitmaps[FL_COUNT]; // bit j of sl_bitmaps[i] is set if the list heads[i][j] is not empty
+    uint32_t heads[FL_COUNT][SL_COUNT]; // first range of each free list
+};
+
+MemoryAllocator::MemoryAllocator(const GPU* gpu, std::size_t block_size) : _gpu(gpu)
+{
+    _memory_properties = gpu->_device_memory;
+    _granularity = std::max<std::size_t>(gpu->_device_properties.limits.bufferImageGranularity, 1);
+    _atom_size = std::max<std::size_t>(gpu->_device_properties.limits.nonCoherentAtomSize, 1);
+    _block_sizes.resize(_memory_properties.memoryTypeCount);
+    for (uint32_t i = 0; i < _memory_properties.memoryTypeCount; i++)
+    {
+        std::size_t heap_size = _memory_properties.memoryHeaps[_memory_properties.memoryTypes[i].heapIndex].size;
+        _block_sizes[i] = (heap_size <= SMALL_HEAP_SIZE) ? std::min(block_size, heap_size / 8) : block_size;
+    }
+    _pools.resize(2 * _memory_properties.memoryTypeCount);
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+    for (std::vector<std::unique_ptr<Block>>& pool : _pools)
+    {
+        for (std::unique_ptr<Block>& block : pool)
+        {
+            _free_device_memory(block->memory, block->mapped);
+        }
+    }
+}
+
+MemoryAllocation MemoryAllocator::allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool linear)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t memory_type = _memory_type(requirements.memoryTypeBits, properties);
+    MemoryAllocation allocation;
+    allocation.properties = _memory_properties.memoryTypes[memory_type].propertyFlags;
+    std::size_t alignment = std::max<std::size_t>(requirements.alignment, 1);
+    std::size_t bytes_size = requirements.size;
+    // flushed ranges of non coherent memory are rounded to the atom size, so they must not overlap other allocations
+    if ((allocation.properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) && !(allocation.properties & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+    {
+        alignment = std::max(alignment, _atom_size);
+        bytes_size = align_up(bytes_size, _atom_size);
+    }
+    std::size_t block_size = _block_sizes[memory_type];
+    if (bytes_size <= block_size / 2)
+    {
+        // linear and optimal tiling resources are kept in separate blocks, so that they never share a page of 'bufferImageGranularity' bytes
+        uint32_t pool = 2 * memory_type + ((linear || _granularity <= 1) ? 0 : 1);
+        for (std::unique_ptr<Block>& block : _pools[pool])
+        {
+            if (block->allocate(bytes_size, alignment, allocation))
+            {
+                allocation._pool = pool;
+                return allocation;
+            }
+        }
+        VkDeviceMemory memory;
+        void* mapped;
+        if (_allocate_device_memory(memory_type, block_size, memory, mapped))
+        {
+            _pools[pool].emplace_back(new Block(memory, mapped, block_size));
+            if (_pools[pool].back()->allocate(bytes_size, alignment, allocation))
+            {
+                allocation._pool = pool;
+                return allocation;
+            }
+        }
+        // if there is not enough memory left for a new block, the resource is allocated alone
+    }
+    if (!_allocate_device_memory(memory_type, bytes_size, allocation.memory, allocation.mapped))
+    {
+        THROW_ERROR("failed to allocate device memory!");
+    }
+    allocation.offset = 0;
+    allocation.size = bytes_size;
+    _dedicated_count++;
+    _dedicated_bytes += bytes_size;
+    return allocation;
+}
+
+void MemoryAllocator::free(const MemoryAllocation& allocation)
+{
+    if (allocation.memory == VK_NULL_HANDLE)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (allocation._block == nullptr)
+    {
+        _free_device_memory(allocation.memory, allocation.mapped);
+        _dedicated_count--;
+        _dedicated_bytes -= allocation.size;
+        return;
+    }
+    Block* block = reinterpret_cast<Block*>(allocation._block);
+    block->free(allocation._range);
+    if (block->allocations_count > 0)
+    {
+        return;
+    }
+    // an empty block is kept to avoid reallocating one for the next resource, unless the pool already has one
+    std::vector<std::unique_ptr<Block>>& pool = _pools[allocation._pool];
+    std::size_t empty_blocks = std::count_if(pool.begin(), pool.end(), [](const std::unique_ptr<Block>& b) {return b->allocations_count == 0;});
+    if (empty_blocks > 1)
+    {
+        _free_device_memory(block->memory, block->mapped);
+        pool.erase(std::find_if(pool.begin(), pool.end(), [block](const std::unique_ptr<Block>& b) {return b.get() == block;}));
+    }
+}
+
+MemoryStatistics MemoryAllocator::statistics() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    MemoryStatistics statistics;
+    statistics.dedicated_count = _dedicated_count;
+    statistics.allocations_count = _dedicated_count;
+    statistics.reserved_bytes = _dedicated_bytes;
+    statistics.used_bytes = _dedicated_bytes;
+    for (const std::vector<std::unique_ptr<Block>>& pool : _pools)
+    {
+        for (const std::unique_ptr<Block>& block : pool)
+        {
+            statistics.blocks_count++;
+            statistics.allocations_count += block->allocations_count;
+            statistics.reserved_bytes += block->size;
+            statistics.used_bytes += block->used_bytes;
+            statistics.largest_free_range = std::max(statistics.largest_free_range, block->largest_free_range());
+        }
+    }
+    return statistics;
+}
+
+uint32_t MemoryAllocator::_memory_type(uint32_t type_bits, VkMemoryPropertyFlags properties) const
+{
+    for (uint32_t i = 0; i < _memory_properties.memoryTypeCount; i++)
+    {
+        if ((type_bits & (1 << i)) && ((_memory_properties.memoryTypes[i].propertyFlags & properties) == properties))
+        {
+            return i;
+        }
+    }
+    THROW_ERROR("Failed to find suitable memory type.");
+}
+
+bool MemoryAllocator::_allocate_device_memory(uint32_t memory_type, std::size_t size, VkDeviceMemory& memory, void*& mapped) const
+{
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memory_type;
+    if (vkAllocateMemory(_gpu->_logical_device, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+    {
+        return false;
+    }
+    mapped = nullptr;
+    if (_memory_properties.memoryTypes[memory_type].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+        if (vkMapMemory(_gpu->_logical_device, memory, 0, VK_WHOLE_SIZE, 0, &mapped) != VK_SUCCESS)
+        {
+            vkFreeMemory(_gpu->_logical_device, memory, nullptr);
+            THROW_ERROR("failed to map device memory!");
+        }
+    }
+    return true;
+}
+
+void MemoryAllocator::_free_device_memory(VkDeviceMemory memory, void* mapped) const
+{
+    if (mapped != nullptr)
+    {
+        vkUnmapMemory(_gpu->_logical_device, memory);
+    }
+    vkFreeMemory(_gpu->_logical_device, memory, nullptr);
+}
@@ -0,0 +1,215 @@
+#include <RenderEngine/graphics/StagingRing.hpp>
+#include <RenderEngine/graphics/GPU.hpp>
+#include <RenderEngine/graphics/Buffer.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <algorithm>
+#include <limits>
+#include <cstring>
+using namespace RenderEngine;
+
+namespace
+{
+    // Alignment of the ranges reserved in the ring
+    constexpr std::size_t RANGE_ALIGNMENT = 16;
+}
+
+StagingRing::StagingRing(const GPU* gpu, std::size_t bytes_size) : _gpu(gpu)
+{
+    _buffer.reset(new Buffer(gpu, std::max(bytes_size, RANGE_ALIGNMENT), VK_BUFFER_USAGE_TRANSFER_SRC_BIT));
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = std::get<0>(gpu->_transfer_queue.value());
+    if (vkCreateCommandPool(gpu->_logical_device, &poolInfo, nullptr, &_vk_command_pool) != VK_SUCCESS)
+    {
+        THROW_ERROR("failed to create command pool!");
+    }
+    VkSemaphoreTypeCreateInfo typeInfo{};
+    typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    typeInfo.initialValue = 0;
+    VkSemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext = &typeInfo;
+    if (vkCreateSemaphore(gpu->_logical_device, &semaphoreInfo, nullptr, &_vk_semaphore) != VK_SUCCESS)
+    {
+        THROW_ERROR("failed to create VkSemaphore");
+    }
+}
+
+StagingRing::~StagingRing()
+{
+    wait();
+    vkDestroyCommandPool(_gpu->_logical_device, _vk_command_pool, nullptr);
+    vkDestroySemaphore(_gpu->_logical_device, _vk_semaphore, nullptr);
+}
+
+void StagingRing::upload(const Buffer& destination, const void* data, std::size_t bytes_size, std::size_t offset)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _release(false);
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    // large uploads are split in parts of half the ring, so that a part can be written while the previous one is copied
+    const std::size_t max_part_size = std::max(_buffer->bytes_size() / 2, RANGE_ALIGNMENT);
+    while (bytes_size > 0)
+    {
+        std::size_t part_size = std::min(bytes_size, max_part_size);
+        std::size_t position = _reserve(part_size);
+        std::memcpy(_buffer->mapped(position), bytes, part_size);
+        _buffer->flush(part_size, position);
+        Batch& batch = _recording_batch();
+        VkBufferCopy region{};
+        region.srcOffset = position;
+        region.dstOffset = offset;
+        region.size = part_size;
+        vkCmdCopyBuffer(batch.command_buffer, _buffer->_vk_buffer, destination._vk_buffer, 1, &region);
+        bytes += part_size;
+        offset += part_size;
+        bytes_size -= part_size;
+    }
+}
+
+uint64_t StagingRing::submit()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _submit();
+    return _submitted_value;
+}
+
+void StagingRing::wait()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _submit();
+    while (!_submitted.empty())
+    {
+        _release(true);
+    }
+}
+
+std::size_t StagingRing::_reserve(std::size_t bytes_size)
+{
+    const std::size_t ring_size = _buffer->bytes_size();
+    std::size_t aligned_size = std::min(((bytes_size + RANGE_ALIGNMENT - 1) / RANGE_ALIGNMENT) * RANGE_ALIGNMENT, ring_size);
+    // ranges are contiguous, so the end of the ring is skipped if the range does not fit before it
+    std::size_t position = static_cast<std::size_t>(_head % ring_size);
+    if (position + aligned_size > ring_size)
+    {
+        _head += ring_size - position;
+        position = 0;
+    }
+    while (_head + aligned_size - _tail > ring_size)
+    {
+        if (_submitted.empty() && !_recording.has_value())
+        {
+            // nothing is being copied, the whole ring is free
+            _tail = _head;
+            break;
+        }
+        if (_submitted.empty())
+        {
+            // the space is used by the copies being recorded
+            _submit();
+        }
+        _release(true);
+    }
+    _head += aligned_size;
+    return position;
+}
+
+void StagingRing::_release(bool wait)
+{
+    if (_submitted.empty())
+    {
+        return;
+    }
+    if (wait)
+    {
+        VkSemaphoreWaitInfo waitInfo{};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &_vk_semaphore;
+        waitInfo.pValues = &_submitted.front().value;
+        vkWaitSemaphores(_gpu->_logical_device, &waitInfo, std::numeric_limits<uint64_t>::max());
+    }
+    uint64_t completed_value = 0;
+    vkGetSemaphoreCounterValue(_gpu->_logical_device, _vk_semaphore, &completed_value);
+    while (!_submitted.empty() && (_submitted.front().value <= completed_value))
+    {
+        Batch& batch = _submitted.front();
+        _tail = batch.end;
+        vkResetCommandBuffer(batch.command_buffer, 0);
+        _free_batches.push_back(batch);
+        _submitted.pop_front();
+    }
+}
+
+StagingRing::Batch& StagingRing::_recording_batch()
+{
+    if (_recording.has_value())
+    {
+        return _recording.value();
+    }
+    Batch batch;
+    if (_free_batches.size() > 0)
+    {
+        batch = _free_batches.back();
+        _free_batches.pop_back();
+    }
+    else
+    {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = _vk_command_pool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(_gpu->_logical_device, &allocInfo, &batch.command_buffer) != VK_SUCCESS)
+        {
+            THROW_ERROR("failed to allocate command buffers!");
+        }
+    }
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (vkBeginCommandBuffer(batch.command_buffer, &beginInfo) != VK_SUCCESS)
+    {
+        THROW_ERROR("failed to begin recording command buffer!");
+    }
+    _recording = batch;
+    return _recording.value();
+}
+
+void StagingRing::_submit()
+{
+    if (!_recording.has_value())
+    {
+        return;
+    }
+    Batch batch = _recording.value();
+    _recording.reset();
+    batch.end = _head;
+    batch.value = _submitted_value + 1;
+    if (vkEndCommandBuffer(batch.command_buffer) != VK_SUCCESS)
+    {
+        THROW_ERROR("failed to record command buffer!");
+    }
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.signalSemaphoreValueCount = 1;
+    timelineInfo.pSignalSemaphoreValues = &batch.value;
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &batch.command_buffer;
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores = &_vk_semaphore;
+    {
+        std::lock_guard<std::mutex> queue_lock(_gpu->_queues_mutex);
+        if (vkQueueSubmit(std::get<1>(_gpu->_transfer_queue.value()), 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+        {
+            THROW_ERROR("failed to submit copy command buffer!");
+        }
+    }
+    _submitted_value = batch.value;
+    _submitted.push_back(batch);
+}
@@ -151,7 +151,10 @@ SwapChain::SwapChain(const GPU* _gpu, const Window& window) : gpu(_gpu)
 
 SwapChain::~SwapChain()
 {
-    vkDeviceWaitIdle(gpu->_logical_device);
+    {
+        std::lock_guard<std::mutex> lock(gpu->_queues_mutex);
+        vkDeviceWaitIdle(gpu->_logical_device);
+    }
     while (_frame_available_semaphores.size() > 0)
     {
         vkDestroySemaphore(gpu->_logical_device, _frame_available_semaphores.front().first, nullptr);
@@ -183,7 +186,10 @@ void SwapChain::present_frame()
     presentInfo.pSwapchains = &_vk_swap_chain;
     presentInfo.pImageIndices = &i;
     presentInfo.pResults = &result; // Optional
-    vkQueuePresentKHR(std::get<1>(gpu->_present_queue.value()), &presentInfo);
+    {
+        std::lock_guard<std::mutex> lock(gpu->_queues_mutex);
+        vkQueuePresentKHR(std::get<1>(gpu->_present_queue.value()), &presentInfo);
+    }
     if (result != VK_SUCCESS)
     {
         THROW_ERROR("Failed to present swapchaoin image to screen with VkResult code : " + std::to_string(result));
@@ -0,0 +1,479 @@
+#include <RenderEngine/graphics/model/BoundingVolumeHierarchy.hpp>
+#include <RenderEngine/graphics/Frustum.hpp>
+#include <algorithm>
+#include <thread>
+#include <cmath>
+using namespace RenderEngine;
+
+namespace
+{
+    const std::uint32_t max_leaf_size = 4; // leafs are not split below this number of models
+    const std::uint32_t bins_count = 16; // number of bins of the surface area heuristic
+    const std::uint32_t parallel_threshold = 4096; // subtrees with less models are built in the calling thread
+
+    BoundingBox node_box(const BoundingVolumeHierarchy::Node& node)
+    {
+        return BoundingBox(Vector(node.lower[0], node.lower[1], node.lower[2]), Vector(node.upper[0], node.upper[1], node.upper[2]));
+    }
+
+    void set_node_box(BoundingVolumeHierarchy::Node& node, const BoundingBox& box)
+    {
+        // rounding toward the outside, so that the float box contains the double box
+        node.lower[0] = std::nextafter(static_cast<float>(box.lower.x), -std::numeric_limits<float>::infinity());
+        node.lower[1] = std::nextafter(static_cast<float>(box.lower.y), -std::numeric_limits<float>::infinity());
+        node.lower[2] = std::nextafter(static_cast<float>(box.lower.z), -std::numeric_limits<float>::infinity());
+        node.upper[0] = std::nextafter(static_cast<float>(box.upper.x), std::numeric_limits<float>::infinity());
+        node.upper[1] = std::nextafter(static_cast<float>(box.upper.y), std::numeric_limits<float>::infinity());
+        node.upper[2] = std::nextafter(static_cast<float>(box.upper.z), std::numeric_limits<float>::infinity());
+    }
+
+    double surface_area(const BoundingBox& box)
+    {
+        if (box.is_empty())
+        {
+            return 0.;
+        }
+        Vector d = box.upper - box.lower;
+        return 2. * (d.x*d.y + d.y*d.z + d.z*d.x);
+    }
+
+    double axis_coordinate(const Vector& vector, unsigned int axis)
+    {
+        return (axis == 0) ? vector.x : ((axis == 1) ? vector.y : vector.z);
+    }
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+{
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const std::vector<const Model*>& models)
+{
+    build(models);
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+}
+
+void BoundingVolumeHierarchy::build(const std::vector<const Model*>& models)
+{
+    _nodes.clear();
+    _models.clear();
+    _boxes.clear();
+    _indexes.clear();
+    for (const Model* model : models)
+    {
+        if (model->mesh != nullptr)
+        {
+            _models.push_back(model);
+        }
+    }
+    _boxes.resize(_models.size());
+    for (std::size_t i=0; i<_models.size(); i++)
+    {
+        _boxes[i] = _models[i]->absolute_bounding_box();
+    }
+    // build the tree, with one thread per subtree for the first levels
+    unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int parallel_depth = 0;
+    while ((1u << parallel_depth) < threads)
+    {
+        parallel_depth++;
+    }
+    _nodes.reserve(2 * _models.size());
+    _nodes.push_back(Node());
+    set_node_box(_nodes[0], BoundingBox());
+    _nodes[0].first = 0;
+    _nodes[0].count = 0;
+    if (_models.size() > 0)
+    {
+        _build_subtree(_nodes, 0, 0, static_cast<std::uint32_t>(_models.size()), parallel_depth);
+    }
+    // parents of the nodes, leafs of the models, and index of the models
+    _parents.assign(_nodes.size(), 0);
+    _leafs.assign(_models.size(), 0);
+    for (std::uint32_t i=0; i<_nodes.size(); i++)
+    {
+        const Node& node = _nodes[i];
+        if (node.count == 0)
+        {
+            if (i == 0 && _models.size() == 0)
+            {
+                continue;
+            }
+            _parents[node.first] = i;
+            _parents[node.first+1] = i;
+        }
+        else
+        {
+            for (std::uint32_t j=node.first; j<node.first+node.count; j++)
+            {
+                _leafs[j] = i;
+            }
+        }
+    }
+    for (std::uint32_t i=0; i<_models.size(); i++)
+    {
+        _indexes[_models[i]] = i;
+    }
+}
+
+void BoundingVolumeHierarchy::refit()
+{
+    for (std::size_t i=0; i<_models.size(); i++)
+    {
+        _boxes[i] = _models[i]->absolute_bounding_box();
+    }
+    // childrens are always stored after their parent
+    for (std::size_t i=_nodes.size(); i>0; i--)
+    {
+        _fit_node(i-1);
+    }
+}
+
+void BoundingVolumeHierarchy::refit(const std::vector<const Model*>& moved)
+{
+    for (const Model* model : moved)
+    {
+        std::unordered_map<const Model*, std::uint32_t>::const_iterator it = _indexes.find(model);
+        if (it == _indexes.end())
+        {
+            continue;
+        }
+        _boxes[it->second] = model->absolute_bounding_box();
+        // walk up the tree until a box is left unchanged
+        std::uint32_t node = _leafs[it->second];
+        while (_fit_node(node) && node != 0)
+        {
+            node = _parents[node];
+        }
+    }
+}
+
+std::vector<const Model*> BoundingVolumeHierarchy::query_box(const BoundingBox& box) const
+{
+    return _query([&box](const BoundingBox& other) -> bool
+    {
+        return !other.is_empty()
+            && other.lower.x <= box.upper.x && box.lower.x <= other.upper.x
+            && other.lower.y <= box.upper.y && box.lower.y <= other.upper.y
+            && other.lower.z <= box.upper.z && box.lower.z <= other.upper.z;
+    });
+}
+
+std::vector<const Model*> BoundingVolumeHierarchy::query_sphere(const BoundingSphere& sphere) const
+{
+    return _query([&sphere](const BoundingBox& box) -> bool
+    {
+        if (box.is_empty() || sphere.is_empty())
+        {
+            return false;
+        }
+        const Vector& c = sphere.center;
+        Vector closest(std::max(box.lower.x, std::min(c.x, box.upper.x)),
+                       std::max(box.lower.y, std::min(c.y, box.upper.y)),
+                       std::max(box.lower.z, std::min(c.z, box.upper.z)));
+        return (closest - c).squared_norm() <= sphere.radius * sphere.radius;
+    });
+}
+
+std::vector<const Model*> BoundingVolumeHierarchy::query_frustum(const Camera& camera, double aspect_ratio) const
+{
+    Frustum frustum(camera, aspect_ratio);
+    Transform world_to_camera = camera.absolute_transform().inverse();
+    return _query([&frustum, &world_to_camera](const BoundingBox& box) -> bool
+    {
+        return frustum.intersects(box.transformed(world_to_camera));
+    });
+}
+
+std::vector<std::pair<const Model*, double>> BoundingVolumeHierarchy::query_ray(const Vector& origin, const Vector& direction, double max_distance) const
+{
+    std::vector<std::pair<const Model*, double>> hits;
+    if (_models.size() == 0)
+    {
+        return hits;
+    }
+    Vector inverse_direction = 1. / direction;
+    // slab test, returns the distance at which the ray enters the box, or a negative value if it misses it
+    auto entry_distance = [&](const BoundingBox& box) -> double
+    {
+        double t_min = 0.;
+        double t_max = max_distance;
+        for (unsigned int axis=0; axis<3; axis++)
+        {
+            double o = axis_coordinate(origin, axis);
+            double inverse = axis_coordinate(inverse_direction, axis);
+            double t1 = (axis_coordinate(box.lower, axis) - o) * inverse;
+            double t2 = (axis_coordinate(box.upper, axis) - o) * inverse;
+            if (std::isnan(t1) || std::isnan(t2)) // ray parallel to the slab, and origin on its boundary
+            {
+                continue;
+            }
+            t_min = std::max(t_min, std::min(t1, t2));
+            t_max = std::min(t_max, std::max(t1, t2));
+        }
+        return (t_min <= t_max) ? t_min : -1.;
+    };
+    std::vector<std::uint32_t> stack = {0};
+    while (stack.size() > 0)
+    {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (entry_distance(node_box(node)) < 0.)
+        {
+            continue;
+        }
+        if (node.count == 0)
+        {
+            stack.push_back(node.first);
+            stack.push_back(node.first+1);
+            continue;
+        }
+        for (std::uint32_t i=node.first; i<node.first+node.count; i++)
+        {
+            double distance = entry_distance(_boxes[i]);
+            if (distance >= 0.)
+            {
+                hits.emplace_back(_models[i], distance);
+            }
+        }
+    }
+    std::sort(hits.begin(), hits.end(), [](const std::pair<const Model*, double>& a, const std::pair<const Model*, double>& b) {return a.second < b.second;});
+    return hits;
+}
+
+bool BoundingVolumeHierarchy::ray_cast(const Vector& origin, const Vector& direction, RayHit& hit, double max_distance) const
+{
+    bool found = false;
+    double best = max_distance;
+    // the distance along the ray is preserved by affine transforms, so each mesh is tested in its own coordinates
+    for (const std::pair<const Model*, double>& candidate : query_ray(origin, direction, max_distance))
+    {
+        if (candidate.second >= best)
+        {
+            break;
+        }
+        const Model* model = candidate.first;
+        Transform to_mesh = model->absolute_transform().inverse();
+        TriangleHit triangle_hit;
+        if (model->mesh->ray_cast(Vectorf(to_mesh * origin), Vectorf(to_mesh.apply_to_direction(direction)), static_cast<float>(std::min(best, static_cast<double>(std::numeric_limits<float>::max()))), triangle_hit))
+        {
+            found = true;
+            best = triangle_hit.distance;
+            hit.model = model;
+            hit.triangle = triangle_hit.triangle;
+            hit.distance = triangle_hit.distance;
+            hit.u = triangle_hit.u;
+            hit.v = triangle_hit.v;
+            hit.uv = model->mesh->hit_UV(triangle_hit);
+            hit.position = origin + direction * hit.distance;
+        }
+    }
+    return found;
+}
+
+bool BoundingVolumeHierarchy::pick(const Camera& camera, double x, double y, uint32_t width, uint32_t height, RayHit& hit) const
+{
+    std::tuple<Vector, Vector, double> ray = camera.ray(x, y, width, height);
+    return ray_cast(std::get<0>(ray), std::get<1>(ray), hit, std::get<2>(ray));
+}
+
+const std::vector<BoundingVolumeHierarchy::Node>& BoundingVolumeHierarchy::nodes() const
+{
+    return _nodes;
+}
+
+const std::vector<const Model*>& BoundingVolumeHierarchy::models() const
+{
+    return _models;
+}
+
+void BoundingVolumeHierarchy::_build_subtree(std::vector<Node>& nodes, std::size_t root, std::uint32_t begin, std::uint32_t end, unsigned int parallel_depth)
+{
+    // bounds of the boxes and of their centers
+    BoundingBox bounds;
+    BoundingBox centers;
+    for (std::uint32_t i=begin; i<end; i++)
+    {
+        bounds = bounds.merged(_boxes[i]);
+        centers = centers.expanded(_boxes[i].center());
+    }
+    std::uint32_t count = end - begin;
+    set_node_box(nodes[root], bounds);
+    nodes[root].first = begin;
+    nodes[root].count = count;
+    if (count <= 2)
+    {
+        return;
+    }
+    // split along the axis on which the centers are the most spread
+    Vector extent = centers.upper - centers.lower;
+    unsigned int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : ((extent.y >= extent.z) ? 1 : 2);
+    double lower = axis_coordinate(centers.lower, axis);
+    double width = axis_coordinate(extent, axis);
+    std::uint32_t split = begin + count / 2;
+    if (width > 0.)
+    {
+        // binned surface area heuristic
+        auto bin_of = [&](const BoundingBox& box) -> std::uint32_t
+        {
+            double position = (axis_coordinate(box.center(), axis) - lower) / width;
+            return std::min(bins_count - 1, static_cast<std::uint32_t>(position * bins_count));
+        };
+        BoundingBox bin_boxes[bins_count];
+        std::uint32_t bin_counts[bins_count] = {};
+        for (std::uint32_t i=begin; i<end; i++)
+        {
+            std::uint32_t bin = bin_of(_boxes[i]);
+            bin_boxes[bin] = bin_boxes[bin].merged(_boxes[i]);
+            bin_counts[bin]++;
+        }
+        // cost of splitting after each bin, sweeping from the right then from the left
+        double right_costs[bins_count] = {};
+        BoundingBox right_box;
+        std::uint32_t right_count = 0;
+        for (std::uint32_t b=bins_count-1; b>0; b--)
+        {
+            right_box = right_box.merged(bin_boxes[b]);
+            right_count += bin_counts[b];
+            right_costs[b-1] = surface_area(right_box) * right_count;
+        }
+        double best_cost = std::numeric_limits<double>::infinity();
+        std::uint32_t best_bin = 0;
+        BoundingBox left_box;
+        std::uint32_t left_count = 0;
+        for (std::uint32_t b=0; b<bins_count-1; b++)
+        {
+            left_box = left_box.merged(bin_boxes[b]);
+            left_count += bin_counts[b];
+            double cost = surface_area(left_box) * left_count + right_costs[b];
+            if (left_count > 0 && left_count < count && cost < best_cost)
+            {
+                best_cost = cost;
+                best_bin = b;
+            }
+        }
+        // traversing a node costs about as much as testing one model
+        double parent_area = surface_area(bounds);
+        double split_cost = 1. + ((parent_area > 0.) ? best_cost / parent_area : count);
+        if (split_cost >= count && count <= max_leaf_size)
+        {
+            return;
+        }
+        const Model** models = _models.data();
+        BoundingBox* boxes = _boxes.data();
+        std::uint32_t j = begin;
+        for (std::uint32_t i=begin; i<end; i++)
+        {
+            if (bin_of(boxes[i]) <= best_bin)
+            {
+                std::swap(models[i], models[j]);
+                std::swap(boxes[i], boxes[j]);
+                j++;
+            }
+        }
+        split = j;
+    }
+    else if (count <= max_leaf_size)
+    {
+        return;
+    }
+    // create the two childrens
+    std::uint32_t first = static_cast<std::uint32_t>(nodes.size());
+    nodes[root].first = first;
+    nodes[root].count = 0;
+    nodes.push_back(Node());
+    nodes.push_back(Node());
+    if (parallel_depth > 0 && count >= parallel_threshold)
+    {
+        // the second child is built in a separate array of nodes, appended once done. Both subtrees touch disjoint ranges of models.
+        std::vector<Node> second_nodes(1);
+        second_nodes.reserve(2 * (end - split));
+        std::thread thread([&]() {_build_subtree(second_nodes, 0, split, end, parallel_depth-1);});
+        _build_subtree(nodes, first, begin, split, parallel_depth-1);
+        thread.join();
+        std::uint32_t offset = static_cast<std::uint32_t>(nodes.size()) - 1;
+        for (Node& node : second_nodes)
+        {
+            if (node.count == 0)
+            {
+                node.first += offset;
+            }
+        }
+        nodes[first+1] = second_nodes[0];
+        nodes.insert(nodes.end(), second_nodes.begin()+1, second_nodes.end());
+    }
+    else
+    {
+        _build_subtree(nodes, first, begin, split, 0);
+        _build_subtree(nodes, first+1, split, end, 0);
+    }
+}
+
+bool BoundingVolumeHierarchy::_fit_node(std::size_t index)
+{
+    Node& node = _nodes[index];
+    Node fitted = node;
+    if (node.count == 0)
+    {
+        if (index == 0 && _models.size() == 0)
+        {
+            return false;
+        }
+        const Node& left = _nodes[node.first];
+        const Node& right = _nodes[node.first+1];
+        for (unsigned int k=0; k<3; k++)
+        {
+            fitted.lower[k] = std::min(left.lower[k], right.lower[k]);
+            fitted.upper[k] = std::max(left.upper[k], right.upper[k]);
+        }
+    }
+    else
+    {
+        BoundingBox box;
+        for (std::uint32_t i=node.first; i<node.first+node.count; i++)
+        {
+            box = box.merged(_boxes[i]);
+        }
+        set_node_box(fitted, box);
+    }
+    bool changed = !std::equal(fitted.lower, fitted.lower+3, node.lower) || !std::equal(fitted.upper, fitted.upper+3, node.upper);
+    node = fitted;
+    return changed;
+}
+
+template<typename Predicate>
+std::vector<const Model*> BoundingVolumeHierarchy::_query(const Predicate& intersects) const
+{
+    std::vector<const Model*> result;
+    if (_models.size() == 0)
+    {
+        return result;
+    }
+    std::vector<std::uint32_t> stack = {0};
+    while (stack.size() > 0)
+    {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (!intersects(node_box(node)))
+        {
+            continue;
+        }
+        if (node.count == 0)
+        {
+            stack.push_back(node.first);
+            stack.push_back(node.first+1);
+            continue;
+        }
+        for (std::uint32_t i=node.first; i<node.first+node.count; i++)
+        {
+            if (intersects(_boxes[i]))
+            {
+                result.push_back(_models[i]);
+            }
+        }
+    }
+    return result;
+}
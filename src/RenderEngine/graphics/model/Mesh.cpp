@@ -1,19 +1,252 @@
 #include <RenderEngine/graphics/model/Mesh.hpp>
+#include <RenderEngine/graphics/model/MeshBuilder.hpp>
+#include <RenderEngine/graphics/Canvas.hpp>
+#include <RenderEngine/utilities/Parallel.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <RenderEngine/utilities/Functions.hpp>
+#include <unordered_map>
+#include <cstring>
+#include <algorithm>
+#include <cmath>
+#include <array>
 using namespace RenderEngine;
 
-Mesh::Mesh(const GPU* _gpu, const std::vector<Face>& faces)
+namespace
 {
-    _buffer.reset(new Buffer(_gpu, faces.size() * 3 * sizeof(Vertex), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT));
+    // Hash and equality of the bytes of a struct (Vertex or PaletteEntry), used to merge identical vertices and palette entries
+    template<typename T>
+    struct BytesHash
+    {
+        std::size_t operator()(const T& value) const
+        {
+            // FNV-1a over the 32 bits words of the struct
+            uint32_t words[sizeof(T) / sizeof(uint32_t)];
+            std::memcpy(words, &value, sizeof(T));
+            uint64_t hash = 14695981039346656037ULL;
+            for (uint32_t word : words)
+            {
+                hash = (hash ^ word) * 1099511628211ULL;
+            }
+            return static_cast<std::size_t>(hash ^ (hash >> 32));
+        }
+    };
+
+    template<typename T>
+    struct BytesEqual
+    {
+        bool operator()(const T& a, const T& b) const
+        {
+            return std::memcmp(&a, &b, sizeof(T)) == 0;
+        }
+    };
+
+    // Alignment of the meshlet descriptors in the buffer
+    constexpr std::size_t MESHLETS_ALIGNMENT = sizeof(vec4);
+
+    // Alignment of the regions of dynamic meshes, the largest 'nonCoherentAtomSize' allowed, so that flushing a region never touches its neighbours
+    constexpr std::size_t REGIONS_ALIGNMENT = 256;
+
+    // Beyond this number of stale ranges in a region, they are merged in a single range
+    constexpr std::size_t MAX_STALE_RANGES = 16;
+
+    // Adds the range [offset, offset+size) to the stale ranges of a region, merging the ranges it overlaps or touches
+    void add_stale_range(std::vector<std::pair<std::size_t, std::size_t>>& stale, std::size_t offset, std::size_t size)
+    {
+        std::size_t begin = offset;
+        std::size_t end = offset + size;
+        std::vector<std::pair<std::size_t, std::size_t>> merged;
+        for (const std::pair<std::size_t, std::size_t>& range : stale)
+        {
+            if (range.first <= end && begin <= range.first + range.second)
+            {
+                begin = std::min(begin, range.first);
+                end = std::max(end, range.first + range.second);
+            }
+            else
+            {
+                merged.push_back(range);
+            }
+        }
+        merged.emplace_back(begin, end - begin);
+        if (merged.size() > MAX_STALE_RANGES)
+        {
+            for (const std::pair<std::size_t, std::size_t>& range : merged)
+            {
+                begin = std::min(begin, range.first);
+                end = std::max(end, range.first + range.second);
+            }
+            merged = {{begin, end - begin}};
+        }
+        stale = std::move(merged);
+    }
+
+    // Size in bytes reserved for a palette, rounded up to the alignment of storage buffer ranges
+    std::size_t palette_bytes_size(std::size_t entries_count, std::size_t alignment)
+    {
+        std::size_t bytes_size = std::max(entries_count, static_cast<std::size_t>(1)) * sizeof(PaletteEntry);
+        alignment = std::max(alignment, static_cast<std::size_t>(1));
+        return ((bytes_size + alignment - 1) / alignment) * alignment;
+    }
+
+    // Quantizes a value of [-1, 1] (SNORM16) or [0, 1] (UNORM16), rounding to nearest
+    int16_t to_snorm16(float value)
+    {
+        return static_cast<int16_t>(std::lround(std::max(-1.f, std::min(value, 1.f)) * 32767.f));
+    }
+
+    uint16_t to_unorm16(float value)
+    {
+        return static_cast<uint16_t>(std::lround(std::max(0.f, std::min(value, 1.f)) * 65535.f));
+    }
+
+    // Projects a direction on the octahedron |x|+|y|+|z| = 1, whose lower half is folded over the upper one, to a point of the [-1, 1] square.
+    // A null direction is encoded as (0, 0, 1).
+    vec2 octahedral_encode(const vec3& direction)
+    {
+        float norm = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+        if (norm == 0.f)
+        {
+            return {0.f, 0.f};
+        }
+        vec2 encoded = {direction.x / norm, direction.y / norm};
+        if (direction.z < 0.f)
+        {
+            encoded = {(1.f - std::abs(encoded.y)) * (encoded.x >= 0.f ? 1.f : -1.f),
+                       (1.f - std::abs(encoded.x)) * (encoded.y >= 0.f ? 1.f : -1.f)};
+        }
+        return encoded;
+    }
+}
+
+Mesh::Mesh(const GPU* gpu, const std::vector<Face>& faces, bool indexed, VertexFormat format, bool levels_of_detail, bool meshlets)
+{
+    _indexed = indexed;
+    _vertex_format = format;
+    _generate_levels_of_detail = levels_of_detail;
+    _generate_meshlets = meshlets;
+    std::vector<PaletteEntry> palette;
+    std::vector<uint32_t> palette_indices = faces_palette(faces, palette);
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    if (_indexed)
+    {
+        std::vector<Vertex> all_vertices(faces.size() * 3);
+        faces_vertices(faces, palette_indices, all_vertices.data());
+        weld_vertices(all_vertices, vertices, indices);
+        _bytes_size = _required_bytes_size(vertices.size(), indices.size());
+    }
+    else
+    {
+        _bytes_size = _required_bytes_size(faces.size() * 3, 0);
+    }
+    _buffer.reset(new Buffer(gpu, _bytes_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, Buffer::DEVICE_LOCAL));
+    _offset = 0;
+    _palette_capacity = std::max(palette.size(), static_cast<std::size_t>(1));
+    _palette_buffer.reset(new Buffer(gpu, palette_bytes_size(palette.size(), 1), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+    upload_palette(palette);
+    if (_indexed)
+    {
+        upload(vertices, indices);
+    }
+    else
+    {
+        // non indexed vertices are converted in place in the buffer
+        MeshBuilder builder(*this, faces.size() * 3);
+        faces_vertices(faces, palette_indices, builder.vertices());
+        builder.finish();
+    }
+}
+
+Mesh::Mesh(const GPU* gpu, const std::vector<Vertex>& vertices, const std::vector<PaletteEntry>& palette, const std::vector<uint32_t>& indices, VertexFormat format,
+           bool levels_of_detail, bool meshlets)
+{
+    _indexed = (indices.size() > 0);
+    _vertex_format = format;
+    _generate_levels_of_detail = levels_of_detail;
+    _generate_meshlets = meshlets;
+    _bytes_size = _required_bytes_size(vertices.size(), indices.size());
+    _buffer.reset(new Buffer(gpu, _bytes_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, Buffer::DEVICE_LOCAL));
     _offset = 0;
-    _bytes_size = faces.size() * sizeof(Vertex) * 3;
-    upload(faces);
+    _palette_capacity = std::max(palette.size(), static_cast<std::size_t>(1));
+    _palette_buffer.reset(new Buffer(gpu, palette_bytes_size(palette.size(), 1), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+    upload_palette(palette);
+    upload(vertices, indices);
+}
+
+Mesh::Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, const std::vector<Face>& faces, VertexFormat format, bool levels_of_detail, bool meshlets)
+{
+    _buffer = buffer;
+    _offset = offset;
+    _vertex_format = format;
+    _generate_levels_of_detail = levels_of_detail;
+    _generate_meshlets = meshlets;
+    _bytes_size = _required_bytes_size(faces.size() * 3, 0);
+    std::vector<PaletteEntry> palette;
+    faces_palette(faces, palette);
+    _palette_capacity = std::max(palette.size(), static_cast<std::size_t>(1));
+    _palette_buffer.reset(new Buffer(buffer->gpu, palette_bytes_size(palette.size(), 1), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+    upload_palette(palette);
+}
+
+Mesh::Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+           const std::shared_ptr<Buffer>& palette_buffer, std::size_t palette_offset, const std::vector<PaletteEntry>& palette, VertexFormat format,
+           bool levels_of_detail, bool meshlets)
+{
+    _buffer = buffer;
+    _offset = offset;
+    _indexed = (indices.size() > 0);
+    _vertex_format = format;
+    _generate_levels_of_detail = levels_of_detail;
+    _generate_meshlets = meshlets;
+    _bytes_size = _required_bytes_size(vertices.size(), indices.size());
+    _palette_buffer = palette_buffer;
+    _palette_offset = palette_offset;
+    _palette_capacity = std::max(palette.size(), static_cast<std::size_t>(1));
+    upload_palette(palette);
+    upload(vertices, indices);
 }
 
-Mesh::Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, const std::vector<Face>& faces)
+Mesh::Mesh(const std::shared_ptr<Buffer>& buffer, std::size_t offset, std::size_t vertices_count, std::size_t indices_count,
+           const std::shared_ptr<Buffer>& palette_buffer, std::size_t palette_offset, std::size_t palette_capacity, VertexFormat format,
+           bool levels_of_detail, bool meshlets)
 {
     _buffer = buffer;
     _offset = offset;
-    _bytes_size = faces.size() * sizeof(Vertex) * 3;
+    _indexed = (indices_count > 0);
+    _vertex_format = format;
+    _generate_levels_of_detail = levels_of_detail;
+    _generate_meshlets = meshlets;
+    _bytes_size = _required_bytes_size(vertices_count, indices_count);
+    _palette_buffer = palette_buffer;
+    _palette_offset = palette_offset;
+    _palette_capacity = std::max(palette_capacity, static_cast<std::size_t>(1));
+}
+
+Mesh::Mesh(const GPU* gpu, std::size_t vertices_count, std::size_t indices_count, const std::vector<PaletteEntry>& palette, std::size_t regions,
+           VertexFormat format, bool levels_of_detail, bool meshlets)
+{
+    if (regions < 2)
+    {
+        THROW_ERROR("A dynamic mesh needs at least two regions");
+    }
+    _indexed = (indices_count > 0);
+    _vertex_format = format;
+    _generate_levels_of_detail = levels_of_detail;
+    _generate_meshlets = meshlets;
+    _bytes_size = _required_bytes_size(vertices_count, indices_count);
+    _region_stride = ((_bytes_size + REGIONS_ALIGNMENT - 1) / REGIONS_ALIGNMENT) * REGIONS_ALIGNMENT;
+    _regions = std::make_shared<std::vector<DynamicRegion>>(regions);
+    // the regions are written directly in mapped memory at each upload, without going through the staging ring
+    _buffer.reset(new Buffer(gpu, std::max(_region_stride * regions, static_cast<std::size_t>(1)), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, Buffer::HOST_VISIBLE));
+    _offset = 0;
+    // the palette is written once, as it is not copied in the regions
+    _palette_capacity = std::max(palette.size(), static_cast<std::size_t>(1));
+    _palette_buffer.reset(new Buffer(gpu, palette_bytes_size(palette.size(), 1), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+    if (palette.size() > 0)
+    {
+        _palette_buffer->upload(palette.data(), palette.size() * sizeof(PaletteEntry), 0);
+    }
+    _palette = palette;
 }
 
 Mesh::~Mesh()
@@ -21,44 +254,696 @@ Mesh::~Mesh()
 }
 
 void Mesh::upload(const std::vector<Face>& faces)
+{
+    std::vector<PaletteEntry> palette;
+    std::vector<uint32_t> palette_indices = faces_palette(faces, palette);
+    if (_regions != nullptr)
+    {
+        // the palette of a dynamic mesh can not be replaced: the faces' entries are looked up in it
+        std::unordered_map<PaletteEntry, uint32_t, BytesHash<PaletteEntry>, BytesEqual<PaletteEntry>> entry_index;
+        for (std::size_t i=0; i<_palette.size(); i++)
+        {
+            entry_index.emplace(_palette[i], static_cast<uint32_t>(i));
+        }
+        std::vector<uint32_t> mesh_indices(palette.size());
+        for (std::size_t i=0; i<palette.size(); i++)
+        {
+            std::unordered_map<PaletteEntry, uint32_t, BytesHash<PaletteEntry>, BytesEqual<PaletteEntry>>::const_iterator found = entry_index.find(palette[i]);
+            if (found == entry_index.end())
+            {
+                THROW_ERROR("The uploaded faces have a color or material missing from the dynamic mesh's palette");
+            }
+            mesh_indices[i] = found->second;
+        }
+        for (uint32_t& index : palette_indices)
+        {
+            index = mesh_indices[index];
+        }
+    }
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    if (_indexed)
+    {
+        std::vector<Vertex> all_vertices(faces.size() * 3);
+        faces_vertices(faces, palette_indices, all_vertices.data());
+        weld_vertices(all_vertices, vertices, indices);
+    }
+    std::size_t vertices_count = _indexed ? vertices.size() : faces.size() * 3;
+    if (_required_bytes_size(vertices_count, indices.size()) > _bytes_size || palette.size() > _palette_capacity)
+    {
+        THROW_ERROR("The uploaded faces do not fit in the mesh's ranges of the buffers");
+    }
+    if (_regions == nullptr)
+    {
+        // the previous vertices are replaced, so their palette entries do not need to be kept
+        _palette_entries_used = 0;
+        upload_palette(palette);
+    }
+    if (_indexed)
+    {
+        upload(vertices, indices);
+    }
+    else
+    {
+        MeshBuilder builder(*this, vertices_count);
+        faces_vertices(faces, palette_indices, builder.vertices());
+        builder.finish();
+    }
+}
+
+void Mesh::upload(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
+{
+    if (_required_bytes_size(vertices.size(), indices.size()) > _bytes_size)
+    {
+        THROW_ERROR("The uploaded vertices and indices do not fit in the mesh's range of the buffer");
+    }
+    if (_regions != nullptr)
+    {
+        _use_region(_acquire_region());
+    }
+    _commit(vertices.data(), vertices.size(), indices.data(), indices.size(), false);
+}
+
+void Mesh::upload_range(std::size_t first_vertex, const std::vector<Vertex>& vertices)
+{
+    if (_regions == nullptr || _vertex_format != STANDARD || _generate_levels_of_detail || _generate_meshlets)
+    {
+        THROW_ERROR("Only dynamic STANDARD meshes without levels of detail or meshlets can be partially uploaded");
+    }
+    if (first_vertex + vertices.size() > _vertices_count)
+    {
+        THROW_ERROR("The uploaded vertices are out of the mesh's vertices");
+    }
+    uint32_t palette_entries_used = _palette_entries_used;
+    for (const Vertex& vertex : vertices)
+    {
+        palette_entries_used = std::max(palette_entries_used, vertex.palette + 1);
+    }
+    if (palette_entries_used > _palette.size())
+    {
+        THROW_ERROR("The uploaded vertices reference entries missing from the mesh's palette");
+    }
+    _palette_entries_used = palette_entries_used;
+    if (vertices.size() == 0)
+    {
+        return;
+    }
+    std::copy(vertices.begin(), vertices.end(), _dynamic_vertices.begin() + first_vertex);
+    // all the regions miss the modified vertices, then the acquired region is brought up to date
+    std::size_t offset = first_vertex * sizeof(Vertex);
+    for (DynamicRegion& region : *_regions)
+    {
+        add_stale_range(region.stale, offset, vertices.size() * sizeof(Vertex));
+    }
+    std::size_t region = _acquire_region();
+    std::size_t region_offset = region * _region_stride;
+    std::size_t vertices_bytes = _vertices_count * sizeof(Vertex);
+    const uint8_t* vertices_bytes_data = reinterpret_cast<const uint8_t*>(_dynamic_vertices.data());
+    const uint8_t* indices_bytes_data = reinterpret_cast<const uint8_t*>(_indices.data());
+    std::vector<std::pair<std::size_t, std::size_t>>& stale = (*_regions)[region].stale;
+    for (const std::pair<std::size_t, std::size_t>& range : stale)
+    {
+        // a range can span the end of the vertices and the beginning of the indices
+        std::size_t begin = range.first;
+        std::size_t end = range.first + range.second;
+        if (begin < vertices_bytes)
+        {
+            std::memcpy(_buffer->mapped(region_offset + begin), vertices_bytes_data + begin, std::min(end, vertices_bytes) - begin);
+        }
+        if (end > vertices_bytes)
+        {
+            std::size_t indices_begin = std::max(begin, vertices_bytes);
+            std::memcpy(_buffer->mapped(region_offset + indices_begin), indices_bytes_data + (indices_begin - vertices_bytes), end - indices_begin);
+        }
+        _buffer->flush(range.second, region_offset + range.first);
+    }
+    stale.clear();
+    _use_region(region);
+    // grow the bounding volumes to contain the modified vertices, so that the update does not depend on the size of the mesh
+    std::array<std::vector<float>, 3> positions;
+    for (std::vector<float>& coordinates : positions)
+    {
+        coordinates.resize(vertices.size());
+    }
+    for (std::size_t i=0; i<vertices.size(); i++)
+    {
+        positions[0][i] = vertices[i].position.x;
+        positions[1][i] = vertices[i].position.y;
+        positions[2][i] = vertices[i].position.z;
+        _UVs[first_vertex + i] = vertices[i].uv;
+    }
+    _bounding_box = _bounding_box.merged(BoundingBox::from_points(positions[0].data(), positions[1].data(), positions[2].data(), vertices.size()));
+    _bounding_sphere = _bounding_sphere.merged(BoundingSphere::from_points(positions[0].data(), positions[1].data(), positions[2].data(), vertices.size()));
+    // update the ray cast geometry if it was not moved to the triangle hierarchy, otherwise it is gathered again from the vertices on next ray cast
+    std::lock_guard<std::mutex> lock(_triangle_hierarchy_mutex);
+    if (_positions[0].size() == _dynamic_vertices.size())
+    {
+        for (std::size_t k=0; k<3; k++)
+        {
+            std::copy(positions[k].begin(), positions[k].end(), _positions[k].begin() + first_vertex);
+        }
+    }
+    _triangle_hierarchy.reset();
+}
+
+void Mesh::upload_palette(const std::vector<PaletteEntry>& palette)
+{
+    if (_regions != nullptr)
+    {
+        THROW_ERROR("The palette of a dynamic mesh can not be replaced, as it may still be read by the GPU");
+    }
+    if (palette.size() > _palette_capacity)
+    {
+        THROW_ERROR("The uploaded palette does not fit in the mesh's range of the palette buffer");
+    }
+    if (palette.size() < _palette_entries_used)
+    {
+        THROW_ERROR("The uploaded palette is missing entries referenced by the mesh's vertices");
+    }
+    if (palette.size() > 0)
+    {
+        _palette_buffer->upload(palette.data(), palette.size() * sizeof(PaletteEntry), _palette_offset);
+    }
+    _palette = palette;
+}
+
+const std::vector<PaletteEntry>& Mesh::palette() const
+{
+    return _palette;
+}
+
+std::size_t Mesh::bytes_size() const
+{
+    return _bytes_size;
+}
+
+std::size_t Mesh::offset() const
+{
+    return _offset;
+}
+
+bool Mesh::dynamic() const
+{
+    return _regions != nullptr;
+}
+
+bool Mesh::indexed() const
+{
+    return _indexed;
+}
+
+Mesh::VertexFormat Mesh::vertex_format() const
+{
+    return _vertex_format;
+}
+
+std::size_t Mesh::vertex_size() const
+{
+    return vertex_size(_vertex_format);
+}
+
+uint32_t Mesh::vertices_count() const
+{
+    return _vertices_count;
+}
+
+uint32_t Mesh::indices_count() const
+{
+    return _indices_count;
+}
+
+const std::vector<Mesh::LevelOfDetail>& Mesh::levels_of_detail() const
+{
+    return _levels_of_detail;
+}
+
+const Mesh::LevelOfDetail* Mesh::level_of_detail(float max_error) const
+{
+    const LevelOfDetail* level = nullptr;
+    for (const LevelOfDetail& coarser : _levels_of_detail)
+    {
+        if (coarser.error >= max_error)
+        {
+            break;
+        }
+        level = &coarser;
+    }
+    return level;
+}
+
+const std::vector<Meshlet>& Mesh::meshlets() const
+{
+    return _meshlets;
+}
+
+const BoundingBox& Mesh::bounding_box() const
+{
+    return _bounding_box;
+}
+
+const BoundingSphere& Mesh::bounding_sphere() const
+{
+    return _bounding_sphere;
+}
+
+bool Mesh::ray_cast(const Vectorf& origin, const Vectorf& direction, float max_distance, TriangleHit& hit) const
+{
+    std::shared_ptr<const TriangleHierarchy> triangle_hierarchy;
+    {
+        std::lock_guard<std::mutex> lock(_triangle_hierarchy_mutex);
+        if (_triangle_hierarchy == nullptr)
+        {
+            if (_positions[0].empty() && !_dynamic_vertices.empty())
+            {
+                // the positions of a dynamic mesh partially uploaded since the last ray cast
+                for (std::vector<float>& coordinates : _positions)
+                {
+                    coordinates.resize(_dynamic_vertices.size());
+                }
+                for (std::size_t i=0; i<_dynamic_vertices.size(); i++)
+                {
+                    _positions[0][i] = _dynamic_vertices[i].position.x;
+                    _positions[1][i] = _dynamic_vertices[i].position.y;
+                    _positions[2][i] = _dynamic_vertices[i].position.z;
+                }
+            }
+            // the hierarchy expects the three vertices of each triangle
+            std::size_t corners_count = (_indices.size() > 0) ? _indices.size() : _UVs.size();
+            std::array<std::vector<float>, 3> corners;
+            for (std::size_t k=0; k<3; k++)
+            {
+                if (_indices.size() > 0)
+                {
+                    corners[k].resize(corners_count);
+                    for (std::size_t i=0; i<corners_count; i++)
+                    {
+                        corners[k][i] = _positions[k][_indices[i]];
+                    }
+                }
+                else
+                {
+                    corners[k] = std::move(_positions[k]);
+                }
+            }
+            _triangle_hierarchy = std::make_shared<const TriangleHierarchy>(corners[0].data(), corners[1].data(), corners[2].data(), corners_count / 3);
+            // the positions are copied in the hierarchy
+            _positions = {};
+        }
+        triangle_hierarchy = _triangle_hierarchy;
+    }
+    return triangle_hierarchy->intersect(origin, direction, max_distance, hit);
+}
+
+UV Mesh::hit_UV(const TriangleHit& hit) const
+{
+    std::size_t i0 = 3*hit.triangle;
+    std::size_t i1 = 3*hit.triangle+1;
+    std::size_t i2 = 3*hit.triangle+2;
+    if (_indices.size() > 0)
+    {
+        i0 = _indices[i0];
+        i1 = _indices[i1];
+        i2 = _indices[i2];
+    }
+    const vec2& uv0 = _UVs[i0];
+    const vec2& uv1 = _UVs[i1];
+    const vec2& uv2 = _UVs[i2];
+    double w = 1. - hit.u - hit.v;
+    return UV(w*uv0.x + hit.u*uv1.x + hit.v*uv2.x, w*uv0.y + hit.u*uv1.y + hit.v*uv2.y);
+}
+
+void Mesh::_commit(const Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count, bool in_place)
+{
+    std::size_t vertices_bytes = vertices_count * vertex_size(_vertex_format);
+    // reorder the triangles so that each meshlet is a contiguous range of them, before anything depends on their order.
+    // If the mesh is built in place, the reordered indices (or the non compact vertices) are written back in the buffer.
+    std::vector<Meshlet> meshlets;
+    std::vector<Vertex> reordered_vertices;
+    std::vector<uint32_t> reordered_indices;
+    if (_generate_meshlets)
+    {
+        std::vector<uint32_t> triangles_order;
+        meshlets = Meshlets::build(vertices, vertices_count, (indices_count > 0) ? indices : nullptr, indices_count, triangles_order);
+        if (indices_count > 0)
+        {
+            reordered_indices.assign(indices, indices + indices_count);
+            for (std::size_t i=0; i<triangles_order.size(); i++)
+            {
+                std::memcpy(&reordered_indices[i*3], &indices[triangles_order[i]*3], 3 * sizeof(uint32_t));
+            }
+            indices = reordered_indices.data();
+            if (in_place)
+            {
+                std::memcpy(_buffer->mapped(_offset + vertices_bytes), indices, indices_count * sizeof(uint32_t));
+            }
+        }
+        else
+        {
+            reordered_vertices.assign(vertices, vertices + vertices_count);
+            for (std::size_t i=0; i<triangles_order.size(); i++)
+            {
+                std::memcpy(&reordered_vertices[i*3], &vertices[triangles_order[i]*3], 3 * sizeof(Vertex));
+            }
+            vertices = reordered_vertices.data();
+            if (in_place && _vertex_format == STANDARD)
+            {
+                std::memcpy(_buffer->mapped(_offset), vertices, vertices_bytes);
+            }
+        }
+    }
+    // gather the positions as arrays of floats, for the vectorized bounding volumes computation and the ray casts
+    std::array<std::vector<float>, 3> positions;
+    for (std::vector<float>& coordinates : positions)
+    {
+        coordinates.resize(vertices_count);
+    }
+    std::vector<vec2> UVs(vertices_count);
+    uint32_t palette_entries_used = 0;
+    for (std::size_t i=0; i<vertices_count; i++)
+    {
+        positions[0][i] = vertices[i].position.x;
+        positions[1][i] = vertices[i].position.y;
+        positions[2][i] = vertices[i].position.z;
+        UVs[i] = vertices[i].uv;
+        palette_entries_used = std::max(palette_entries_used, vertices[i].palette + 1);
+    }
+    if (palette_entries_used > _palette.size())
+    {
+        THROW_ERROR("The uploaded vertices reference entries missing from the mesh's palette");
+    }
+    _palette_entries_used = palette_entries_used;
+    _bounding_box = BoundingBox::from_points(positions[0].data(), positions[1].data(), positions[2].data(), vertices_count);
+    _bounding_sphere = BoundingSphere::from_points(positions[0].data(), positions[1].data(), positions[2].data(), vertices_count);
+    if (_vertex_format == COMPACT)
+    {
+        // positions are quantized in the bounding box, with the same scale on all axes so that the dequantization does not deform the normals
+        double scale = 0.;
+        _position_offset = {0.f, 0.f, 0.f};
+        if (!_bounding_box.is_empty())
+        {
+            Vector extents = _bounding_box.upper - _bounding_box.lower;
+            scale = std::max(extents.x, std::max(extents.y, extents.z));
+            _position_offset = _bounding_box.lower.to_vec3();
+        }
+        _position_scale = (scale > 0.) ? static_cast<float>(scale) : 1.f;
+        if (in_place)
+        {
+            compact_vertices(vertices, vertices_count, _position_offset, _position_scale, reinterpret_cast<CompactVertex*>(_buffer->mapped(_offset)));
+        }
+        else if (vertices_count > 0)
+        {
+            std::vector<CompactVertex> compact(vertices_count);
+            compact_vertices(vertices, vertices_count, _position_offset, _position_scale, compact.data());
+            _buffer->upload(compact.data(), vertices_bytes, _offset);
+        }
+    }
+    else if (!in_place && vertices_count > 0)
+    {
+        _buffer->upload(vertices, vertices_bytes, _offset);
+    }
+    if (!in_place && indices_count > 0)
+    {
+        _buffer->upload(indices, indices_count * sizeof(uint32_t), _offset + vertices_bytes);
+    }
+    // simplified versions of the mesh, their indices being stored after the mesh's indices
+    std::vector<uint32_t> levels_indices;
+    _levels_of_detail.clear();
+    if (_generate_levels_of_detail)
+    {
+        for (SimplifiedMesh& level : Simplifier::levels_of_detail(vertices, vertices_count, (indices_count > 0) ? indices : nullptr, indices_count))
+        {
+            _levels_of_detail.push_back({static_cast<uint32_t>(indices_count + levels_indices.size()), static_cast<uint32_t>(level.indices.size()), level.error});
+            levels_indices.insert(levels_indices.end(), level.indices.begin(), level.indices.end());
+        }
+    }
+    std::size_t levels_offset = _offset + vertices_bytes + indices_count * sizeof(uint32_t);
+    if (in_place && levels_indices.size() > 0)
+    {
+        std::memcpy(_buffer->mapped(levels_offset), levels_indices.data(), levels_indices.size() * sizeof(uint32_t));
+    }
+    else if (levels_indices.size() > 0)
+    {
+        _buffer->upload(levels_indices.data(), levels_indices.size() * sizeof(uint32_t), levels_offset);
+    }
+    std::size_t written_end = levels_offset + levels_indices.size() * sizeof(uint32_t);
+    // meshlet descriptors, stored last
+    _meshlets_offset = ((written_end + MESHLETS_ALIGNMENT - 1) / MESHLETS_ALIGNMENT) * MESHLETS_ALIGNMENT;
+    if (in_place && meshlets.size() > 0)
+    {
+        std::memcpy(_buffer->mapped(_meshlets_offset), meshlets.data(), meshlets.size() * sizeof(Meshlet));
+    }
+    else if (meshlets.size() > 0)
+    {
+        _buffer->upload(meshlets.data(), meshlets.size() * sizeof(Meshlet), _meshlets_offset);
+    }
+    if (meshlets.size() > 0)
+    {
+        written_end = _meshlets_offset + meshlets.size() * sizeof(Meshlet);
+    }
+    if (in_place)
+    {
+        _buffer->flush(written_end - _offset, _offset);
+    }
+    _meshlets = std::move(meshlets);
+    _indexed = (indices_count > 0);
+    _vertices_count = static_cast<uint32_t>(vertices_count);
+    _indices_count = static_cast<uint32_t>(indices_count);
+    if (_regions != nullptr)
+    {
+        // the other regions miss the whole content of the mesh. Only meshes that can be partially uploaded keep a copy of their vertices to write it.
+        for (std::size_t i=0; i<_regions->size(); i++)
+        {
+            std::vector<std::pair<std::size_t, std::size_t>>& stale = (*_regions)[i].stale;
+            stale.clear();
+            if (i != _region)
+            {
+                stale.emplace_back(0, vertices_bytes + indices_count * sizeof(uint32_t));
+            }
+        }
+        if (_vertex_format == STANDARD && !_generate_levels_of_detail && !_generate_meshlets)
+        {
+            _dynamic_vertices.assign(vertices, vertices + vertices_count);
+        }
+    }
+    // keep the geometry for ray casts, the triangle hierarchy being rebuilt on next ray cast
+    std::lock_guard<std::mutex> lock(_triangle_hierarchy_mutex);
+    _positions = std::move(positions);
+    _UVs = std::move(UVs);
+    _indices.assign(indices, indices + indices_count);
+    _triangle_hierarchy.reset();
+}
+
+std::size_t Mesh::_required_bytes_size(std::size_t vertices_count, std::size_t indices_count) const
+{
+    return required_bytes_size(vertices_count, indices_count, _vertex_format, _generate_levels_of_detail, _generate_meshlets);
+}
+
+std::size_t Mesh::_acquire_region()
+{
+    std::vector<DynamicRegion>& regions = *_regions;
+    // the regions are used in turn, so that the one read by the oldest frame is waited for first
+    for (std::size_t i=1; i<regions.size(); i++)
+    {
+        std::size_t region = (_region + i) % regions.size();
+        if (regions[region].readers.empty())
+        {
+            return region;
+        }
+    }
+    for (std::size_t i=1; i<regions.size(); i++)
+    {
+        std::size_t region = (_region + i) % regions.size();
+        std::vector<Canvas*> readers = regions[region].readers;
+        bool recording = std::any_of(readers.begin(), readers.end(), [](const Canvas* canvas) {return canvas->is_recording();});
+        if (!recording)
+        {
+            // waiting for the canvases removes them from the readers of the regions they read
+            for (Canvas* canvas : readers)
+            {
+                canvas->wait_completion();
+            }
+            return region;
+        }
+    }
+    THROW_ERROR("All the regions of the dynamic mesh are read by canvases still recording: render them before uploading again, or create the mesh with more regions");
+}
+
+void Mesh::_use_region(std::size_t region)
+{
+    _region = region;
+    _offset = region * _region_stride;
+}
+
+std::vector<Vertex> Mesh::faces_vertices(const std::vector<Face>& faces, std::vector<PaletteEntry>& palette)
 {
     std::vector<Vertex> vertices(faces.size() * 3);
+    faces_vertices(faces, faces_palette(faces, palette), vertices.data());
+    return vertices;
+}
+
+std::vector<uint32_t> Mesh::faces_palette(const std::vector<Face>& faces, std::vector<PaletteEntry>& palette)
+{
+    std::unordered_map<PaletteEntry, uint32_t, BytesHash<PaletteEntry>, BytesEqual<PaletteEntry>> entry_index;
+    palette.clear();
+    std::vector<uint32_t> palette_indices(faces.size());
     for (size_t i=0; i<faces.size();i++)
     {
         const Face& face = faces[i];
-        vertices[i*3] = {face.points[0].to_vec3(), face.normals[0].to_vec3(), face.color.to_vec4(), face.UVs[0].to_vec(), face.material.to_vec()};
-        vertices[i*3+1] = {face.points[1].to_vec3(), face.normals[1].to_vec3(), face.color.to_vec4(), face.UVs[1].to_vec(), face.material.to_vec()};
-        vertices[i*3+2] = {face.points[2].to_vec3(), face.normals[2].to_vec3(), face.color.to_vec4(), face.UVs[2].to_vec(), face.material.to_vec()};
+        vec3 material = face.material.to_vec();
+        PaletteEntry entry = {face.color.to_vec4(), vec4({material.x, material.y, material.z, 0.f})};
+        std::pair<std::unordered_map<PaletteEntry, uint32_t, BytesHash<PaletteEntry>, BytesEqual<PaletteEntry>>::iterator, bool> inserted = entry_index.emplace(entry, static_cast<uint32_t>(palette.size()));
+        if (inserted.second)
+        {
+            palette.push_back(entry);
+        }
+        palette_indices[i] = inserted.first->second;
     }
-    _buffer->upload(vertices.data(), faces.size()*sizeof(Vertex)*3, _offset);
+    return palette_indices;
 }
 
-std::size_t Mesh::bytes_size() const
+void Mesh::faces_vertices(const std::vector<Face>& faces, const std::vector<uint32_t>& palette_indices, Vertex* vertices)
 {
-    return _bytes_size;
+    for (size_t i=0; i<faces.size();i++)
+    {
+        const Face& face = faces[i];
+        uint32_t index = palette_indices[i];
+        vertices[i*3] = {face.points[0].to_vec3(), face.normals[0].to_vec3(), face.UVs[0].to_vec(), index};
+        vertices[i*3+1] = {face.points[1].to_vec3(), face.normals[1].to_vec3(), face.UVs[1].to_vec(), index};
+        vertices[i*3+2] = {face.points[2].to_vec3(), face.normals[2].to_vec3(), face.UVs[2].to_vec(), index};
+    }
+}
+
+void Mesh::weld_vertices(const std::vector<Vertex>& vertices, std::vector<Vertex>& unique_vertices, std::vector<uint32_t>& indices)
+{
+    std::unordered_map<Vertex, uint32_t, BytesHash<Vertex>, BytesEqual<Vertex>> index_of;
+    index_of.reserve(vertices.size());
+    unique_vertices.clear();
+    unique_vertices.reserve(vertices.size());
+    indices.resize(vertices.size());
+    for (std::size_t i=0; i<vertices.size(); i++)
+    {
+        std::pair<std::unordered_map<Vertex, uint32_t, BytesHash<Vertex>, BytesEqual<Vertex>>::iterator, bool> inserted = index_of.emplace(vertices[i], static_cast<uint32_t>(unique_vertices.size()));
+        if (inserted.second)
+        {
+            unique_vertices.push_back(vertices[i]);
+        }
+        indices[i] = inserted.first->second;
+    }
+    unique_vertices.shrink_to_fit();
+}
+
+std::vector<CompactVertex> Mesh::compact_vertices(const std::vector<Vertex>& vertices, const vec3& position_offset, float position_scale)
+{
+    std::vector<CompactVertex> compact(vertices.size());
+    compact_vertices(vertices.data(), vertices.size(), position_offset, position_scale, compact.data());
+    return compact;
 }
 
-std::vector<std::shared_ptr<Mesh>> Mesh::bulk_allocate_meshes(const GPU* gpu, const std::vector<std::vector<Face>>& faces)
+void Mesh::compact_vertices(const Vertex* vertices, std::size_t count, const vec3& position_offset, float position_scale, CompactVertex* compact)
 {
+    const float inverse_scale = 1.f / position_scale;
+    for (std::size_t i=0; i<count; i++)
+    {
+        const Vertex& v = vertices[i];
+        CompactVertex& c = compact[i];
+        c.position[0] = to_unorm16((v.position.x - position_offset.x) * inverse_scale);
+        c.position[1] = to_unorm16((v.position.y - position_offset.y) * inverse_scale);
+        c.position[2] = to_unorm16((v.position.z - position_offset.z) * inverse_scale);
+        c.position[3] = 0;
+        vec2 normal = octahedral_encode(v.normal);
+        c.normal[0] = to_snorm16(normal.x);
+        c.normal[1] = to_snorm16(normal.y);
+        c.uv[0] = Utilities::to_half(v.uv.x);
+        c.uv[1] = Utilities::to_half(v.uv.y);
+        c.palette = v.palette;
+    }
+}
+
+std::size_t Mesh::required_bytes_size(std::size_t vertices_count, std::size_t indices_count, VertexFormat format, bool levels_of_detail, bool meshlets)
+{
+    // the indices of the levels of detail and the meshlet descriptors are stored after the vertices and indices
+    std::size_t bytes_size = vertices_count * vertex_size(format) + indices_count * sizeof(uint32_t);
+    std::size_t triangles_count = ((indices_count > 0) ? indices_count : vertices_count) / 3;
+    if (levels_of_detail)
+    {
+        bytes_size += Simplifier::levels_of_detail_indices_count(triangles_count) * sizeof(uint32_t);
+    }
+    if (meshlets)
+    {
+        // the descriptors are aligned on their vec4 members
+        bytes_size += MESHLETS_ALIGNMENT + Meshlets::max_meshlets_count(triangles_count) * sizeof(Meshlet);
+    }
+    return bytes_size;
+}
+
+std::size_t Mesh::vertex_size(VertexFormat format)
+{
+    return (format == COMPACT) ? sizeof(CompactVertex) : sizeof(Vertex);
+}
+
+std::vector<std::shared_ptr<Mesh>> Mesh::bulk_allocate_meshes(const GPU* gpu, const std::vector<std::vector<Face>>& faces, bool indexed, VertexFormat format, bool levels_of_detail, bool meshlets)
+{
+    // gather the palettes (and weld the indexed meshes) in parallel first, to know the size of the shared buffers
+    std::vector<std::vector<PaletteEntry>> palettes(faces.size());
+    std::vector<std::vector<uint32_t>> palette_indices(faces.size());
+    std::vector<std::vector<Vertex>> vertices(faces.size());
+    std::vector<std::vector<uint32_t>> indices(faces.size());
+    Parallel::for_ranges(faces.size(), 1, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            palette_indices[i] = faces_palette(faces[i], palettes[i]);
+            if (indexed)
+            {
+                std::vector<Vertex> all_vertices(faces[i].size() * 3);
+                faces_vertices(faces[i], palette_indices[i], all_vertices.data());
+                weld_vertices(all_vertices, vertices[i], indices[i]);
+            }
+        }
+    });
     std::size_t bytes_size = 0;
+    std::size_t palettes_bytes_size = 0;
     std::vector<std::size_t> offsets;
-    for (const std::vector<Face>& mesh : faces)
+    std::vector<std::size_t> palette_offsets;
+    for (std::size_t i=0; i<faces.size(); i++)
     {
         offsets.push_back(bytes_size);
-        bytes_size += mesh.size() * sizeof(Vertex) * 3;
+        bytes_size += required_bytes_size(indexed ? vertices[i].size() : faces[i].size() * 3, indices[i].size(), format, levels_of_detail, meshlets);
+        palette_offsets.push_back(palettes_bytes_size);
+        palettes_bytes_size += palette_bytes_size(palettes[i].size(), gpu->storage_buffer_alignment());
     }
-    std::shared_ptr<Buffer> buffer(new Buffer(gpu, bytes_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT));
+    std::shared_ptr<Buffer> buffer(new Buffer(gpu, bytes_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, Buffer::DEVICE_LOCAL));
+    std::shared_ptr<Buffer> palette_buffer(new Buffer(gpu, palettes_bytes_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
     std::vector<std::shared_ptr<Mesh>> meshes;
     for (std::size_t i=0; i<faces.size(); i++)
     {
-        meshes.emplace_back(new Mesh(buffer, offsets[i], faces[i]));
-        meshes[i]->upload(faces[i]);
+        std::size_t vertices_count = indexed ? vertices[i].size() : faces[i].size() * 3;
+        meshes.emplace_back(new Mesh(buffer, offsets[i], vertices_count, indices[i].size(), palette_buffer, palette_offsets[i], palettes[i].size(), format, levels_of_detail, meshlets));
     }
+    // then write each mesh in its disjoint ranges of the buffers
+    Parallel::for_ranges(faces.size(), 1, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            meshes[i]->upload_palette(palettes[i]);
+            if (indexed)
+            {
+                meshes[i]->upload(vertices[i], indices[i]);
+            }
+            else
+            {
+                MeshBuilder builder(*meshes[i], faces[i].size() * 3);
+                faces_vertices(faces[i], palette_indices[i], builder.vertices());
+                builder.finish();
+            }
+        }
+    });
     return meshes;
 }
 
 
-std::map<std::string, std::shared_ptr<Mesh>> Mesh::bulk_allocate_meshes(const GPU* gpu, const std::map<std::string, std::vector<Face>>& faces)
+std::map<std::string, std::shared_ptr<Mesh>> Mesh::bulk_allocate_meshes(const GPU* gpu, const std::map<std::string, std::vector<Face>>& faces, bool indexed, VertexFormat format,
+                                                                        bool levels_of_detail, bool meshlets)
 {
     std::vector<std::string> names;
     std::vector<std::vector<Face>> faces_vector;
@@ -67,11 +952,11 @@ std::map<std::string, std::shared_ptr<Mesh>> Mesh::bulk_allocate_meshes(const GP
         names.push_back(key_values.first);
         faces_vector.push_back(key_values.second);
     }
-    std::vector<std::shared_ptr<Mesh>> meshes = Mesh::bulk_allocate_meshes(gpu, faces_vector);
+    std::vector<std::shared_ptr<Mesh>> meshes = Mesh::bulk_allocate_meshes(gpu, faces_vector, indexed, format, levels_of_detail, meshlets);
     std::map<std::string, std::shared_ptr<Mesh>> meshes_map;
     for (std::size_t i=0; i<meshes.size(); i++)
     {
         meshes_map[names[i]] = meshes[i];
     }
     return meshes_map;
-}
\ No newline at end of file
+}
@@ -0,0 +1,79 @@
+#include <RenderEngine/graphics/model/MeshBuilder.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+using namespace RenderEngine;
+
+
+MeshBuilder::MeshBuilder(Mesh& mesh, std::size_t vertices_count, std::size_t indices_count) : _mesh(mesh), _vertices_count(vertices_count), _indices_count(indices_count)
+{
+    std::size_t vertices_bytes = vertices_count * mesh.vertex_size();
+    if (mesh._required_bytes_size(vertices_count, indices_count) > mesh._bytes_size)
+    {
+        THROW_ERROR("The built vertices and indices do not fit in the mesh's range of the buffer");
+    }
+    std::size_t offset = mesh._offset;
+    if (mesh._regions != nullptr)
+    {
+        _region = mesh._acquire_region();
+        offset = _region * mesh._region_stride;
+    }
+    uint8_t* data = reinterpret_cast<uint8_t*>(mesh._buffer->mapped(offset));
+    _in_place = (data != nullptr);
+    if (mesh._vertex_format == Mesh::COMPACT || !_in_place)
+    {
+        _staging.resize(vertices_count);
+        _vertices = _staging.data();
+    }
+    else
+    {
+        _vertices = reinterpret_cast<Vertex*>(data);
+    }
+    if (_in_place)
+    {
+        _indices = reinterpret_cast<uint32_t*>(data + vertices_bytes);
+    }
+    else
+    {
+        _staging_indices.resize(indices_count);
+        _indices = _staging_indices.data();
+    }
+}
+
+MeshBuilder::~MeshBuilder()
+{
+}
+
+Vertex* MeshBuilder::vertices()
+{
+    return _vertices;
+}
+
+std::size_t MeshBuilder::vertices_count() const
+{
+    return _vertices_count;
+}
+
+uint32_t* MeshBuilder::indices()
+{
+    return _indices;
+}
+
+std::size_t MeshBuilder::indices_count() const
+{
+    return _indices_count;
+}
+
+void MeshBuilder::finish()
+{
+    if (_finished)
+    {
+        THROW_ERROR("The mesh builder was already finished");
+    }
+    if (_mesh._regions != nullptr)
+    {
+        _mesh._use_region(_region);
+    }
+    _mesh._commit(_vertices, _vertices_count, _indices, _indices_count, _in_place);
+    _finished = true;
+    _staging = {};
+    _staging_indices = {};
+}
@@ -0,0 +1,395 @@
+#include <RenderEngine/graphics/model/MeshCache.hpp>
+#include <RenderEngine/graphics/model/MeshLoader.hpp>
+#include <RenderEngine/graphics/model/MeshCodec.hpp>
+#include <RenderEngine/utilities/MappedFile.hpp>
+#include <RenderEngine/utilities/Parallel.hpp>
+#include <RenderEngine/utilities/Functions.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+#include <array>
+using namespace RenderEngine;
+
+namespace
+{
+    constexpr char MAGIC[4] = {'R', 'E', 'M', 'C'};
+    // Sections of the file are aligned, so that they are copied from the mapped file with aligned loads
+    constexpr std::size_t SECTION_ALIGNMENT = 64;
+    // Alignment of the meshlet descriptors in the mesh's range of the buffer (as in Mesh)
+    constexpr std::size_t MESHLETS_ALIGNMENT = sizeof(vec4);
+    // Files are hashed in chunks of this size from parallel threads. The chunks do not depend on the number of threads, so neither does the hash.
+    constexpr std::size_t HASH_CHUNK_SIZE = 1 << 22;
+    // Vertices are read back in ranges of at least this many vertices
+    constexpr std::size_t MIN_RANGE_SIZE = 1 << 16;
+
+    enum Flags {LEVELS_OF_DETAIL = 1, MESHLETS = 2, COMPRESSED = 4};
+
+    struct Header
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t source_hash;
+        uint32_t vertex_format;
+        uint32_t flags; // parameters the mesh was created with, and the encoding of the range (see Flags)
+        uint32_t vertices_count;
+        uint32_t indices_count;
+        uint32_t palette_count;
+        uint32_t palette_entries_used;
+        uint32_t levels_count;
+        uint32_t meshlets_count;
+        uint64_t range_bytes; // size of the content of the mesh's range of the buffer, as if it started at offset 0
+        uint64_t meshlets_offset; // position of the meshlet descriptors in the range
+        uint64_t stored_bytes; // size of the range in the file: 'range_bytes', or the size of its encoded vertices, encoded indices and meshlet descriptors if it is compressed
+        uint64_t encoded_vertices_bytes; // size of the encoded vertices, if the range is compressed
+        uint64_t palette_position; // positions of the sections in the file
+        uint64_t levels_position;
+        uint64_t range_position;
+        uint64_t file_size;
+        double bounding_box[6]; // lower then upper corner
+        double bounding_sphere[4]; // center then radius
+        float position_offset[3]; // dequantization of COMPACT positions
+        float position_scale;
+    };
+
+    std::size_t aligned(std::size_t position, std::size_t alignment)
+    {
+        return ((position + alignment - 1) / alignment) * alignment;
+    }
+
+    // Combines a value into a hash
+    uint64_t mix(uint64_t hash, uint64_t value)
+    {
+        hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+        return hash * 0xFF51AFD7ED558CCDULL;
+    }
+
+    // FNV-1a over the 64 bits words of the bytes, then over the remaining bytes
+    uint64_t bytes_hash(const char* data, std::size_t size)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        std::size_t words_count = size / sizeof(uint64_t);
+        for (std::size_t i=0; i<words_count; i++)
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+            hash = (hash ^ word) * 1099511628211ULL;
+        }
+        for (std::size_t i=words_count * sizeof(uint64_t); i<size; i++)
+        {
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    uint32_t float_bits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(float));
+        return bits;
+    }
+
+    // Returns true if the 'size' bytes at 'position' end before 'end', without overflowing
+    bool within(uint64_t position, uint64_t size, uint64_t end)
+    {
+        return position <= end && size <= end - position;
+    }
+
+    // Returns true if the header is one of the current version, for the given hash, and if its sections are within the file
+    bool valid_header(const Header& header, std::size_t file_size, uint64_t source_hash)
+    {
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != MeshCache::VERSION || header.source_hash != source_hash
+            || header.file_size != file_size || header.vertex_format > Mesh::COMPACT)
+        {
+            return false;
+        }
+        Mesh::VertexFormat format = static_cast<Mesh::VertexFormat>(header.vertex_format);
+        std::size_t range_capacity = Mesh::required_bytes_size(header.vertices_count, header.indices_count, format,
+                                                               (header.flags & LEVELS_OF_DETAIL) != 0, (header.flags & MESHLETS) != 0);
+        std::size_t elements_bytes = header.vertices_count * Mesh::vertex_size(format) + header.indices_count * sizeof(uint32_t);
+        return within(header.palette_position, header.palette_count * sizeof(PaletteEntry), file_size)
+               && within(header.levels_position, header.levels_count * sizeof(Mesh::LevelOfDetail), file_size)
+               && within(header.range_position, header.stored_bytes, file_size)
+               && ((header.flags & COMPRESSED) != 0 ? within(header.encoded_vertices_bytes, header.meshlets_count * sizeof(Meshlet), header.stored_bytes)
+                                                    : header.stored_bytes == header.range_bytes)
+               && header.range_bytes <= range_capacity && elements_bytes <= header.range_bytes
+               && (header.meshlets_count == 0 || (elements_bytes <= header.meshlets_offset && within(header.meshlets_offset, header.meshlets_count * sizeof(Meshlet), header.range_bytes)))
+               && header.palette_entries_used <= header.palette_count;
+    }
+}
+
+
+void MeshCache::save(const Mesh& mesh, const std::string& path, uint64_t source_hash, bool compressed)
+{
+    if (mesh._buffer->mapped(mesh._offset) == nullptr)
+    {
+        THROW_ERROR("Only the meshes of mapped buffers can be saved to a cache file");
+    }
+    // the content of the range is written as if the range started at offset 0, the meshlet descriptors being aligned accordingly
+    std::size_t levels_indices_count = 0;
+    for (const Mesh::LevelOfDetail& level : mesh._levels_of_detail)
+    {
+        levels_indices_count += level.indices_count;
+    }
+    std::size_t levels_end = mesh._vertices_count * mesh.vertex_size() + (mesh._indices_count + levels_indices_count) * sizeof(uint32_t);
+    std::size_t meshlets_offset = aligned(levels_end, MESHLETS_ALIGNMENT);
+    std::size_t range_bytes = (mesh._meshlets.size() > 0) ? meshlets_offset + mesh._meshlets.size() * sizeof(Meshlet) : levels_end;
+    std::vector<char> range(range_bytes, 0);
+    mesh._buffer->download(range.data(), levels_end, mesh._offset);
+    if (mesh._meshlets.size() > 0)
+    {
+        std::memcpy(range.data() + meshlets_offset, mesh._meshlets.data(), mesh._meshlets.size() * sizeof(Meshlet));
+    }
+    // compressed ranges store the vertices and all the indices (of the mesh and of its levels of detail) as encoded streams, and the meshlet descriptors as is
+    std::size_t vertices_bytes = mesh._vertices_count * mesh.vertex_size();
+    std::size_t encoded_vertices_bytes = 0;
+    std::vector<char> stored;
+    if (compressed)
+    {
+        stored = MeshCodec::encode_vertices(range.data(), mesh._vertices_count, mesh.vertex_size());
+        encoded_vertices_bytes = stored.size();
+        std::vector<uint32_t> indices((levels_end - vertices_bytes) / sizeof(uint32_t));
+        std::memcpy(indices.data(), range.data() + vertices_bytes, indices.size() * sizeof(uint32_t));
+        std::vector<char> encoded_indices = MeshCodec::encode_indices(indices.data(), indices.size());
+        stored.insert(stored.end(), encoded_indices.begin(), encoded_indices.end());
+        if (mesh._meshlets.size() > 0)
+        {
+            stored.insert(stored.end(), range.begin() + meshlets_offset, range.end());
+        }
+    }
+    const std::vector<char>& range_section = compressed ? stored : range;
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.source_hash = source_hash;
+    header.vertex_format = mesh._vertex_format;
+    header.flags = (mesh._generate_levels_of_detail ? LEVELS_OF_DETAIL : 0) | (mesh._generate_meshlets ? MESHLETS : 0) | (compressed ? COMPRESSED : 0);
+    header.vertices_count = mesh._vertices_count;
+    header.indices_count = mesh._indices_count;
+    header.palette_count = static_cast<uint32_t>(mesh._palette.size());
+    header.palette_entries_used = mesh._palette_entries_used;
+    header.levels_count = static_cast<uint32_t>(mesh._levels_of_detail.size());
+    header.meshlets_count = static_cast<uint32_t>(mesh._meshlets.size());
+    header.range_bytes = range_bytes;
+    header.meshlets_offset = meshlets_offset;
+    header.stored_bytes = range_section.size();
+    header.encoded_vertices_bytes = encoded_vertices_bytes;
+    header.palette_position = aligned(sizeof(Header), SECTION_ALIGNMENT);
+    header.levels_position = aligned(header.palette_position + mesh._palette.size() * sizeof(PaletteEntry), SECTION_ALIGNMENT);
+    header.range_position = aligned(header.levels_position + mesh._levels_of_detail.size() * sizeof(Mesh::LevelOfDetail), SECTION_ALIGNMENT);
+    header.file_size = header.range_position + range_section.size();
+    const BoundingBox& box = mesh._bounding_box;
+    const BoundingSphere& sphere = mesh._bounding_sphere;
+    double bounds[10] = {box.lower.x, box.lower.y, box.lower.z, box.upper.x, box.upper.y, box.upper.z, sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius};
+    std::memcpy(header.bounding_box, bounds, 6 * sizeof(double));
+    std::memcpy(header.bounding_sphere, bounds + 6, 4 * sizeof(double));
+    header.position_offset[0] = mesh._position_offset.x;
+    header.position_offset[1] = mesh._position_offset.y;
+    header.position_offset[2] = mesh._position_offset.z;
+    header.position_scale = mesh._position_scale;
+    // written to a temporary file first, so that an interrupted write does not leave a truncated cache
+    std::string temporary_path = path + ".tmp";
+    {
+        std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+        auto write_at = [&](std::size_t position, const void* data, std::size_t bytes_size)
+        {
+            static const char padding[SECTION_ALIGNMENT] = {};
+            std::size_t current = static_cast<std::size_t>(file.tellp());
+            file.write(padding, position - current);
+            file.write(reinterpret_cast<const char*>(data), bytes_size);
+        };
+        write_at(0, &header, sizeof(Header));
+        write_at(header.palette_position, mesh._palette.data(), mesh._palette.size() * sizeof(PaletteEntry));
+        write_at(header.levels_position, mesh._levels_of_detail.data(), mesh._levels_of_detail.size() * sizeof(Mesh::LevelOfDetail));
+        write_at(header.range_position, range_section.data(), range_section.size());
+        if (!file.good())
+        {
+            THROW_ERROR("Failed to write the mesh cache file '" + temporary_path + "'");
+        }
+    }
+    std::remove(path.c_str());
+    if (std::rename(temporary_path.c_str(), path.c_str()) != 0)
+    {
+        THROW_ERROR("Failed to write the mesh cache file '" + path + "'");
+    }
+}
+
+bool MeshCache::is_valid(const std::string& path, uint64_t source_hash)
+{
+    // only the header is read
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.good())
+    {
+        return false;
+    }
+    std::size_t file_size = static_cast<std::size_t>(file.tellg());
+    Header header;
+    file.seekg(0);
+    return file_size >= sizeof(Header) && file.read(reinterpret_cast<char*>(&header), sizeof(Header)) && valid_header(header, file_size, source_hash);
+}
+
+std::shared_ptr<Mesh> MeshCache::load(const GPU* gpu, const std::string& path, uint64_t source_hash)
+{
+    MappedFile file(path);
+    Header header;
+    if (file.size() >= sizeof(Header))
+    {
+        std::memcpy(&header, file.data(), sizeof(Header));
+    }
+    if (file.size() < sizeof(Header) || !valid_header(header, file.size(), source_hash))
+    {
+        THROW_ERROR("The file '" + path + "' is not a valid mesh cache");
+    }
+    Mesh::VertexFormat format = static_cast<Mesh::VertexFormat>(header.vertex_format);
+    bool levels_of_detail = (header.flags & LEVELS_OF_DETAIL) != 0;
+    bool meshlets = (header.flags & MESHLETS) != 0;
+    std::shared_ptr<Buffer> buffer(new Buffer(gpu, Mesh::required_bytes_size(header.vertices_count, header.indices_count, format, levels_of_detail, meshlets),
+                                              VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, Buffer::DEVICE_LOCAL));
+    std::shared_ptr<Buffer> palette_buffer(new Buffer(gpu, std::max(header.palette_count, 1u) * sizeof(PaletteEntry), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+    std::shared_ptr<Mesh> mesh(new Mesh(buffer, 0, header.vertices_count, header.indices_count, palette_buffer, 0, header.palette_count, format, levels_of_detail, meshlets));
+    std::vector<PaletteEntry> palette(header.palette_count);
+    std::memcpy(palette.data(), file.data() + header.palette_position, palette.size() * sizeof(PaletteEntry));
+    mesh->upload_palette(palette);
+    mesh->_levels_of_detail.resize(header.levels_count);
+    std::memcpy(mesh->_levels_of_detail.data(), file.data() + header.levels_position, header.levels_count * sizeof(Mesh::LevelOfDetail));
+    // the indices of the levels are drawn from the range, between the vertices and the meshlet descriptors
+    std::size_t vertices_bytes = header.vertices_count * Mesh::vertex_size(format);
+    uint64_t indices_capacity = ((header.meshlets_count > 0 ? header.meshlets_offset : header.range_bytes) - vertices_bytes) / sizeof(uint32_t);
+    for (const Mesh::LevelOfDetail& level : mesh->_levels_of_detail)
+    {
+        if (!within(level.first_index, level.indices_count, indices_capacity))
+        {
+            THROW_ERROR("The file '" + path + "' is not a valid mesh cache");
+        }
+    }
+    const char* range = file.data() + header.range_position;
+    std::vector<char> decoded;
+    if ((header.flags & COMPRESSED) != 0)
+    {
+        // decoded in memory, as the ray cast geometry is read back from it
+        std::size_t indices_count = header.indices_count;
+        for (const Mesh::LevelOfDetail& level : mesh->_levels_of_detail)
+        {
+            indices_count += level.indices_count;
+        }
+        std::size_t indices_end = vertices_bytes + indices_count * sizeof(uint32_t);
+        std::size_t meshlets_bytes = header.meshlets_count * sizeof(Meshlet);
+        decoded.resize(header.range_bytes);
+        if (indices_end > (header.meshlets_count > 0 ? header.meshlets_offset : header.range_bytes)
+            || !MeshCodec::decode_vertices(range, header.encoded_vertices_bytes, decoded.data(), header.vertices_count, Mesh::vertex_size(format))
+            || !MeshCodec::decode_indices(range + header.encoded_vertices_bytes, header.stored_bytes - header.encoded_vertices_bytes - meshlets_bytes,
+                                          reinterpret_cast<uint32_t*>(decoded.data() + vertices_bytes), indices_count))
+        {
+            THROW_ERROR("The file '" + path + "' is not a valid mesh cache");
+        }
+        if (header.meshlets_count > 0)
+        {
+            std::memcpy(decoded.data() + header.meshlets_offset, range + header.stored_bytes - meshlets_bytes, meshlets_bytes);
+        }
+        range = decoded.data();
+    }
+    // the range is copied as is: through the staging ring, or straight in the buffer if it is mapped
+    buffer->upload(range, header.range_bytes, 0);
+    mesh->_meshlets.resize(header.meshlets_count);
+    std::memcpy(mesh->_meshlets.data(), range + header.meshlets_offset, header.meshlets_count * sizeof(Meshlet));
+    mesh->_meshlets_offset = header.meshlets_offset;
+    mesh->_vertices_count = header.vertices_count;
+    mesh->_indices_count = header.indices_count;
+    mesh->_palette_entries_used = header.palette_entries_used;
+    mesh->_bounding_box = BoundingBox(Vector(header.bounding_box[0], header.bounding_box[1], header.bounding_box[2]),
+                                      Vector(header.bounding_box[3], header.bounding_box[4], header.bounding_box[5]));
+    mesh->_bounding_sphere = BoundingSphere(Vector(header.bounding_sphere[0], header.bounding_sphere[1], header.bounding_sphere[2]), header.bounding_sphere[3]);
+    mesh->_position_offset = {header.position_offset[0], header.position_offset[1], header.position_offset[2]};
+    mesh->_position_scale = header.position_scale;
+    // the ray cast geometry is read back from the vertices and indices
+    std::array<std::vector<float>, 3> positions;
+    for (std::vector<float>& coordinates : positions)
+    {
+        coordinates.resize(header.vertices_count);
+    }
+    std::vector<vec2> UVs(header.vertices_count);
+    Parallel::for_ranges(header.vertices_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            if (format == Mesh::STANDARD)
+            {
+                Vertex vertex;
+                std::memcpy(&vertex, range + i * sizeof(Vertex), sizeof(Vertex));
+                positions[0][i] = vertex.position.x;
+                positions[1][i] = vertex.position.y;
+                positions[2][i] = vertex.position.z;
+                UVs[i] = vertex.uv;
+            }
+            else
+            {
+                CompactVertex vertex;
+                std::memcpy(&vertex, range + i * sizeof(CompactVertex), sizeof(CompactVertex));
+                for (std::size_t k=0; k<3; k++)
+                {
+                    positions[k][i] = header.position_offset[k] + header.position_scale * (vertex.position[k] / 65535.f);
+                }
+                UVs[i] = {Utilities::from_half(vertex.uv[0]), Utilities::from_half(vertex.uv[1])};
+            }
+        }
+    });
+    std::vector<uint32_t> indices(header.indices_count);
+    std::memcpy(indices.data(), range + header.vertices_count * Mesh::vertex_size(format), indices.size() * sizeof(uint32_t));
+    std::lock_guard<std::mutex> lock(mesh->_triangle_hierarchy_mutex);
+    mesh->_positions = std::move(positions);
+    mesh->_UVs = std::move(UVs);
+    mesh->_indices = std::move(indices);
+    return mesh;
+}
+
+std::shared_ptr<Mesh> MeshCache::load_cached(const GPU* gpu, const std::string& path, const std::string& cache_path, bool indexed, Mesh::VertexFormat format,
+                                             bool levels_of_detail, bool meshlets, const Color& color, const Material& material, bool compressed)
+{
+    // the files the mesh file depends on and the parameters of the baking are part of the hash, so that changing them bakes the cache again
+    uint64_t hash = file_hash(path);
+    for (const std::string& dependency : MeshLoader::dependencies(path))
+    {
+        hash = mix(hash, file_hash(dependency));
+    }
+    vec4 c = color.to_vec4();
+    vec3 m = material.to_vec();
+    for (uint64_t value : {static_cast<uint64_t>(indexed), static_cast<uint64_t>(format), static_cast<uint64_t>(levels_of_detail), static_cast<uint64_t>(meshlets),
+                           static_cast<uint64_t>(compressed)})
+    {
+        hash = mix(hash, value);
+    }
+    for (float value : {c.r, c.g, c.b, c.a, m.x, m.y, m.z})
+    {
+        hash = mix(hash, float_bits(value));
+    }
+    if (!is_valid(cache_path, hash))
+    {
+        // baked in a mapped buffer to be read back, then loaded from the new file in a device local buffer
+        std::shared_ptr<Mesh> baked = MeshLoader(path).mesh(gpu, indexed, format, levels_of_detail, meshlets, color, material, Buffer::HOST_VISIBLE);
+        save(*baked, cache_path, hash, compressed);
+    }
+    return load(gpu, cache_path, hash);
+}
+
+uint64_t MeshCache::file_hash(const std::string& path)
+{
+    MappedFile file(path);
+    std::size_t chunks_count = (file.size() + HASH_CHUNK_SIZE - 1) / HASH_CHUNK_SIZE;
+    std::vector<uint64_t> hashes(chunks_count);
+    Parallel::for_ranges(chunks_count, 1, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            std::size_t offset = i * HASH_CHUNK_SIZE;
+            hashes[i] = bytes_hash(file.data() + offset, std::min(HASH_CHUNK_SIZE, file.size() - offset));
+        }
+    });
+    uint64_t hash = mix(0, file.size());
+    for (uint64_t chunk_hash : hashes)
+    {
+        hash = mix(hash, chunk_hash);
+    }
+    return hash;
+}
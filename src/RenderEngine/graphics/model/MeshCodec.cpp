@@ -0,0 +1,316 @@
+#include <RenderEngine/graphics/model/MeshCodec.hpp>
+#include <RenderEngine/utilities/Parallel.hpp>
+#include <RenderEngine/utilities/SIMD.hpp>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+using namespace RenderEngine;
+
+namespace
+{
+    // Bytes of a group of a plane
+    constexpr std::size_t GROUP_SIZE = 16;
+    // Packing of a group: all zeros, 2 bits per byte, 4 bits per byte, or the raw bytes
+    enum GroupMode {ZERO, BITS_2, BITS_4, BITS_8};
+    constexpr std::size_t PAYLOAD_SIZES[4] = {0, 4, 8, 16};
+
+    // Stream header: records count (64 bits), record stride, blocks count, then the end of each block (64 bits) relative to the end of the table
+    constexpr std::size_t HEADER_SIZE = sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+    std::size_t groups_count(std::size_t records_count)
+    {
+        return (records_count + GROUP_SIZE - 1) / GROUP_SIZE;
+    }
+
+    // Appends a plane of bytes, 'groups' * GROUP_SIZE bytes long: the 2 bits modes of the groups, four per byte, then their payloads
+    void encode_plane(const uint8_t* plane, std::size_t groups, std::vector<char>& encoded)
+    {
+        std::size_t modes_position = encoded.size();
+        encoded.resize(encoded.size() + (groups + 3) / 4, 0);
+        for (std::size_t g=0; g<groups; g++)
+        {
+            const uint8_t* v = plane + g * GROUP_SIZE;
+            uint8_t max_value = *std::max_element(v, v + GROUP_SIZE);
+            GroupMode mode = (max_value == 0) ? ZERO : (max_value < 4) ? BITS_2 : (max_value < 16) ? BITS_4 : BITS_8;
+            encoded[modes_position + g / 4] = static_cast<char>(encoded[modes_position + g / 4] | (mode << (2 * (g % 4))));
+            switch (mode)
+            {
+                case BITS_2:
+                    for (std::size_t k=0; k<4; k++)
+                    {
+                        encoded.push_back(static_cast<char>(v[4*k] | (v[4*k+1] << 2) | (v[4*k+2] << 4) | (v[4*k+3] << 6)));
+                    }
+                    break;
+                case BITS_4:
+                    for (std::size_t k=0; k<8; k++)
+                    {
+                        encoded.push_back(static_cast<char>(v[2*k] | (v[2*k+1] << 4)));
+                    }
+                    break;
+                case BITS_8:
+                    encoded.insert(encoded.end(), reinterpret_cast<const char*>(v), reinterpret_cast<const char*>(v) + GROUP_SIZE);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // Unpacks the payload of a group in 16 bytes
+    void decode_group(GroupMode mode, const uint8_t* payload, uint8_t* group)
+    {
+#if defined(RENDERENGINE_SIMD_SSE) || defined(RENDERENGINE_SIMD_AVX)
+        __m128i result;
+        switch (mode)
+        {
+            case BITS_2:
+            {
+                // each byte repeated four times, then the 2 bits of each lane selected by shifts and masks
+                int32_t bytes;
+                std::memcpy(&bytes, payload, 4);
+                __m128i x = _mm_cvtsi32_si128(bytes);
+                x = _mm_unpacklo_epi8(x, x);
+                x = _mm_unpacklo_epi16(x, x);
+                __m128i mask = _mm_set1_epi32(0x03);
+                result = _mm_or_si128(_mm_or_si128(_mm_and_si128(x, mask), _mm_and_si128(_mm_srli_epi16(x, 2), _mm_slli_epi32(mask, 8))),
+                                      _mm_or_si128(_mm_and_si128(_mm_srli_epi16(x, 4), _mm_slli_epi32(mask, 16)), _mm_and_si128(_mm_srli_epi16(x, 6), _mm_slli_epi32(mask, 24))));
+                break;
+            }
+            case BITS_4:
+            {
+                __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(payload));
+                __m128i mask = _mm_set1_epi8(0x0F);
+                result = _mm_unpacklo_epi8(_mm_and_si128(x, mask), _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+                break;
+            }
+            case BITS_8:
+                result = _mm_loadu_si128(reinterpret_cast<const __m128i*>(payload));
+                break;
+            default:
+                result = _mm_setzero_si128();
+                break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(group), result);
+#else
+        for (std::size_t i=0; i<GROUP_SIZE; i++)
+        {
+            switch (mode)
+            {
+                case BITS_2: group[i] = (payload[i / 4] >> (2 * (i % 4))) & 0x03; break;
+                case BITS_4: group[i] = (payload[i / 2] >> (4 * (i % 2))) & 0x0F; break;
+                case BITS_8: group[i] = payload[i]; break;
+                default: group[i] = 0; break;
+            }
+        }
+#endif
+    }
+
+    // Decodes a plane of 'groups' groups. Returns false if it goes past 'end'.
+    bool decode_plane(const uint8_t*& p, const uint8_t* end, std::size_t groups, uint8_t* plane)
+    {
+        const uint8_t* modes = p;
+        p += (groups + 3) / 4;
+        if (p > end)
+        {
+            return false;
+        }
+        for (std::size_t g=0; g<groups; g++)
+        {
+            GroupMode mode = static_cast<GroupMode>((modes[g / 4] >> (2 * (g % 4))) & 0x03);
+            // the SIMD loads of 4 and 8 bits groups read at most 8 bytes
+            if (static_cast<std::size_t>(end - p) < PAYLOAD_SIZES[mode])
+            {
+                return false;
+            }
+            decode_group(mode, p, plane + g * GROUP_SIZE);
+            p += PAYLOAD_SIZES[mode];
+        }
+        return true;
+    }
+
+    // Rebuilds the words of a column from its four planes: gathers their bytes, undoes the zigzag coding, and sums the differences
+    void decode_column(const uint8_t* const planes[4], std::size_t groups, uint32_t* column)
+    {
+#if defined(RENDERENGINE_SIMD_SSE) || defined(RENDERENGINE_SIMD_AVX)
+        __m128i previous = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi32(1);
+        for (std::size_t g=0; g<groups; g++)
+        {
+            __m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + g * GROUP_SIZE));
+            __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + g * GROUP_SIZE));
+            __m128i p2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[2] + g * GROUP_SIZE));
+            __m128i p3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[3] + g * GROUP_SIZE));
+            __m128i low_halves[2] = {_mm_unpacklo_epi8(p0, p1), _mm_unpackhi_epi8(p0, p1)};
+            __m128i high_halves[2] = {_mm_unpacklo_epi8(p2, p3), _mm_unpackhi_epi8(p2, p3)};
+            __m128i words[4] = {_mm_unpacklo_epi16(low_halves[0], high_halves[0]), _mm_unpackhi_epi16(low_halves[0], high_halves[0]),
+                                _mm_unpacklo_epi16(low_halves[1], high_halves[1]), _mm_unpackhi_epi16(low_halves[1], high_halves[1])};
+            for (std::size_t k=0; k<4; k++)
+            {
+                // zigzag decoding, then inclusive prefix sum of the four lanes, offset by the last word of the previous lanes
+                __m128i x = _mm_xor_si128(_mm_srli_epi32(words[k], 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(words[k], one)));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+                x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+                x = _mm_add_epi32(x, previous);
+                previous = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(column + g * GROUP_SIZE + k * 4), x);
+            }
+        }
+#else
+        uint32_t previous = 0;
+        for (std::size_t i=0; i<groups*GROUP_SIZE; i++)
+        {
+            uint32_t zigzag = planes[0][i] | (planes[1][i] << 8) | (planes[2][i] << 16) | (static_cast<uint32_t>(planes[3][i]) << 24);
+            previous += (zigzag >> 1) ^ (0u - (zigzag & 1u));
+            column[i] = previous;
+        }
+#endif
+    }
+
+    std::vector<char> encode_stream(const char* records, std::size_t count, std::size_t stride)
+    {
+        std::size_t columns = stride / sizeof(uint32_t);
+        std::size_t blocks = (count + MeshCodec::BLOCK_RECORDS - 1) / MeshCodec::BLOCK_RECORDS;
+        // blocks are encoded in parallel, then concatenated
+        std::vector<std::vector<char>> encoded_blocks(blocks);
+        Parallel::for_ranges(blocks, 1, [&](std::size_t first_block, std::size_t last_block)
+        {
+            std::vector<uint8_t> planes;
+            for (std::size_t b=first_block; b<last_block; b++)
+            {
+                std::size_t first = b * MeshCodec::BLOCK_RECORDS;
+                std::size_t records_count = std::min(MeshCodec::BLOCK_RECORDS, count - first);
+                std::size_t groups = groups_count(records_count);
+                std::size_t plane_size = groups * GROUP_SIZE;
+                for (std::size_t c=0; c<columns; c++)
+                {
+                    planes.assign(4 * plane_size, 0);
+                    uint32_t previous = 0;
+                    for (std::size_t i=0; i<records_count; i++)
+                    {
+                        uint32_t word;
+                        std::memcpy(&word, records + (first + i) * stride + c * sizeof(uint32_t), sizeof(uint32_t));
+                        uint32_t difference = word - previous;
+                        previous = word;
+                        uint32_t zigzag = (difference << 1) ^ (0u - (difference >> 31));
+                        for (std::size_t k=0; k<4; k++)
+                        {
+                            planes[k * plane_size + i] = static_cast<uint8_t>(zigzag >> (8 * k));
+                        }
+                    }
+                    for (std::size_t k=0; k<4; k++)
+                    {
+                        encode_plane(planes.data() + k * plane_size, groups, encoded_blocks[b]);
+                    }
+                }
+            }
+        });
+        std::vector<char> encoded(HEADER_SIZE + blocks * sizeof(uint64_t));
+        uint64_t records_count = count;
+        uint32_t header[2] = {static_cast<uint32_t>(stride), static_cast<uint32_t>(blocks)};
+        std::memcpy(encoded.data(), &records_count, sizeof(uint64_t));
+        std::memcpy(encoded.data() + sizeof(uint64_t), header, sizeof(header));
+        uint64_t block_end = 0;
+        for (std::size_t b=0; b<blocks; b++)
+        {
+            block_end += encoded_blocks[b].size();
+            std::memcpy(encoded.data() + HEADER_SIZE + b * sizeof(uint64_t), &block_end, sizeof(uint64_t));
+        }
+        for (const std::vector<char>& block : encoded_blocks)
+        {
+            encoded.insert(encoded.end(), block.begin(), block.end());
+        }
+        return encoded;
+    }
+
+    bool decode_stream(const char* data, std::size_t bytes_size, char* records, std::size_t count, std::size_t stride)
+    {
+        std::size_t blocks = (count + MeshCodec::BLOCK_RECORDS - 1) / MeshCodec::BLOCK_RECORDS;
+        uint64_t records_count;
+        uint32_t header[2];
+        if (bytes_size < HEADER_SIZE)
+        {
+            return false;
+        }
+        std::memcpy(&records_count, data, sizeof(uint64_t));
+        std::memcpy(header, data + sizeof(uint64_t), sizeof(header));
+        if (records_count != count || header[0] != stride || header[1] != blocks || (bytes_size - HEADER_SIZE) / sizeof(uint64_t) < blocks)
+        {
+            return false;
+        }
+        const uint8_t* blocks_begin = reinterpret_cast<const uint8_t*>(data) + HEADER_SIZE + blocks * sizeof(uint64_t);
+        const uint8_t* end = reinterpret_cast<const uint8_t*>(data) + bytes_size;
+        std::size_t columns = stride / sizeof(uint32_t);
+        std::atomic<bool> valid(true);
+        Parallel::for_ranges(blocks, 1, [&](std::size_t first_block, std::size_t last_block)
+        {
+            std::vector<uint8_t> planes(4 * MeshCodec::BLOCK_RECORDS);
+            std::vector<uint32_t> column(MeshCodec::BLOCK_RECORDS);
+            for (std::size_t b=first_block; b<last_block && valid; b++)
+            {
+                uint64_t block_begin = 0;
+                uint64_t block_end;
+                if (b > 0)
+                {
+                    std::memcpy(&block_begin, data + HEADER_SIZE + (b - 1) * sizeof(uint64_t), sizeof(uint64_t));
+                }
+                std::memcpy(&block_end, data + HEADER_SIZE + b * sizeof(uint64_t), sizeof(uint64_t));
+                if (block_begin > block_end || block_end > static_cast<uint64_t>(end - blocks_begin))
+                {
+                    valid = false;
+                    break;
+                }
+                const uint8_t* p = blocks_begin + block_begin;
+                const uint8_t* block_limit = blocks_begin + block_end;
+                std::size_t first = b * MeshCodec::BLOCK_RECORDS;
+                std::size_t records_count = std::min(MeshCodec::BLOCK_RECORDS, count - first);
+                std::size_t groups = groups_count(records_count);
+                std::size_t plane_size = groups * GROUP_SIZE;
+                const uint8_t* column_planes[4] = {planes.data(), planes.data() + plane_size, planes.data() + 2 * plane_size, planes.data() + 3 * plane_size};
+                for (std::size_t c=0; c<columns; c++)
+                {
+                    for (std::size_t k=0; k<4; k++)
+                    {
+                        if (!decode_plane(p, block_limit, groups, planes.data() + k * plane_size))
+                        {
+                            valid = false;
+                            return;
+                        }
+                    }
+                    decode_column(column_planes, groups, column.data());
+                    if (columns == 1)
+                    {
+                        std::memcpy(records + first * stride, column.data(), records_count * sizeof(uint32_t));
+                        continue;
+                    }
+                    char* word = records + first * stride + c * sizeof(uint32_t);
+                    for (std::size_t i=0; i<records_count; i++, word+=stride)
+                    {
+                        std::memcpy(word, &column[i], sizeof(uint32_t));
+                    }
+                }
+            }
+        });
+        return valid;
+    }
+}
+
+
+std::vector<char> MeshCodec::encode_vertices(const void* vertices, std::size_t count, std::size_t stride)
+{
+    return encode_stream(reinterpret_cast<const char*>(vertices), count, stride);
+}
+
+bool MeshCodec::decode_vertices(const char* data, std::size_t bytes_size, void* vertices, std::size_t count, std::size_t stride)
+{
+    return stride % sizeof(uint32_t) == 0 && decode_stream(data, bytes_size, reinterpret_cast<char*>(vertices), count, stride);
+}
+
+std::vector<char> MeshCodec::encode_indices(const uint32_t* indices, std::size_t count)
+{
+    return encode_stream(reinterpret_cast<const char*>(indices), count, sizeof(uint32_t));
+}
+
+bool MeshCodec::decode_indices(const char* data, std::size_t bytes_size, uint32_t* indices, std::size_t count)
+{
+    return decode_stream(data, bytes_size, reinterpret_cast<char*>(indices), count, sizeof(uint32_t));
+}
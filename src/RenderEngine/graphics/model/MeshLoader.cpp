@@ -0,0 +1,1876 @@
+#include <RenderEngine/graphics/model/MeshLoader.hpp>
+#include <RenderEngine/graphics/model/MeshBuilder.hpp>
+#include <RenderEngine/utilities/MappedFile.hpp>
+#include <RenderEngine/utilities/Parallel.hpp>
+#include <RenderEngine/utilities/Functions.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <RenderEngine/geometry/Vector.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <array>
+#include <limits>
+#include <thread>
+#include <functional>
+using namespace RenderEngine;
+
+namespace
+{
+    // Text files are parsed in chunks of at least this many bytes
+    constexpr std::size_t MIN_CHUNK_SIZE = 1 << 20;
+    // Binary items and attributes are decoded in ranges of at least this many items
+    constexpr std::size_t MIN_RANGE_SIZE = 1 << 16;
+
+    bool is_space(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    const char* skip_spaces(const char* p, const char* end)
+    {
+        while (p < end && is_space(*p))
+        {
+            p++;
+        }
+        return p;
+    }
+
+    // Returns the beginning of the next line
+    const char* next_line(const char* p, const char* end)
+    {
+        if (p >= end)
+        {
+            return end;
+        }
+        const char* line_end = reinterpret_cast<const char*>(std::memchr(p, '\n', end - p));
+        return (line_end == nullptr) ? end : line_end + 1;
+    }
+
+    // Returns true if the line starting at 'p' begins with the keyword, followed by a space
+    bool starts_with(const char* p, const char* end, const char* keyword)
+    {
+        std::size_t length = std::strlen(keyword);
+        return static_cast<std::size_t>(end - p) > length && std::memcmp(p, keyword, length) == 0 && is_space(p[length]);
+    }
+
+    // Splits [begin, end) in chunks starting at the beginning of lines, enough of them to balance the work between threads. Returns the chunk limits.
+    std::vector<const char*> line_chunks(const char* begin, const char* end)
+    {
+        std::size_t size = end - begin;
+        std::size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+        std::size_t count = std::max(static_cast<std::size_t>(1), std::min(size / MIN_CHUNK_SIZE, hardware_threads * 8));
+        std::vector<const char*> limits = {begin};
+        for (std::size_t i=1; i<count; i++)
+        {
+            const char* p = begin + (size * i) / count;
+            if (p <= limits.back())
+            {
+                continue;
+            }
+            p = next_line(p - 1, end);
+            if (p > limits.back() && p < end)
+            {
+                limits.push_back(p);
+            }
+        }
+        limits.push_back(end);
+        return limits;
+    }
+
+    // Parses a decimal number, without locale nor iostreams. Returns false if there is no number at 'p'.
+    bool parse_double(const char*& p, const char* end, double& value)
+    {
+        static const double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        const char* s = p;
+        bool negative = false;
+        if (s < end && (*s == '-' || *s == '+'))
+        {
+            negative = (*s == '-');
+            s++;
+        }
+        uint64_t mantissa = 0;
+        int exponent = 0;
+        bool digits = false;
+        for (; s < end && *s >= '0' && *s <= '9'; s++)
+        {
+            if (mantissa < 1000000000000000000ULL)
+            {
+                mantissa = mantissa * 10 + (*s - '0');
+            }
+            else
+            {
+                exponent++;
+            }
+            digits = true;
+        }
+        if (s < end && *s == '.')
+        {
+            for (s++; s < end && *s >= '0' && *s <= '9'; s++)
+            {
+                if (mantissa < 1000000000000000000ULL)
+                {
+                    mantissa = mantissa * 10 + (*s - '0');
+                    exponent--;
+                }
+                digits = true;
+            }
+        }
+        if (!digits)
+        {
+            return false;
+        }
+        if (s < end && (*s == 'e' || *s == 'E'))
+        {
+            const char* e = s + 1;
+            bool negative_exponent = false;
+            if (e < end && (*e == '-' || *e == '+'))
+            {
+                negative_exponent = (*e == '-');
+                e++;
+            }
+            int written = 0;
+            bool exponent_digits = false;
+            for (; e < end && *e >= '0' && *e <= '9'; e++)
+            {
+                written = std::min(written * 10 + (*e - '0'), 100000);
+                exponent_digits = true;
+            }
+            if (exponent_digits)
+            {
+                exponent += negative_exponent ? -written : written;
+                s = e;
+            }
+        }
+        double result = static_cast<double>(mantissa);
+        if (mantissa != 0 && exponent != 0)
+        {
+            if (exponent > 0 && exponent <= 22)
+            {
+                result *= powers[exponent];
+            }
+            else if (exponent < 0 && exponent >= -22)
+            {
+                result /= powers[-exponent];
+            }
+            else
+            {
+                result *= std::pow(10., exponent);
+            }
+        }
+        value = negative ? -result : result;
+        p = s;
+        return true;
+    }
+
+    bool parse_float(const char*& p, const char* end, float& value)
+    {
+        double parsed;
+        if (!parse_double(p, end, parsed))
+        {
+            return false;
+        }
+        value = static_cast<float>(parsed);
+        return true;
+    }
+
+    bool parse_integer(const char*& p, const char* end, int64_t& value)
+    {
+        const char* s = p;
+        bool negative = false;
+        if (s < end && (*s == '-' || *s == '+'))
+        {
+            negative = (*s == '-');
+            s++;
+        }
+        if (s == end || *s < '0' || *s > '9')
+        {
+            return false;
+        }
+        int64_t result = 0;
+        for (; s < end && *s >= '0' && *s <= '9'; s++)
+        {
+            result = std::min(result * 10 + (*s - '0'), static_cast<int64_t>(1) << 40);
+        }
+        value = negative ? -result : result;
+        p = s;
+        return true;
+    }
+
+    // Writes the triangles of a fan over the corners of a polygon
+    void polygon_triangles(const std::vector<std::array<uint32_t, 3>>& polygon, std::size_t triangle, uint32_t* positions, uint32_t* normals, uint32_t* UVs)
+    {
+        for (std::size_t i=1; i+1<polygon.size(); i++, triangle++)
+        {
+            const std::array<uint32_t, 3>* corners[3] = {&polygon[0], &polygon[i], &polygon[i+1]};
+            for (std::size_t k=0; k<3; k++)
+            {
+                positions[triangle*3+k] = (*corners[k])[0];
+                UVs[triangle*3+k] = (*corners[k])[1];
+                normals[triangle*3+k] = (*corners[k])[2];
+            }
+        }
+    }
+
+    enum ValueType {INT8, UINT8, INT16, UINT16, INT32, UINT32, FLOAT32, FLOAT64, UNKNOWN_TYPE};
+
+    std::size_t value_size(ValueType type)
+    {
+        static const std::size_t sizes[] = {1, 1, 2, 2, 4, 4, 4, 8, 0};
+        return sizes[type];
+    }
+
+    // Reads a value of the given type, stored in little endian order (or big endian if 'swap' is true)
+    double read_value(const char* p, ValueType type, bool swap)
+    {
+        unsigned char bytes[8];
+        std::size_t size = value_size(type);
+        std::memcpy(bytes, p, size);
+        if (swap)
+        {
+            std::reverse(bytes, bytes + size);
+        }
+        switch (type)
+        {
+            case INT8: {int8_t v; std::memcpy(&v, bytes, 1); return v;}
+            case UINT8: {uint8_t v; std::memcpy(&v, bytes, 1); return v;}
+            case INT16: {int16_t v; std::memcpy(&v, bytes, 2); return v;}
+            case UINT16: {uint16_t v; std::memcpy(&v, bytes, 2); return v;}
+            case INT32: {int32_t v; std::memcpy(&v, bytes, 4); return v;}
+            case UINT32: {uint32_t v; std::memcpy(&v, bytes, 4); return v;}
+            case FLOAT32: {float v; std::memcpy(&v, bytes, 4); return v;}
+            case FLOAT64: {double v; std::memcpy(&v, bytes, 8); return v;}
+            default: return 0.;
+        }
+    }
+
+    // Converts a value read from a file to an index, NONE if it is negative
+    uint32_t to_index(double value)
+    {
+        return (value < 0. || value >= static_cast<double>(MeshLoader::NONE)) ? MeshLoader::NONE : static_cast<uint32_t>(value);
+    }
+
+    bool little_endian_host()
+    {
+        uint16_t one = 1;
+        unsigned char first;
+        std::memcpy(&first, &one, 1);
+        return first == 1;
+    }
+
+    struct PlyProperty
+    {
+        std::string name;
+        ValueType type = UNKNOWN_TYPE; // type of the value, or of the items of a list
+        bool list = false;
+        ValueType count_type = UNKNOWN_TYPE; // type of the number of items of a list
+    };
+
+    struct PlyElement
+    {
+        std::string name;
+        std::size_t count = 0;
+        std::vector<PlyProperty> properties;
+        std::size_t stride = 0; // size in bytes of an item in binary files, if it has no list
+        bool has_lists = false;
+    };
+
+    ValueType ply_type(const std::string& name)
+    {
+        static const std::pair<const char*, ValueType> names[] = {{"char", INT8}, {"int8", INT8}, {"uchar", UINT8}, {"uint8", UINT8},
+                                                                  {"short", INT16}, {"int16", INT16}, {"ushort", UINT16}, {"uint16", UINT16},
+                                                                  {"int", INT32}, {"int32", INT32}, {"uint", UINT32}, {"uint32", UINT32},
+                                                                  {"float", FLOAT32}, {"float32", FLOAT32}, {"double", FLOAT64}, {"float64", FLOAT64}};
+        for (const std::pair<const char*, ValueType>& type : names)
+        {
+            if (name == type.first)
+            {
+                return type.second;
+            }
+        }
+        return UNKNOWN_TYPE;
+    }
+
+    // Splits a header line in words
+    std::vector<std::string> words(const char* p, const char* end)
+    {
+        std::vector<std::string> result;
+        while (true)
+        {
+            p = skip_spaces(p, end);
+            if (p == end || *p == '\n')
+            {
+                return result;
+            }
+            const char* word = p;
+            while (p < end && !is_space(*p) && *p != '\n')
+            {
+                p++;
+            }
+            result.emplace_back(word, p);
+        }
+    }
+
+    // Role of the properties of PLY vertices
+    enum VertexAttribute {POSITION_X, POSITION_Y, POSITION_Z, NORMAL_X, NORMAL_Y, NORMAL_Z, UV_X, UV_Y, OTHER_ATTRIBUTE};
+
+    VertexAttribute vertex_attribute(const std::string& name)
+    {
+        static const std::pair<const char*, VertexAttribute> names[] = {{"x", POSITION_X}, {"y", POSITION_Y}, {"z", POSITION_Z},
+                                                                        {"nx", NORMAL_X}, {"ny", NORMAL_Y}, {"nz", NORMAL_Z},
+                                                                        {"u", UV_X}, {"s", UV_X}, {"texture_u", UV_X}, {"texture_s", UV_X},
+                                                                        {"v", UV_Y}, {"t", UV_Y}, {"texture_v", UV_Y}, {"texture_t", UV_Y}};
+        for (const std::pair<const char*, VertexAttribute>& attribute : names)
+        {
+            if (name == attribute.first)
+            {
+                return attribute.second;
+            }
+        }
+        return OTHER_ATTRIBUTE;
+    }
+
+    // Stores a PLY vertex property in the vertex attributes
+    void set_vertex_attribute(VertexAttribute attribute, double value, vec3& position, vec3& normal, vec2& uv)
+    {
+        float v = static_cast<float>(value);
+        switch (attribute)
+        {
+            case POSITION_X: position.x = v; break;
+            case POSITION_Y: position.y = v; break;
+            case POSITION_Z: position.z = v; break;
+            case NORMAL_X: normal.x = v; break;
+            case NORMAL_Y: normal.y = v; break;
+            case NORMAL_Z: normal.z = v; break;
+            case UV_X: uv.x = v; break;
+            case UV_Y: uv.y = v; break;
+            default: break;
+        }
+    }
+
+    struct Json
+    {
+        enum Type {NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT};
+        Type type = NUL;
+        double number = 0.;
+        std::string string;
+        std::vector<Json> array;
+        std::vector<std::pair<std::string, Json>> object;
+
+        // Returns the member with the given key, or nullptr if there is none
+        const Json* find(const std::string& key) const
+        {
+            for (const std::pair<std::string, Json>& member : object)
+            {
+                if (member.first == key)
+                {
+                    return &member.second;
+                }
+            }
+            return nullptr;
+        }
+
+        // Returns the number member with the given key, or 'default_value' if there is none
+        double number_or(const std::string& key, double default_value) const
+        {
+            const Json* member = find(key);
+            return (member != nullptr && member->type == NUMBER) ? member->number : default_value;
+        }
+
+        // Returns the element of an array member, or nullptr if there is none
+        const Json* element(const std::string& key, std::size_t index) const
+        {
+            const Json* member = find(key);
+            return (member != nullptr && member->type == ARRAY && index < member->array.size()) ? &member->array[index] : nullptr;
+        }
+    };
+
+    class JsonParser
+    {
+    public:
+        JsonParser(const char* begin, const char* end) : _p(begin), _end(end) {}
+    public:
+        // Parses the document, returns false if it is malformed
+        bool parse(Json& value)
+        {
+            return _value(value, 0) && (_skip(), _p == _end);
+        }
+    protected:
+        static constexpr int MAX_DEPTH = 256;
+        void _skip()
+        {
+            while (_p < _end && (*_p == ' ' || *_p == '\t' || *_p == '\r' || *_p == '\n'))
+            {
+                _p++;
+            }
+        }
+        bool _literal(const char* literal)
+        {
+            std::size_t length = std::strlen(literal);
+            if (static_cast<std::size_t>(_end - _p) < length || std::memcmp(_p, literal, length) != 0)
+            {
+                return false;
+            }
+            _p += length;
+            return true;
+        }
+        bool _string(std::string& string)
+        {
+            if (_p == _end || *_p != '"')
+            {
+                return false;
+            }
+            for (_p++; _p < _end && *_p != '"'; _p++)
+            {
+                if (*_p != '\\')
+                {
+                    string.push_back(*_p);
+                    continue;
+                }
+                if (++_p == _end)
+                {
+                    return false;
+                }
+                switch (*_p)
+                {
+                    case 'b': string.push_back('\b'); break;
+                    case 'f': string.push_back('\f'); break;
+                    case 'n': string.push_back('\n'); break;
+                    case 'r': string.push_back('\r'); break;
+                    case 't': string.push_back('\t'); break;
+                    case 'u':
+                    {
+                        // code points of the basic multilingual plane, encoded in UTF-8
+                        if (_end - _p < 5)
+                        {
+                            return false;
+                        }
+                        unsigned int code = 0;
+                        for (int i=1; i<=4; i++)
+                        {
+                            char c = _p[i];
+                            unsigned int digit = (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : 16;
+                            if (digit > 15)
+                            {
+                                return false;
+                            }
+                            code = code * 16 + digit;
+                        }
+                        _p += 4;
+                        if (code < 0x80)
+                        {
+                            string.push_back(static_cast<char>(code));
+                        }
+                        else if (code < 0x800)
+                        {
+                            string.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                            string.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                        }
+                        else
+                        {
+                            string.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                            string.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                            string.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                        }
+                        break;
+                    }
+                    default: string.push_back(*_p); break;
+                }
+            }
+            if (_p == _end)
+            {
+                return false;
+            }
+            _p++;
+            return true;
+        }
+        bool _value(Json& value, int depth)
+        {
+            _skip();
+            if (_p == _end || depth > MAX_DEPTH)
+            {
+                return false;
+            }
+            if (*_p == '{')
+            {
+                value.type = Json::OBJECT;
+                _p++;
+                _skip();
+                if (_p < _end && *_p == '}')
+                {
+                    _p++;
+                    return true;
+                }
+                while (true)
+                {
+                    _skip();
+                    value.object.emplace_back();
+                    if (!_string(value.object.back().first))
+                    {
+                        return false;
+                    }
+                    _skip();
+                    if (_p == _end || *_p != ':')
+                    {
+                        return false;
+                    }
+                    _p++;
+                    if (!_value(value.object.back().second, depth + 1))
+                    {
+                        return false;
+                    }
+                    _skip();
+                    if (_p < _end && *_p == ',')
+                    {
+                        _p++;
+                        continue;
+                    }
+                    if (_p < _end && *_p == '}')
+                    {
+                        _p++;
+                        return true;
+                    }
+                    return false;
+                }
+            }
+            if (*_p == '[')
+            {
+                value.type = Json::ARRAY;
+                _p++;
+                _skip();
+                if (_p < _end && *_p == ']')
+                {
+                    _p++;
+                    return true;
+                }
+                while (true)
+                {
+                    value.array.emplace_back();
+                    if (!_value(value.array.back(), depth + 1))
+                    {
+                        return false;
+                    }
+                    _skip();
+                    if (_p < _end && *_p == ',')
+                    {
+                        _p++;
+                        continue;
+                    }
+                    if (_p < _end && *_p == ']')
+                    {
+                        _p++;
+                        return true;
+                    }
+                    return false;
+                }
+            }
+            if (*_p == '"')
+            {
+                value.type = Json::STRING;
+                return _string(value.string);
+            }
+            if (_literal("true") || _literal("false"))
+            {
+                value.type = Json::BOOLEAN;
+                value.number = (_p[-1] == 'e' && _p[-2] == 'u') ? 1. : 0.;
+                return true;
+            }
+            if (_literal("null"))
+            {
+                value.type = Json::NUL;
+                return true;
+            }
+            value.type = Json::NUMBER;
+            return parse_double(_p, _end, value.number);
+        }
+    protected:
+        const char* _p;
+        const char* _end;
+    };
+
+    // Decodes base64 data, returns false if it is malformed
+    bool decode_base64(const char* p, const char* end, std::string& decoded)
+    {
+        auto digit = [](char c) -> int
+        {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+            if (c >= '0' && c <= '9') return c - '0' + 52;
+            if (c == '+' || c == '-') return 62;
+            if (c == '/' || c == '_') return 63;
+            return -1;
+        };
+        uint32_t bits = 0;
+        int bits_count = 0;
+        decoded.reserve(((end - p) * 3) / 4);
+        for (; p < end && *p != '='; p++)
+        {
+            int value = digit(*p);
+            if (value < 0)
+            {
+                return false;
+            }
+            bits = (bits << 6) | static_cast<uint32_t>(value);
+            bits_count += 6;
+            if (bits_count >= 8)
+            {
+                bits_count -= 8;
+                decoded.push_back(static_cast<char>((bits >> bits_count) & 0xFF));
+            }
+        }
+        return true;
+    }
+
+    // Column major 4x4 matrices of the glTF node transforms
+    typedef std::array<double, 16> Matrix4;
+
+    Matrix4 multiply(const Matrix4& a, const Matrix4& b)
+    {
+        Matrix4 product;
+        for (int column=0; column<4; column++)
+        {
+            for (int row=0; row<4; row++)
+            {
+                double sum = 0.;
+                for (int k=0; k<4; k++)
+                {
+                    sum += a[k*4+row] * b[column*4+k];
+                }
+                product[column*4+row] = sum;
+            }
+        }
+        return product;
+    }
+
+    // Local transform of a glTF node, from its matrix or its translation, rotation (quaternion x, y, z, w) and scale
+    Matrix4 node_transform(const Json& node)
+    {
+        Matrix4 matrix = {1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1.};
+        const Json* values = node.find("matrix");
+        if (values != nullptr && values->type == Json::ARRAY && values->array.size() == 16)
+        {
+            for (std::size_t i=0; i<16; i++)
+            {
+                matrix[i] = values->array[i].number;
+            }
+            return matrix;
+        }
+        double t[3] = {0., 0., 0.};
+        double r[4] = {0., 0., 0., 1.};
+        double s[3] = {1., 1., 1.};
+        for (std::size_t i=0; i<3; i++)
+        {
+            const Json* translation = node.element("translation", i);
+            t[i] = (translation != nullptr) ? translation->number : 0.;
+            const Json* scale = node.element("scale", i);
+            s[i] = (scale != nullptr) ? scale->number : 1.;
+        }
+        for (std::size_t i=0; i<4; i++)
+        {
+            const Json* rotation = node.element("rotation", i);
+            r[i] = (rotation != nullptr) ? rotation->number : r[i];
+        }
+        double x = r[0], y = r[1], z = r[2], w = r[3];
+        double rotation[9] = {1.-2.*(y*y+z*z), 2.*(x*y+z*w), 2.*(x*z-y*w),
+                              2.*(x*y-z*w), 1.-2.*(x*x+z*z), 2.*(y*z+x*w),
+                              2.*(x*z+y*w), 2.*(y*z-x*w), 1.-2.*(x*x+y*y)};
+        for (int column=0; column<3; column++)
+        {
+            for (int row=0; row<3; row++)
+            {
+                matrix[column*4+row] = rotation[column*3+row] * s[column];
+            }
+            matrix[12+column] = t[column];
+        }
+        return matrix;
+    }
+
+    // The JSON document of a .gltf file, or of the JSON chunk of a .glb file, and the binary chunk of a .glb file (nullptr if there is none)
+    struct GltfChunks
+    {
+        const char* json_begin = nullptr;
+        const char* json_end = nullptr;
+        std::pair<const char*, std::size_t> binary = {nullptr, 0};
+    };
+
+    GltfChunks gltf_chunks(const char* begin, const char* end)
+    {
+        // a .glb file is a header followed by a JSON chunk and an optional binary chunk
+        GltfChunks chunks;
+        chunks.json_begin = begin;
+        chunks.json_end = end;
+        uint32_t header[3] = {0, 0, 0};
+        if (end - begin >= 12)
+        {
+            std::memcpy(header, begin, 12);
+        }
+        if (header[0] == 0x46546C67)
+        {
+            const char* p = begin + 12;
+            const char* file_end = begin + std::min(static_cast<std::size_t>(end - begin), static_cast<std::size_t>(header[2]));
+            chunks.json_begin = nullptr;
+            while (file_end - p >= 8)
+            {
+                uint32_t chunk[2];
+                std::memcpy(chunk, p, 8);
+                p += 8;
+                if (static_cast<std::size_t>(file_end - p) < chunk[0])
+                {
+                    THROW_ERROR("Malformed GLB file: the file is truncated");
+                }
+                if (chunk[1] == 0x4E4F534A && chunks.json_begin == nullptr)
+                {
+                    chunks.json_begin = p;
+                    chunks.json_end = p + chunk[0];
+                }
+                else if (chunk[1] == 0x004E4942 && chunks.binary.first == nullptr)
+                {
+                    chunks.binary = {p, chunk[0]};
+                }
+                p += chunk[0];
+            }
+            if (chunks.json_begin == nullptr)
+            {
+                THROW_ERROR("Malformed GLB file: no JSON chunk");
+            }
+        }
+        return chunks;
+    }
+
+    Json gltf_document(const GltfChunks& chunks)
+    {
+        Json document;
+        if (!JsonParser(chunks.json_begin, chunks.json_end).parse(document) || document.type != Json::OBJECT)
+        {
+            THROW_ERROR("Malformed glTF file");
+        }
+        return document;
+    }
+
+    // Path of the file of a glTF buffer uri which is not a data uri, relative paths being relative to the glTF file (and possibly percent-encoded)
+    std::string gltf_buffer_path(const std::string& gltf_path, const std::string& uri)
+    {
+        std::string file_name;
+        for (std::size_t k=0; k<uri.size(); k++)
+        {
+            const char* p = uri.c_str() + k;
+            unsigned int c;
+            if (*p == '%' && k + 2 < uri.size() && std::sscanf(p + 1, "%2x", &c) == 1)
+            {
+                file_name.push_back(static_cast<char>(c));
+                k += 2;
+            }
+            else
+            {
+                file_name.push_back(*p);
+            }
+        }
+        return gltf_path.substr(0, gltf_path.find_last_of("/\\") + 1) + file_name;
+    }
+
+    // An accessor of a glTF buffer: 'count' elements of 'components' components each
+    struct Accessor
+    {
+        const char* data = nullptr; // nullptr if the accessor has no buffer view (all zeros)
+        std::size_t count = 0;
+        std::size_t stride = 0;
+        int component_type = 5126;
+        std::size_t components = 1;
+        bool normalized = false;
+
+        float component(std::size_t i, std::size_t k) const
+        {
+            if (data == nullptr)
+            {
+                return 0.f;
+            }
+            const char* p = data + i * stride;
+            switch (component_type)
+            {
+                case 5120: {int8_t v; std::memcpy(&v, p + k, 1); return normalized ? std::max(v / 127.f, -1.f) : v;}
+                case 5121: {uint8_t v; std::memcpy(&v, p + k, 1); return normalized ? v / 255.f : v;}
+                case 5122: {int16_t v; std::memcpy(&v, p + 2*k, 2); return normalized ? std::max(v / 32767.f, -1.f) : v;}
+                case 5123: {uint16_t v; std::memcpy(&v, p + 2*k, 2); return normalized ? v / 65535.f : v;}
+                case 5125: {uint32_t v; std::memcpy(&v, p + 4*k, 4); return static_cast<float>(v);}
+                default: {float v; std::memcpy(&v, p + 4*k, 4); return v;}
+            }
+        }
+
+        uint32_t index(std::size_t i) const
+        {
+            if (data == nullptr)
+            {
+                return 0;
+            }
+            const char* p = data + i * stride;
+            switch (component_type)
+            {
+                case 5121: {uint8_t v; std::memcpy(&v, p, 1); return v;}
+                case 5123: {uint16_t v; std::memcpy(&v, p, 2); return v;}
+                default: {uint32_t v; std::memcpy(&v, p, 4); return v;}
+            }
+        }
+    };
+}
+
+
+MeshLoader::MeshLoader(const std::string& path, double smoothing_angle, SmoothNormals::Weighting weighting)
+{
+    MappedFile file(path);
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+    std::string extension = Utilities::to_upper(Utilities::extension(path));
+    if (extension == "OBJ")
+    {
+        _load_obj(begin, end);
+    }
+    else if (extension == "PLY")
+    {
+        _load_ply(begin, end);
+    }
+    else if (extension == "GLTF" || extension == "GLB")
+    {
+        _load_gltf(path, begin, end);
+    }
+    else
+    {
+        THROW_ERROR("Unsupported mesh file format '" + extension + "' of the file '" + path + "'");
+    }
+    _finish(smoothing_angle, weighting);
+}
+
+MeshLoader::~MeshLoader()
+{
+}
+
+std::size_t MeshLoader::triangles_count() const
+{
+    return _corner_positions.size() / 3;
+}
+
+std::size_t MeshLoader::vertices_count(bool indexed) const
+{
+    if (!indexed)
+    {
+        return _corner_positions.size();
+    }
+    return (_welded_corners.size() > 0) ? _welded_vertices.size() : _positions.size();
+}
+
+std::size_t MeshLoader::indices_count(bool indexed) const
+{
+    return indexed ? _corner_positions.size() : 0;
+}
+
+void MeshLoader::write(Vertex* vertices, uint32_t* indices, bool indexed, uint32_t palette) const
+{
+    auto corner_vertex = [&](std::size_t corner) -> Vertex
+    {
+        uint32_t position = _corner_positions[corner];
+        uint32_t normal = (_corner_normals.size() > 0) ? _corner_normals[corner] : position;
+        uint32_t uv = (_corner_UVs.size() > 0) ? _corner_UVs[corner] : ((_UVs.size() > 0) ? position : NONE);
+        return {_positions[position], _normals[normal], (uv != NONE) ? _UVs[uv] : vec2({0.f, 0.f}), palette};
+    };
+    if (!indexed)
+    {
+        Parallel::for_ranges(_corner_positions.size(), MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i=begin; i<end; i++)
+            {
+                vertices[i] = corner_vertex(i);
+            }
+        });
+        return;
+    }
+    const std::vector<uint32_t>& vertex_indices = (_welded_corners.size() > 0) ? _welded_corners : _corner_positions;
+    Parallel::for_ranges(vertex_indices.size(), MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        std::memcpy(indices + begin, vertex_indices.data() + begin, (end - begin) * sizeof(uint32_t));
+    });
+    if (_welded_corners.size() > 0)
+    {
+        Parallel::for_ranges(_welded_vertices.size(), MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i=begin; i<end; i++)
+            {
+                vertices[i] = corner_vertex(_welded_vertices[i]);
+            }
+        });
+    }
+    else
+    {
+        // all the attributes are indexed like the positions
+        Parallel::for_ranges(_positions.size(), MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i=begin; i<end; i++)
+            {
+                vertices[i] = {_positions[i], _normals[i], (_UVs.size() > 0) ? _UVs[i] : vec2({0.f, 0.f}), palette};
+            }
+        });
+    }
+}
+
+std::shared_ptr<Mesh> MeshLoader::mesh(const GPU* gpu, bool indexed, Mesh::VertexFormat format, bool levels_of_detail, bool meshlets,
+                                       const Color& color, const Material& material, Buffer::Memory memory) const
+{
+    if (triangles_count() == 0)
+    {
+        THROW_ERROR("The loaded file has no triangle");
+    }
+    std::size_t vertices_count = this->vertices_count(indexed);
+    std::size_t indices_count = this->indices_count(indexed);
+    std::shared_ptr<Buffer> buffer(new Buffer(gpu, Mesh::required_bytes_size(vertices_count, indices_count, format, levels_of_detail, meshlets),
+                                              VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, memory));
+    std::shared_ptr<Buffer> palette_buffer(new Buffer(gpu, sizeof(PaletteEntry), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+    std::shared_ptr<Mesh> mesh(new Mesh(buffer, 0, vertices_count, indices_count, palette_buffer, 0, 1, format, levels_of_detail, meshlets));
+    vec3 m = material.to_vec();
+    mesh->upload_palette({{color.to_vec4(), vec4({m.x, m.y, m.z, 0.f})}});
+    MeshBuilder builder(*mesh, vertices_count, indices_count);
+    write(builder.vertices(), builder.indices(), indexed, 0);
+    builder.finish();
+    return mesh;
+}
+
+std::vector<std::string> MeshLoader::dependencies(const std::string& path)
+{
+    std::vector<std::string> paths;
+    std::string extension = Utilities::to_upper(Utilities::extension(path));
+    if (extension == "GLTF" || extension == "GLB")
+    {
+        MappedFile file(path);
+        const char* begin = file.data();
+        Json document = gltf_document(gltf_chunks(begin, begin + file.size()));
+        const Json* buffers = document.find("buffers");
+        for (std::size_t i=0; buffers != nullptr && i<buffers->array.size(); i++)
+        {
+            const Json* uri = buffers->array[i].find("uri");
+            if (uri != nullptr && uri->string.compare(0, 5, "data:") != 0)
+            {
+                paths.push_back(gltf_buffer_path(path, uri->string));
+            }
+        }
+    }
+    return paths;
+}
+
+void MeshLoader::_load_obj(const char* begin, const char* end)
+{
+    // first pass: count the elements of each chunk of lines, to know where each chunk writes them
+    struct Counts
+    {
+        std::size_t positions = 0;
+        std::size_t normals = 0;
+        std::size_t UVs = 0;
+        std::size_t triangles = 0;
+    };
+    std::vector<const char*> limits = line_chunks(begin, end);
+    std::size_t chunks_count = limits.size() - 1;
+    std::vector<Counts> offsets(chunks_count + 1);
+    Parallel::for_ranges(chunks_count, 1, [&](std::size_t first_chunk, std::size_t last_chunk)
+    {
+        for (std::size_t chunk=first_chunk; chunk<last_chunk; chunk++)
+        {
+            Counts& counts = offsets[chunk + 1];
+            const char* chunk_end = limits[chunk + 1];
+            for (const char* line=limits[chunk]; line<chunk_end; line=next_line(line, chunk_end))
+            {
+                const char* p = skip_spaces(line, chunk_end);
+                if (starts_with(p, chunk_end, "v"))
+                {
+                    counts.positions++;
+                }
+                else if (starts_with(p, chunk_end, "vn"))
+                {
+                    counts.normals++;
+                }
+                else if (starts_with(p, chunk_end, "vt"))
+                {
+                    counts.UVs++;
+                }
+                else if (starts_with(p, chunk_end, "f"))
+                {
+                    std::size_t corners = 0;
+                    for (p=skip_spaces(p + 1, chunk_end); p < chunk_end && *p != '\n' && *p != '#'; p=skip_spaces(p, chunk_end))
+                    {
+                        while (p < chunk_end && !is_space(*p) && *p != '\n')
+                        {
+                            p++;
+                        }
+                        corners++;
+                    }
+                    counts.triangles += (corners >= 3) ? corners - 2 : 0;
+                }
+            }
+        }
+    });
+    for (std::size_t chunk=0; chunk<chunks_count; chunk++)
+    {
+        offsets[chunk + 1].positions += offsets[chunk].positions;
+        offsets[chunk + 1].normals += offsets[chunk].normals;
+        offsets[chunk + 1].UVs += offsets[chunk].UVs;
+        offsets[chunk + 1].triangles += offsets[chunk].triangles;
+    }
+    const Counts& totals = offsets.back();
+    _positions.resize(totals.positions);
+    _normals.resize(totals.normals);
+    _UVs.resize(totals.UVs);
+    _corner_positions.resize(totals.triangles * 3);
+    _corner_normals.resize(totals.triangles * 3);
+    _corner_UVs.resize(totals.triangles * 3);
+    // second pass: parse each chunk at its offsets. Negative indices are relative to the elements before the face.
+    std::vector<char> malformed(chunks_count, 0);
+    Parallel::for_ranges(chunks_count, 1, [&](std::size_t first_chunk, std::size_t last_chunk)
+    {
+        std::vector<std::array<uint32_t, 3>> polygon;
+        for (std::size_t chunk=first_chunk; chunk<last_chunk; chunk++)
+        {
+            Counts counts = offsets[chunk];
+            const char* chunk_end = limits[chunk + 1];
+            bool valid = true;
+            auto resolve = [](int64_t index, std::size_t count_before) -> uint32_t
+            {
+                int64_t resolved = (index > 0) ? index - 1 : static_cast<int64_t>(count_before) + index;
+                return (index == 0 || resolved < 0) ? NONE : static_cast<uint32_t>(std::min(resolved, static_cast<int64_t>(NONE)));
+            };
+            for (const char* line=limits[chunk]; line<chunk_end && valid; line=next_line(line, chunk_end))
+            {
+                const char* p = skip_spaces(line, chunk_end);
+                if (starts_with(p, chunk_end, "v"))
+                {
+                    vec3& position = _positions[counts.positions++];
+                    p += 1;
+                    valid = parse_float(p = skip_spaces(p, chunk_end), chunk_end, position.x) && parse_float(p = skip_spaces(p, chunk_end), chunk_end, position.y)
+                            && parse_float(p = skip_spaces(p, chunk_end), chunk_end, position.z);
+                }
+                else if (starts_with(p, chunk_end, "vn"))
+                {
+                    vec3& normal = _normals[counts.normals++];
+                    p += 2;
+                    valid = parse_float(p = skip_spaces(p, chunk_end), chunk_end, normal.x) && parse_float(p = skip_spaces(p, chunk_end), chunk_end, normal.y)
+                            && parse_float(p = skip_spaces(p, chunk_end), chunk_end, normal.z);
+                }
+                else if (starts_with(p, chunk_end, "vt"))
+                {
+                    vec2& uv = _UVs[counts.UVs++];
+                    uv.y = 0.f;
+                    p += 2;
+                    valid = parse_float(p = skip_spaces(p, chunk_end), chunk_end, uv.x);
+                    parse_float(p = skip_spaces(p, chunk_end), chunk_end, uv.y);
+                }
+                else if (starts_with(p, chunk_end, "f"))
+                {
+                    // corners 'v', 'v/vt', 'v//vn' or 'v/vt/vn'
+                    polygon.clear();
+                    for (p=skip_spaces(p + 1, chunk_end); valid && p < chunk_end && *p != '\n' && *p != '#'; p=skip_spaces(p, chunk_end))
+                    {
+                        std::array<uint32_t, 3> corner = {NONE, NONE, NONE};
+                        int64_t index;
+                        valid = parse_integer(p, chunk_end, index);
+                        corner[0] = resolve(index, counts.positions);
+                        if (valid && p < chunk_end && *p == '/')
+                        {
+                            p++;
+                            if (p < chunk_end && *p != '/')
+                            {
+                                valid = parse_integer(p, chunk_end, index);
+                                corner[1] = resolve(index, counts.UVs);
+                            }
+                            if (valid && p < chunk_end && *p == '/')
+                            {
+                                p++;
+                                valid = parse_integer(p, chunk_end, index);
+                                corner[2] = resolve(index, counts.normals);
+                            }
+                        }
+                        valid = valid && (p == chunk_end || is_space(*p) || *p == '\n');
+                        polygon.push_back(corner);
+                    }
+                    if (valid && polygon.size() >= 3)
+                    {
+                        polygon_triangles(polygon, counts.triangles, _corner_positions.data(), _corner_normals.data(), _corner_UVs.data());
+                        counts.triangles += polygon.size() - 2;
+                    }
+                }
+            }
+            malformed[chunk] = !valid;
+        }
+    });
+    if (std::find(malformed.begin(), malformed.end(), 1) != malformed.end())
+    {
+        THROW_ERROR("Malformed OBJ file");
+    }
+}
+
+void MeshLoader::_load_ply(const char* begin, const char* end)
+{
+    // header
+    if (end - begin < 4 || std::memcmp(begin, "ply", 3) != 0)
+    {
+        THROW_ERROR("Not a PLY file");
+    }
+    enum Format {ASCII, BINARY_LITTLE_ENDIAN, BINARY_BIG_ENDIAN};
+    Format format = ASCII;
+    std::vector<PlyElement> elements;
+    const char* data = nullptr;
+    for (const char* line=next_line(begin, end); line<end && data == nullptr; line=next_line(line, end))
+    {
+        std::vector<std::string> w = words(line, end);
+        if (w.size() == 0 || w[0] == "comment" || w[0] == "obj_info")
+        {
+            continue;
+        }
+        if (w[0] == "end_header")
+        {
+            data = next_line(line, end);
+        }
+        else if (w[0] == "format" && w.size() >= 2)
+        {
+            format = (w[1] == "binary_little_endian") ? BINARY_LITTLE_ENDIAN : (w[1] == "binary_big_endian") ? BINARY_BIG_ENDIAN : ASCII;
+        }
+        else if (w[0] == "element" && w.size() >= 3)
+        {
+            int64_t count;
+            const char* p = w[2].c_str();
+            if (!parse_integer(p, p + w[2].size(), count) || count < 0)
+            {
+                THROW_ERROR("Malformed PLY header");
+            }
+            elements.push_back({w[1], static_cast<std::size_t>(count), {}, 0, false});
+        }
+        else if (w[0] == "property" && elements.size() > 0)
+        {
+            PlyProperty property;
+            if (w.size() >= 5 && w[1] == "list")
+            {
+                property = {w[4], ply_type(w[3]), true, ply_type(w[2])};
+            }
+            else if (w.size() >= 3)
+            {
+                property = {w[2], ply_type(w[1]), false, UNKNOWN_TYPE};
+            }
+            if (property.type == UNKNOWN_TYPE || (property.list && property.count_type == UNKNOWN_TYPE))
+            {
+                THROW_ERROR("Unsupported PLY property '" + property.name + "'");
+            }
+            PlyElement& element = elements.back();
+            element.has_lists = element.has_lists || property.list;
+            element.stride += value_size(property.type);
+            element.properties.push_back(property);
+        }
+    }
+    if (data == nullptr)
+    {
+        THROW_ERROR("Malformed PLY header");
+    }
+    const PlyElement* vertex_element = nullptr;
+    const PlyElement* face_element = nullptr;
+    std::size_t face_list = 0;
+    for (const PlyElement& element : elements)
+    {
+        if (element.name == "vertex")
+        {
+            vertex_element = &element;
+        }
+        else if (element.name == "face")
+        {
+            face_element = &element;
+            face_list = std::find_if(element.properties.begin(), element.properties.end(), [](const PlyProperty& property)
+                {return property.list && (property.name == "vertex_indices" || property.name == "vertex_index");}) - element.properties.begin();
+        }
+    }
+    if (vertex_element == nullptr || vertex_element->has_lists)
+    {
+        THROW_ERROR("PLY files must have vertices without list properties");
+    }
+    if (face_element != nullptr && face_list == face_element->properties.size())
+    {
+        face_element = nullptr;
+    }
+    std::vector<VertexAttribute> attributes;
+    for (const PlyProperty& property : vertex_element->properties)
+    {
+        attributes.push_back(vertex_attribute(property.name));
+    }
+    bool has_normals = std::find(attributes.begin(), attributes.end(), NORMAL_X) != attributes.end();
+    bool has_UVs = std::find(attributes.begin(), attributes.end(), UV_X) != attributes.end();
+    _positions.resize(vertex_element->count);
+    _normals.resize(has_normals ? vertex_element->count : 0);
+    _UVs.resize(has_UVs ? vertex_element->count : 0);
+    // writes the triangle fan of a face, its attributes are indexed like its positions
+    auto write_face = [&](const uint32_t* polygon, std::size_t polygon_size, std::size_t triangle)
+    {
+        for (std::size_t i=1; i+1<polygon_size; i++, triangle++)
+        {
+            _corner_positions[triangle*3] = polygon[0];
+            _corner_positions[triangle*3+1] = polygon[i];
+            _corner_positions[triangle*3+2] = polygon[i+1];
+        }
+    };
+    std::atomic<bool> malformed(false);
+    if (format == ASCII)
+    {
+        // count the lines of each chunk, then the triangles of the face lines of each chunk, then parse the lines
+        std::vector<const char*> limits = line_chunks(data, end);
+        std::size_t chunks_count = limits.size() - 1;
+        std::vector<std::size_t> first_lines(chunks_count + 1, 0);
+        Parallel::for_ranges(chunks_count, 1, [&](std::size_t first_chunk, std::size_t last_chunk)
+        {
+            for (std::size_t chunk=first_chunk; chunk<last_chunk; chunk++)
+            {
+                for (const char* line=limits[chunk]; line<limits[chunk + 1]; line=next_line(line, limits[chunk + 1]))
+                {
+                    first_lines[chunk + 1]++;
+                }
+            }
+        });
+        for (std::size_t chunk=0; chunk<chunks_count; chunk++)
+        {
+            first_lines[chunk + 1] += first_lines[chunk];
+        }
+        std::size_t vertex_lines = 0;
+        std::size_t face_lines = 0;
+        std::size_t line_index = 0;
+        for (const PlyElement& element : elements)
+        {
+            if (&element == vertex_element)
+            {
+                vertex_lines = line_index;
+            }
+            else if (&element == face_element)
+            {
+                face_lines = line_index;
+            }
+            line_index += element.count;
+        }
+        if (first_lines.back() < line_index)
+        {
+            THROW_ERROR("Malformed PLY file: the file is truncated");
+        }
+        // reads the polygon of a face line
+        auto read_face = [&](const char* p, const char* line_end, std::vector<uint32_t>& polygon) -> bool
+        {
+            polygon.clear();
+            for (std::size_t i=0; i<face_element->properties.size(); i++)
+            {
+                const PlyProperty& property = face_element->properties[i];
+                double value;
+                if (!parse_double(p = skip_spaces(p, line_end), line_end, value))
+                {
+                    return false;
+                }
+                if (!property.list)
+                {
+                    continue;
+                }
+                std::size_t count = to_index(value);
+                for (std::size_t k=0; k<count; k++)
+                {
+                    if (!parse_double(p = skip_spaces(p, line_end), line_end, value))
+                    {
+                        return false;
+                    }
+                    if (i == face_list)
+                    {
+                        polygon.push_back(to_index(value));
+                    }
+                }
+            }
+            return true;
+        };
+        std::vector<std::size_t> first_triangles(chunks_count + 1, 0);
+        if (face_element != nullptr)
+        {
+            Parallel::for_ranges(chunks_count, 1, [&](std::size_t first_chunk, std::size_t last_chunk)
+            {
+                std::vector<uint32_t> polygon;
+                for (std::size_t chunk=first_chunk; chunk<last_chunk; chunk++)
+                {
+                    std::size_t line_index = first_lines[chunk];
+                    for (const char* line=limits[chunk]; line<limits[chunk + 1]; line=next_line(line, limits[chunk + 1]), line_index++)
+                    {
+                        if (line_index >= face_lines && line_index < face_lines + face_element->count)
+                        {
+                            if (!read_face(line, next_line(line, limits[chunk + 1]), polygon))
+                            {
+                                malformed = true;
+                            }
+                            first_triangles[chunk + 1] += (polygon.size() >= 3) ? polygon.size() - 2 : 0;
+                        }
+                    }
+                }
+            });
+            for (std::size_t chunk=0; chunk<chunks_count; chunk++)
+            {
+                first_triangles[chunk + 1] += first_triangles[chunk];
+            }
+        }
+        _corner_positions.resize(first_triangles.back() * 3);
+        Parallel::for_ranges(chunks_count, 1, [&](std::size_t first_chunk, std::size_t last_chunk)
+        {
+            std::vector<uint32_t> polygon;
+            for (std::size_t chunk=first_chunk; chunk<last_chunk; chunk++)
+            {
+                std::size_t line_index = first_lines[chunk];
+                std::size_t triangle = first_triangles[chunk];
+                for (const char* line=limits[chunk]; line<limits[chunk + 1]; line=next_line(line, limits[chunk + 1]), line_index++)
+                {
+                    const char* line_end = next_line(line, limits[chunk + 1]);
+                    if (line_index >= vertex_lines && line_index < vertex_lines + vertex_element->count)
+                    {
+                        std::size_t vertex = line_index - vertex_lines;
+                        vec3 normal;
+                        vec2 uv;
+                        const char* p = line;
+                        for (VertexAttribute attribute : attributes)
+                        {
+                            double value;
+                            if (!parse_double(p = skip_spaces(p, line_end), line_end, value))
+                            {
+                                malformed = true;
+                                break;
+                            }
+                            set_vertex_attribute(attribute, value, _positions[vertex], normal, uv);
+                        }
+                        if (has_normals)
+                        {
+                            _normals[vertex] = normal;
+                        }
+                        if (has_UVs)
+                        {
+                            _UVs[vertex] = uv;
+                        }
+                    }
+                    else if (face_element != nullptr && line_index >= face_lines && line_index < face_lines + face_element->count
+                             && read_face(line, line_end, polygon) && polygon.size() >= 3)
+                    {
+                        write_face(polygon.data(), polygon.size(), triangle);
+                        triangle += polygon.size() - 2;
+                    }
+                }
+            }
+        });
+    }
+    else
+    {
+        bool swap = (format == BINARY_LITTLE_ENDIAN) != little_endian_host();
+        const char* p = data;
+        for (const PlyElement& element : elements)
+        {
+            if (!element.has_lists)
+            {
+                if (element.count > 0 && static_cast<std::size_t>(end - p) / element.count < element.stride)
+                {
+                    THROW_ERROR("Malformed PLY file: the file is truncated");
+                }
+                if (&element == vertex_element)
+                {
+                    const char* vertices = p;
+                    Parallel::for_ranges(element.count, MIN_RANGE_SIZE, [&](std::size_t first, std::size_t last)
+                    {
+                        for (std::size_t i=first; i<last; i++)
+                        {
+                            const char* q = vertices + i * element.stride;
+                            vec3 normal;
+                            vec2 uv;
+                            for (std::size_t k=0; k<attributes.size(); k++)
+                            {
+                                set_vertex_attribute(attributes[k], read_value(q, element.properties[k].type, swap), _positions[i], normal, uv);
+                                q += value_size(element.properties[k].type);
+                            }
+                            if (has_normals)
+                            {
+                                _normals[i] = normal;
+                            }
+                            if (has_UVs)
+                            {
+                                _UVs[i] = uv;
+                            }
+                        }
+                    });
+                }
+                p += element.count * element.stride;
+                continue;
+            }
+            // the size of items with lists is only known by reading them in order: the faces are split in ranges, decoded afterward in parallel
+            struct Range
+            {
+                const char* data;
+                std::size_t first_item;
+                std::size_t first_triangle;
+            };
+            std::vector<Range> ranges;
+            std::size_t triangles_count = 0;
+            for (std::size_t i=0; i<element.count; i++)
+            {
+                if (&element == face_element && i % MIN_RANGE_SIZE == 0)
+                {
+                    ranges.push_back({p, i, triangles_count});
+                }
+                for (std::size_t k=0; k<element.properties.size(); k++)
+                {
+                    const PlyProperty& property = element.properties[k];
+                    std::size_t size = property.list ? value_size(property.count_type) : value_size(property.type);
+                    if (static_cast<std::size_t>(end - p) < size)
+                    {
+                        THROW_ERROR("Malformed PLY file: the file is truncated");
+                    }
+                    if (!property.list)
+                    {
+                        p += size;
+                        continue;
+                    }
+                    std::size_t count = to_index(read_value(p, property.count_type, swap));
+                    p += size;
+                    if ((end - p) / value_size(property.type) < count)
+                    {
+                        THROW_ERROR("Malformed PLY file: the file is truncated");
+                    }
+                    p += count * value_size(property.type);
+                    triangles_count += (&element == face_element && k == face_list && count >= 3) ? count - 2 : 0;
+                }
+            }
+            if (&element != face_element)
+            {
+                continue;
+            }
+            ranges.push_back({p, element.count, triangles_count});
+            _corner_positions.resize(triangles_count * 3);
+            Parallel::for_ranges(ranges.size() - 1, 1, [&](std::size_t first_range, std::size_t last_range)
+            {
+                std::vector<uint32_t> polygon;
+                for (std::size_t r=first_range; r<last_range; r++)
+                {
+                    const char* q = ranges[r].data;
+                    std::size_t triangle = ranges[r].first_triangle;
+                    for (std::size_t i=ranges[r].first_item; i<ranges[r+1].first_item; i++)
+                    {
+                        for (std::size_t k=0; k<element.properties.size(); k++)
+                        {
+                            const PlyProperty& property = element.properties[k];
+                            if (!property.list)
+                            {
+                                q += value_size(property.type);
+                                continue;
+                            }
+                            std::size_t count = to_index(read_value(q, property.count_type, swap));
+                            q += value_size(property.count_type);
+                            if (k == face_list)
+                            {
+                                polygon.resize(count);
+                                for (std::size_t c=0; c<count; c++)
+                                {
+                                    polygon[c] = to_index(read_value(q + c * value_size(property.type), property.type, swap));
+                                }
+                                if (count >= 3)
+                                {
+                                    write_face(polygon.data(), count, triangle);
+                                    triangle += count - 2;
+                                }
+                            }
+                            q += count * value_size(property.type);
+                        }
+                    }
+                }
+            });
+        }
+    }
+    if (malformed)
+    {
+        THROW_ERROR("Malformed PLY file");
+    }
+}
+
+void MeshLoader::_load_gltf(const std::string& path, const char* begin, const char* end)
+{
+    GltfChunks chunks = gltf_chunks(begin, end);
+    Json document = gltf_document(chunks);
+    // buffers: embedded as base64, in separate files relative to the glTF file, or in the binary chunk of a .glb
+    std::vector<std::unique_ptr<MappedFile>> files;
+    std::vector<std::unique_ptr<std::string>> decoded;
+    std::vector<std::pair<const char*, std::size_t>> buffers;
+    const Json* buffers_json = document.find("buffers");
+    for (std::size_t i=0; buffers_json != nullptr && i<buffers_json->array.size(); i++)
+    {
+        const Json& buffer = buffers_json->array[i];
+        const Json* uri = buffer.find("uri");
+        if (uri == nullptr)
+        {
+            if (chunks.binary.first == nullptr)
+            {
+                THROW_ERROR("Malformed glTF file: a buffer has no uri");
+            }
+            buffers.push_back(chunks.binary);
+        }
+        else if (uri->string.compare(0, 5, "data:") == 0)
+        {
+            std::size_t comma = uri->string.find(',');
+            decoded.emplace_back(new std::string());
+            if (comma == std::string::npos || uri->string.rfind(";base64", comma) == std::string::npos
+                || !decode_base64(uri->string.data() + comma + 1, uri->string.data() + uri->string.size(), *decoded.back()))
+            {
+                THROW_ERROR("Malformed glTF file: unsupported data uri");
+            }
+            buffers.push_back({decoded.back()->data(), decoded.back()->size()});
+        }
+        else
+        {
+            files.emplace_back(new MappedFile(gltf_buffer_path(path, uri->string)));
+            buffers.push_back({files.back()->data(), files.back()->size()});
+        }
+        if (static_cast<std::size_t>(buffer.number_or("byteLength", 0.)) > buffers.back().second)
+        {
+            THROW_ERROR("Malformed glTF file: a buffer is smaller than its byteLength");
+        }
+    }
+    auto accessor = [&](double index) -> Accessor
+    {
+        const Json* a = document.element("accessors", static_cast<std::size_t>(index));
+        if (a == nullptr)
+        {
+            THROW_ERROR("Malformed glTF file: missing accessor");
+        }
+        if (a->find("sparse") != nullptr)
+        {
+            THROW_ERROR("Sparse glTF accessors are not supported");
+        }
+        Accessor result;
+        result.count = static_cast<std::size_t>(a->number_or("count", 0.));
+        result.component_type = static_cast<int>(a->number_or("componentType", 5126.));
+        const Json* normalized = a->find("normalized");
+        result.normalized = normalized != nullptr && normalized->number != 0.;
+        const Json* type = a->find("type");
+        std::string type_name = (type != nullptr) ? type->string : "";
+        result.components = (type_name == "SCALAR") ? 1 : (type_name == "VEC2") ? 2 : (type_name == "VEC3") ? 3 : (type_name == "VEC4") ? 4 : 0;
+        std::size_t component_size = (result.component_type == 5120 || result.component_type == 5121) ? 1
+                                     : (result.component_type == 5122 || result.component_type == 5123) ? 2
+                                     : (result.component_type == 5125 || result.component_type == 5126) ? 4 : 0;
+        if (result.components == 0 || component_size == 0)
+        {
+            THROW_ERROR("Unsupported glTF accessor type");
+        }
+        std::size_t element_size = result.components * component_size;
+        result.stride = element_size;
+        const Json* view_index = a->find("bufferView");
+        if (view_index == nullptr)
+        {
+            return result;
+        }
+        const Json* view = document.element("bufferViews", static_cast<std::size_t>(view_index->number));
+        std::size_t buffer_index = (view != nullptr) ? static_cast<std::size_t>(view->number_or("buffer", 0.)) : buffers.size();
+        if (buffer_index >= buffers.size())
+        {
+            THROW_ERROR("Malformed glTF file: missing buffer view");
+        }
+        std::size_t view_offset = static_cast<std::size_t>(view->number_or("byteOffset", 0.));
+        std::size_t view_length = static_cast<std::size_t>(view->number_or("byteLength", 0.));
+        result.stride = std::max(static_cast<std::size_t>(view->number_or("byteStride", 0.)), element_size);
+        std::size_t offset = static_cast<std::size_t>(a->number_or("byteOffset", 0.));
+        if (view_offset > buffers[buffer_index].second || view_length > buffers[buffer_index].second - view_offset
+            || (result.count > 0 && (offset > view_length || view_length - offset < element_size
+                                     || (view_length - offset - element_size) / result.stride < result.count - 1)))
+        {
+            THROW_ERROR("Malformed glTF file: an accessor is out of its buffer");
+        }
+        result.data = buffers[buffer_index].first + view_offset + offset;
+        return result;
+    };
+    // appends the triangles of a mesh, placed by the given transform
+    auto add_mesh = [&](const Json& mesh, const Matrix4& m)
+    {
+        // normals are transformed by the cofactor matrix (the inverse transpose, up to the determinant), and mirroring transforms reverse the winding
+        double cofactors[9] = {m[5]*m[10] - m[6]*m[9], m[6]*m[8] - m[4]*m[10], m[4]*m[9] - m[5]*m[8],
+                               m[9]*m[2] - m[10]*m[1], m[10]*m[0] - m[8]*m[2], m[8]*m[1] - m[9]*m[0],
+                               m[1]*m[6] - m[2]*m[5], m[2]*m[4] - m[0]*m[6], m[0]*m[5] - m[1]*m[4]};
+        bool mirrored = m[0]*cofactors[0] + m[1]*cofactors[1] + m[2]*cofactors[2] < 0.;
+        const Json* primitives = mesh.find("primitives");
+        for (std::size_t i=0; primitives != nullptr && i<primitives->array.size(); i++)
+        {
+            const Json& primitive = primitives->array[i];
+            const Json* attributes = primitive.find("attributes");
+            // points, lines and triangle strips or fans are not imported
+            if (primitive.number_or("mode", 4.) != 4. || attributes == nullptr || attributes->find("POSITION") == nullptr)
+            {
+                continue;
+            }
+            Accessor positions = accessor(attributes->find("POSITION")->number);
+            Accessor normals;
+            Accessor UVs;
+            bool has_normals = attributes->find("NORMAL") != nullptr;
+            bool has_UVs = attributes->find("TEXCOORD_0") != nullptr;
+            if (has_normals)
+            {
+                normals = accessor(attributes->find("NORMAL")->number);
+            }
+            if (has_UVs)
+            {
+                UVs = accessor(attributes->find("TEXCOORD_0")->number);
+            }
+            if (positions.components != 3 || (has_normals && (normals.components != 3 || normals.count != positions.count))
+                || (has_UVs && (UVs.components != 2 || UVs.count != positions.count)))
+            {
+                THROW_ERROR("Malformed glTF file: invalid vertex attributes");
+            }
+            std::size_t first_vertex = _positions.size();
+            std::size_t vertices_count = positions.count;
+            _positions.resize(first_vertex + vertices_count);
+            // the primitives without normals or UVs get zeros: the normals are computed afterward
+            if (has_normals || _normals.size() > 0)
+            {
+                _normals.resize(first_vertex + vertices_count, vec3({0.f, 0.f, 0.f}));
+            }
+            if (has_UVs || _UVs.size() > 0)
+            {
+                _UVs.resize(first_vertex + vertices_count, vec2({0.f, 0.f}));
+            }
+            Parallel::for_ranges(vertices_count, MIN_RANGE_SIZE, [&](std::size_t first, std::size_t last)
+            {
+                for (std::size_t v=first; v<last; v++)
+                {
+                    double x = positions.component(v, 0), y = positions.component(v, 1), z = positions.component(v, 2);
+                    _positions[first_vertex + v] = vec3({static_cast<float>(m[0]*x + m[4]*y + m[8]*z + m[12]),
+                                                         static_cast<float>(m[1]*x + m[5]*y + m[9]*z + m[13]),
+                                                         static_cast<float>(m[2]*x + m[6]*y + m[10]*z + m[14])});
+                    if (has_normals)
+                    {
+                        x = normals.component(v, 0), y = normals.component(v, 1), z = normals.component(v, 2);
+                        double n[3] = {cofactors[0]*x + cofactors[3]*y + cofactors[6]*z, cofactors[1]*x + cofactors[4]*y + cofactors[7]*z,
+                                       cofactors[2]*x + cofactors[5]*y + cofactors[8]*z};
+                        double length = std::sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+                        length = (length > 0.) ? length : 1.;
+                        _normals[first_vertex + v] = vec3({static_cast<float>(n[0] / length), static_cast<float>(n[1] / length), static_cast<float>(n[2] / length)});
+                    }
+                    if (has_UVs)
+                    {
+                        _UVs[first_vertex + v] = vec2({UVs.component(v, 0), UVs.component(v, 1)});
+                    }
+                }
+            });
+            Accessor indices;
+            bool indexed = primitive.find("indices") != nullptr;
+            if (indexed)
+            {
+                indices = accessor(primitive.find("indices")->number);
+                if (indices.components != 1 || indices.component_type == 5126 || indices.component_type == 5120 || indices.component_type == 5122)
+                {
+                    THROW_ERROR("Malformed glTF file: invalid indices");
+                }
+            }
+            std::size_t triangles_count = (indexed ? indices.count : vertices_count) / 3;
+            std::size_t first_corner = _corner_positions.size();
+            _corner_positions.resize(first_corner + triangles_count * 3);
+            Parallel::for_ranges(triangles_count * 3, MIN_RANGE_SIZE, [&](std::size_t first, std::size_t last)
+            {
+                for (std::size_t c=first; c<last; c++)
+                {
+                    std::size_t source = (mirrored && c % 3 > 0) ? c - c % 3 + 3 - c % 3 : c;
+                    std::size_t index = indexed ? indices.index(source) : source;
+                    // indices out of the primitive are left invalid, to fail the checks
+                    _corner_positions[first_corner + c] = (index < vertices_count) ? static_cast<uint32_t>(first_vertex + index) : NONE;
+                }
+            });
+        }
+    };
+    const Json* meshes = document.find("meshes");
+    const Json* scene = document.element("scenes", static_cast<std::size_t>(document.number_or("scene", 0.)));
+    const Matrix4 identity = {1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1., 0., 0., 0., 0., 1.};
+    if (scene == nullptr)
+    {
+        // without scene, all the meshes are loaded untransformed
+        for (std::size_t i=0; meshes != nullptr && i<meshes->array.size(); i++)
+        {
+            add_mesh(meshes->array[i], identity);
+        }
+        return;
+    }
+    // depth first traversal of the nodes of the scene. Node hierarchies are disjoint trees: a node reached twice is a cycle or a shared node.
+    struct Node
+    {
+        std::size_t index;
+        Matrix4 parent_transform;
+    };
+    const Json* nodes = document.find("nodes");
+    std::vector<bool> visited(nodes != nullptr ? nodes->array.size() : 0, false);
+    std::vector<Node> stack;
+    const Json* roots = scene->find("nodes");
+    for (std::size_t i=0; roots != nullptr && i<roots->array.size(); i++)
+    {
+        stack.push_back({static_cast<std::size_t>(roots->array[i].number), identity});
+    }
+    while (stack.size() > 0)
+    {
+        Node node = stack.back();
+        stack.pop_back();
+        const Json* json = document.element("nodes", node.index);
+        if (json == nullptr || visited[node.index])
+        {
+            THROW_ERROR("Malformed glTF file: invalid node hierarchy");
+        }
+        visited[node.index] = true;
+        Matrix4 transform = multiply(node.parent_transform, node_transform(*json));
+        const Json* mesh = json->find("mesh");
+        if (mesh != nullptr)
+        {
+            const Json* mesh_json = (meshes != nullptr && mesh->number < meshes->array.size()) ? &meshes->array[static_cast<std::size_t>(mesh->number)] : nullptr;
+            if (mesh_json == nullptr)
+            {
+                THROW_ERROR("Malformed glTF file: missing mesh");
+            }
+            add_mesh(*mesh_json, transform);
+        }
+        const Json* children = json->find("children");
+        for (std::size_t i=0; children != nullptr && i<children->array.size(); i++)
+        {
+            stack.push_back({static_cast<std::size_t>(children->array[i].number), transform});
+        }
+    }
+}
+
+void MeshLoader::_finish(double smoothing_angle, SmoothNormals::Weighting weighting)
+{
+    std::size_t corners_count = _corner_positions.size();
+    std::size_t positions_count = _positions.size();
+    // every corner must reference existing attributes
+    std::atomic<bool> invalid(false);
+    Parallel::for_ranges(corners_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t c=begin; c<end; c++)
+        {
+            if (_corner_positions[c] >= positions_count
+                || (_corner_normals.size() > 0 && _corner_normals[c] != NONE && _corner_normals[c] >= _normals.size())
+                || (_corner_UVs.size() > 0 && _corner_UVs[c] != NONE && _corner_UVs[c] >= _UVs.size()))
+            {
+                invalid = true;
+            }
+        }
+    });
+    if (invalid)
+    {
+        THROW_ERROR("Malformed mesh file: a triangle references a missing vertex attribute");
+    }
+    // returns true if all the corners satisfy the predicate
+    auto all_corners = [&](const std::function<bool(std::size_t)>& predicate) -> bool
+    {
+        std::atomic<bool> result(true);
+        Parallel::for_ranges(corners_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t c=begin; c<end && result; c++)
+            {
+                if (!predicate(c))
+                {
+                    result = false;
+                }
+            }
+        });
+        return result;
+    };
+    auto is_zero = [](const vec3& v) -> bool {return v.x == 0.f && v.y == 0.f && v.z == 0.f;};
+    // missing normals are replaced by smooth normals, which may differ between the corners of a position on a hard edge
+    bool indexed_normals = _corner_normals.size() == 0;
+    bool missing_normals = _normals.size() == 0
+                           || (indexed_normals && std::any_of(_normals.begin(), _normals.end(), is_zero))
+                           || (!indexed_normals && !all_corners([&](std::size_t c) {return _corner_normals[c] != NONE && !is_zero(_normals[_corner_normals[c]]);}));
+    if (missing_normals)
+    {
+        std::vector<vec3> smooth_normals;
+        std::vector<uint32_t> smooth_corners = SmoothNormals::generate(_positions.data(), positions_count, _corner_positions.data(), corners_count,
+                                                                       smooth_normals, smoothing_angle, weighting);
+        if (indexed_normals)
+        {
+            _corner_normals = (_normals.size() > 0) ? _corner_positions : std::vector<uint32_t>(corners_count, NONE);
+        }
+        uint32_t first_smooth_normal = static_cast<uint32_t>(_normals.size());
+        _normals.insert(_normals.end(), smooth_normals.begin(), smooth_normals.end());
+        Parallel::for_ranges(corners_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t c=begin; c<end; c++)
+            {
+                if (_corner_normals[c] == NONE || is_zero(_normals[_corner_normals[c]]))
+                {
+                    _corner_normals[c] = first_smooth_normal + smooth_corners[c];
+                }
+            }
+        });
+    }
+    // attributes indexed like the positions do not need their own indices
+    if (_corner_normals.size() > 0 && _normals.size() >= positions_count && all_corners([&](std::size_t c) {return _corner_normals[c] == _corner_positions[c];}))
+    {
+        _corner_normals.clear();
+    }
+    if (_corner_UVs.size() > 0 && all_corners([&](std::size_t c) {return _corner_UVs[c] == NONE;}))
+    {
+        _corner_UVs.clear();
+        _UVs.clear();
+    }
+    if (_corner_UVs.size() > 0 && _UVs.size() >= positions_count && all_corners([&](std::size_t c) {return _corner_UVs[c] == _corner_positions[c];}))
+    {
+        _corner_UVs.clear();
+    }
+    if (_corner_normals.size() == 0 && _corner_UVs.size() == 0)
+    {
+        return;
+    }
+    // otherwise the indexed vertices are the distinct (position, normal, UV) combinations: the corners are grouped by position,
+    // each group is welded in parallel, then the groups are given consecutive vertex indices
+    std::vector<uint32_t> group_offsets(positions_count + 1, 0);
+    for (std::size_t c=0; c<corners_count; c++)
+    {
+        group_offsets[_corner_positions[c] + 1]++;
+    }
+    for (std::size_t i=0; i<positions_count; i++)
+    {
+        group_offsets[i + 1] += group_offsets[i];
+    }
+    std::vector<uint32_t> groups(corners_count);
+    std::vector<uint32_t> filled(group_offsets.begin(), group_offsets.end() - 1);
+    for (std::size_t c=0; c<corners_count; c++)
+    {
+        groups[filled[_corner_positions[c]]++] = static_cast<uint32_t>(c);
+    }
+    auto normal_of = [&](uint32_t c) -> uint32_t {return (_corner_normals.size() > 0) ? _corner_normals[c] : _corner_positions[c];};
+    auto UV_of = [&](uint32_t c) -> uint32_t {return (_corner_UVs.size() > 0) ? _corner_UVs[c] : _corner_positions[c];};
+    _welded_corners.resize(corners_count);
+    std::vector<uint32_t> first_vertices(positions_count + 1, 0);
+    Parallel::for_ranges(positions_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        std::vector<uint32_t> distinct;
+        for (std::size_t i=begin; i<end; i++)
+        {
+            distinct.clear();
+            for (uint32_t g=group_offsets[i]; g<group_offsets[i+1]; g++)
+            {
+                uint32_t c = groups[g];
+                std::size_t k = std::find_if(distinct.begin(), distinct.end(), [&](uint32_t other)
+                    {return normal_of(other) == normal_of(c) && UV_of(other) == UV_of(c);}) - distinct.begin();
+                if (k == distinct.size())
+                {
+                    distinct.push_back(c);
+                }
+                _welded_corners[c] = static_cast<uint32_t>(k);
+            }
+            first_vertices[i + 1] = static_cast<uint32_t>(distinct.size());
+        }
+    });
+    for (std::size_t i=0; i<positions_count; i++)
+    {
+        first_vertices[i + 1] += first_vertices[i];
+    }
+    _welded_vertices.resize(first_vertices.back());
+    Parallel::for_ranges(positions_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            // local vertex indices were given in order of first occurrence in the group
+            uint32_t next = 0;
+            for (uint32_t g=group_offsets[i]; g<group_offsets[i+1]; g++)
+            {
+                uint32_t c = groups[g];
+                if (_welded_corners[c] == next)
+                {
+                    _welded_vertices[first_vertices[i] + next++] = c;
+                }
+                _welded_corners[c] += first_vertices[i];
+            }
+        }
+    });
+}
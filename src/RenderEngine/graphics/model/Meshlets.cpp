@@ -0,0 +1,337 @@
+#include <RenderEngine/graphics/model/Meshlets.hpp>
+#include <RenderEngine/graphics/Frustum.hpp>
+#include <RenderEngine/geometry/BoundingSphere.hpp>
+#include <RenderEngine/geometry/Vector.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <array>
+#include <limits>
+using namespace RenderEngine;
+
+namespace
+{
+    // Hash and equality of the bits of a position, used to weld the vertices of the triangles
+    struct PositionHash
+    {
+        std::size_t operator()(const std::array<uint32_t, 3>& words) const
+        {
+            uint64_t hash = 14695981039346656037ULL;
+            for (uint32_t word : words)
+            {
+                hash = (hash ^ word) * 1099511628211ULL;
+            }
+            return static_cast<std::size_t>(hash ^ (hash >> 32));
+        }
+    };
+
+    std::array<uint32_t, 3> position_bits(const vec3& position)
+    {
+        std::array<uint32_t, 3> bits;
+        std::memcpy(bits.data(), &position, sizeof(vec3));
+        return bits;
+    }
+
+    // Bounding sphere and normals cone of the triangles of a meshlet
+    void meshlet_bounds(const Vertex* vertices, const uint32_t* indices, const uint32_t* triangles, Meshlet& meshlet)
+    {
+        std::array<std::vector<float>, 3> corners;
+        for (std::vector<float>& coordinates : corners)
+        {
+            coordinates.resize(meshlet.triangles_count * 3);
+        }
+        std::vector<Vector> normals;
+        normals.reserve(meshlet.triangles_count);
+        Vector axis(0., 0., 0.);
+        for (std::size_t i=0; i<meshlet.triangles_count; i++)
+        {
+            std::array<Vector, 3> points;
+            for (std::size_t k=0; k<3; k++)
+            {
+                std::size_t corner = triangles[i] * 3 + k;
+                const vec3& p = vertices[(indices != nullptr) ? indices[corner] : corner].position;
+                corners[0][i*3+k] = p.x;
+                corners[1][i*3+k] = p.y;
+                corners[2][i*3+k] = p.z;
+                points[k] = Vector(p.x, p.y, p.z);
+            }
+            // front faces are counter clockwise, with the normal 'cross(p1-p0, p2-p0)' pointing toward the viewer
+            Vector normal = Vector::cross(points[1] - points[0], points[2] - points[0]);
+            double norm = normal.norm();
+            if (norm > 0.)
+            {
+                normals.push_back(normal / norm);
+                axis += normals.back();
+            }
+        }
+        BoundingSphere sphere = BoundingSphere::from_points(corners[0].data(), corners[1].data(), corners[2].data(), corners[0].size());
+        meshlet.sphere = {static_cast<float>(sphere.center.x), static_cast<float>(sphere.center.y), static_cast<float>(sphere.center.z), static_cast<float>(sphere.radius)};
+        // the cone around the mean normal containing all the normals. A cone wider than a half space never faces away from the camera as a whole.
+        meshlet.cone = {0.f, 0.f, 0.f, 1.f};
+        double axis_norm = axis.norm();
+        if (axis_norm <= 0.)
+        {
+            return;
+        }
+        axis /= axis_norm;
+        double min_cosine = 1.;
+        for (const Vector& normal : normals)
+        {
+            min_cosine = std::min(min_cosine, Vector::dot(axis, normal));
+        }
+        meshlet.cone.r = static_cast<float>(axis.x);
+        meshlet.cone.g = static_cast<float>(axis.y);
+        meshlet.cone.b = static_cast<float>(axis.z);
+        if (min_cosine > 0.)
+        {
+            meshlet.cone.a = static_cast<float>(std::sqrt(1. - min_cosine*min_cosine));
+        }
+    }
+}
+
+std::vector<Meshlet> Meshlets::build(const Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count,
+                                     std::vector<uint32_t>& triangles_order)
+{
+    std::size_t triangles_count = ((indices != nullptr) ? indices_count : vertices_count) / 3;
+    triangles_order.clear();
+    triangles_order.reserve(triangles_count);
+    std::vector<Meshlet> meshlets;
+    if (triangles_count == 0)
+    {
+        return meshlets;
+    }
+    // weld the vertices by position, so that triangles on both sides of a seam (or of any edge of a non indexed mesh) are adjacent
+    std::unordered_map<std::array<uint32_t, 3>, uint32_t, PositionHash> position_index;
+    position_index.reserve(vertices_count);
+    std::vector<uint32_t> position_of(vertices_count);
+    for (std::size_t i=0; i<vertices_count; i++)
+    {
+        position_of[i] = position_index.emplace(position_bits(vertices[i].position), static_cast<uint32_t>(position_index.size())).first->second;
+    }
+    std::size_t positions_count = position_index.size();
+    position_index = {};
+    // the vertices counted in a meshlet are the indexed vertices, or the distinct positions if the mesh is not indexed
+    std::vector<uint32_t> corner_positions(triangles_count * 3);
+    std::vector<uint32_t> corner_keys(triangles_count * 3);
+    for (std::size_t corner=0; corner<triangles_count*3; corner++)
+    {
+        uint32_t vertex = (indices != nullptr) ? indices[corner] : static_cast<uint32_t>(corner);
+        corner_positions[corner] = position_of[vertex];
+        corner_keys[corner] = (indices != nullptr) ? vertex : position_of[vertex];
+    }
+    std::size_t keys_count = (indices != nullptr) ? vertices_count : positions_count;
+    // triangles around each position
+    std::vector<uint32_t> adjacency_offsets(positions_count + 1, 0);
+    for (uint32_t position : corner_positions)
+    {
+        adjacency_offsets[position + 1]++;
+    }
+    for (std::size_t i=0; i<positions_count; i++)
+    {
+        adjacency_offsets[i + 1] += adjacency_offsets[i];
+    }
+    std::vector<uint32_t> adjacency(triangles_count * 3);
+    {
+        std::vector<uint32_t> filled(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+        for (std::size_t corner=0; corner<triangles_count*3; corner++)
+        {
+            adjacency[filled[corner_positions[corner]]++] = static_cast<uint32_t>(corner / 3);
+        }
+    }
+    // centroids of the triangles, the candidate closest to the meshlet's centroid being added first
+    std::vector<vec3> centroids(triangles_count);
+    for (std::size_t t=0; t<triangles_count; t++)
+    {
+        vec3 sum = {0.f, 0.f, 0.f};
+        for (std::size_t k=0; k<3; k++)
+        {
+            const vec3& p = vertices[(indices != nullptr) ? indices[t*3+k] : t*3+k].position;
+            sum.x += p.x;
+            sum.y += p.y;
+            sum.z += p.z;
+        }
+        centroids[t] = {sum.x / 3.f, sum.y / 3.f, sum.z / 3.f};
+    }
+    const uint32_t none = std::numeric_limits<uint32_t>::max();
+    std::vector<bool> emitted(triangles_count, false);
+    std::vector<uint32_t> key_meshlet(keys_count, none); // meshlet the vertex was last added to
+    std::vector<uint32_t> queued_meshlet(triangles_count, none); // meshlet the triangle was last made a candidate of
+    std::vector<uint32_t> candidates; // triangles adjacent to the current meshlet (or to the previous one, to seed the next meshlet nearby)
+    std::size_t scan = 0; // all the triangles before it are emitted
+    while (triangles_order.size() < triangles_count)
+    {
+        uint32_t meshlet_index = static_cast<uint32_t>(meshlets.size());
+        Meshlet meshlet{};
+        meshlet.first_index = static_cast<uint32_t>(triangles_order.size() * 3);
+        std::size_t meshlet_vertices = 0;
+        vec3 centroid_sum = {0.f, 0.f, 0.f};
+        // number of vertices a triangle would add to the current meshlet
+        auto new_vertices = [&](uint32_t t) -> std::size_t
+        {
+            const uint32_t* keys = &corner_keys[t*3];
+            std::size_t count = 0;
+            for (std::size_t k=0; k<3; k++)
+            {
+                if (key_meshlet[keys[k]] != meshlet_index && (k < 1 || keys[k] != keys[0]) && (k < 2 || keys[k] != keys[1]))
+                {
+                    count++;
+                }
+            }
+            return count;
+        };
+        while (meshlet.triangles_count < MAX_TRIANGLES)
+        {
+            // pick a candidate adding no vertex, or else the closest one, dropping the candidates emitted since they were queued
+            uint32_t best = none;
+            std::size_t best_cost = 0;
+            bool best_free = false;
+            float best_distance = std::numeric_limits<float>::infinity();
+            vec3 centroid = {0.f, 0.f, 0.f};
+            if (meshlet.triangles_count > 0)
+            {
+                float inverse_count = 1.f / static_cast<float>(meshlet.triangles_count);
+                centroid = {centroid_sum.x * inverse_count, centroid_sum.y * inverse_count, centroid_sum.z * inverse_count};
+            }
+            std::size_t kept = 0;
+            for (uint32_t t : candidates)
+            {
+                if (emitted[t])
+                {
+                    continue;
+                }
+                candidates[kept++] = t;
+                std::size_t cost = new_vertices(t);
+                float dx = centroids[t].x - centroid.x;
+                float dy = centroids[t].y - centroid.y;
+                float dz = centroids[t].z - centroid.z;
+                float distance = (meshlet.triangles_count > 0) ? dx*dx + dy*dy + dz*dz : 0.f;
+                bool free = (cost == 0);
+                if ((free && !best_free) || (free == best_free && distance < best_distance))
+                {
+                    best = t;
+                    best_cost = cost;
+                    best_free = free;
+                    best_distance = distance;
+                }
+            }
+            candidates.resize(kept);
+            if (best == none)
+            {
+                // no adjacent triangle left: the meshlet is closed if it is large enough, otherwise it continues from the first triangle not emitted
+                if (meshlet.triangles_count >= MIN_TRIANGLES)
+                {
+                    break;
+                }
+                while (scan < triangles_count && emitted[scan])
+                {
+                    scan++;
+                }
+                if (scan == triangles_count)
+                {
+                    break;
+                }
+                best = static_cast<uint32_t>(scan);
+                best_cost = new_vertices(best);
+            }
+            if (meshlet_vertices + best_cost > MAX_VERTICES)
+            {
+                break;
+            }
+            // add the triangle to the meshlet, and its neighbours to the candidates
+            emitted[best] = true;
+            triangles_order.push_back(best);
+            meshlet.triangles_count++;
+            meshlet_vertices += best_cost;
+            centroid_sum.x += centroids[best].x;
+            centroid_sum.y += centroids[best].y;
+            centroid_sum.z += centroids[best].z;
+            for (std::size_t k=0; k<3; k++)
+            {
+                key_meshlet[corner_keys[best*3+k]] = meshlet_index;
+                uint32_t position = corner_positions[best*3+k];
+                for (uint32_t i=adjacency_offsets[position]; i<adjacency_offsets[position+1]; i++)
+                {
+                    uint32_t neighbour = adjacency[i];
+                    if (!emitted[neighbour] && queued_meshlet[neighbour] != meshlet_index)
+                    {
+                        queued_meshlet[neighbour] = meshlet_index;
+                        candidates.push_back(neighbour);
+                    }
+                }
+            }
+        }
+        meshlets.push_back(meshlet);
+    }
+    for (Meshlet& meshlet : meshlets)
+    {
+        meshlet_bounds(vertices, indices, &triangles_order[meshlet.first_index / 3], meshlet);
+    }
+    return meshlets;
+}
+
+std::size_t Meshlets::max_meshlets_count(std::size_t triangles_count)
+{
+    return (triangles_count + MIN_TRIANGLES - 1) / MIN_TRIANGLES;
+}
+
+std::vector<std::size_t> Meshlets::visible(const std::vector<Meshlet>& meshlets, const Frustum& frustum, const DrawParameters& params, bool cull_back_faces)
+{
+    const mat4& m = params.mesh_to_camera;
+    float scale = std::sqrt(std::max({m.i1j1*m.i1j1 + m.i1j2*m.i1j2 + m.i1j3*m.i1j3,
+                                      m.i2j1*m.i2j1 + m.i2j2*m.i2j2 + m.i2j3*m.i2j3,
+                                      m.i3j1*m.i3j1 + m.i3j2*m.i3j2 + m.i3j3*m.i3j3}));
+    // bounding spheres in camera coordinates
+    std::array<std::vector<float>, 4> spheres;
+    for (std::vector<float>& values : spheres)
+    {
+        values.resize(meshlets.size());
+    }
+    for (std::size_t i=0; i<meshlets.size(); i++)
+    {
+        const vec4& s = meshlets[i].sphere;
+        spheres[0][i] = m.i1j1*s.r + m.i2j1*s.g + m.i3j1*s.b + m.i4j1;
+        spheres[1][i] = m.i1j2*s.r + m.i2j2*s.g + m.i3j2*s.b + m.i4j2;
+        spheres[2][i] = m.i1j3*s.r + m.i2j3*s.g + m.i3j3*s.b + m.i4j3;
+        spheres[3][i] = s.a * scale;
+    }
+    std::vector<std::size_t> indexes = frustum.bulk_intersects(spheres[0].data(), spheres[1].data(), spheres[2].data(), spheres[3].data(), meshlets.size());
+    if (!cull_back_faces || scale <= 0.f || params.projection_type == ProjectionType::NONE)
+    {
+        return indexes;
+    }
+    // a meshlet faces away from the camera if all its normals make an acute angle with the view rays toward its bounding sphere.
+    // Perspective rays start from the focal point, at z = -focal_length in camera coordinates, equirectangular rays start from the camera, and orthographic rays follow +z.
+    const float eye_z = (params.projection_type == ProjectionType::PERSPECTIVE) ? -params.camera_parameters.b : 0.f;
+    const float inverse_scale = 1.f / scale;
+    std::size_t kept = 0;
+    for (std::size_t i : indexes)
+    {
+        const vec4& cone = meshlets[i].cone;
+        bool back_facing = false;
+        if (cone.a < 1.f)
+        {
+            float ax = (m.i1j1*cone.r + m.i2j1*cone.g + m.i3j1*cone.b) * inverse_scale;
+            float ay = (m.i1j2*cone.r + m.i2j2*cone.g + m.i3j2*cone.b) * inverse_scale;
+            float az = (m.i1j3*cone.r + m.i2j3*cone.g + m.i3j3*cone.b) * inverse_scale;
+            if (params.projection_type == ProjectionType::ORTHOGRAPHIC)
+            {
+                back_facing = (az >= cone.a);
+            }
+            else
+            {
+                float dx = spheres[0][i];
+                float dy = spheres[1][i];
+                float dz = spheres[2][i] - eye_z;
+                float distance = std::sqrt(dx*dx + dy*dy + dz*dz);
+                back_facing = (dx*ax + dy*ay + dz*az >= cone.a * distance + spheres[3][i]);
+            }
+        }
+        if (!back_facing)
+        {
+            indexes[kept++] = i;
+        }
+    }
+    indexes.resize(kept);
+    return indexes;
+}
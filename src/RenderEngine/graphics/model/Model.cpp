@@ -14,4 +14,40 @@ Model::Model(const std::shared_ptr<Mesh>& _mesh, const Vector& position, const Q
 
 Model::~Model()
 {
-}
\ No newline at end of file
+}
+
+BoundingBox Model::absolute_bounding_box() const
+{
+    if (mesh == nullptr)
+    {
+        return BoundingBox();
+    }
+    return mesh->bounding_box().transformed(absolute_transform());
+}
+
+BoundingSphere Model::absolute_bounding_sphere() const
+{
+    if (mesh == nullptr)
+    {
+        return BoundingSphere();
+    }
+    return mesh->bounding_sphere().transformed(absolute_transform());
+}
+
+BoundingBox Model::bounding_box_in(const Referential& other) const
+{
+    if (mesh == nullptr)
+    {
+        return BoundingBox();
+    }
+    return mesh->bounding_box().transformed(transform_in(other));
+}
+
+BoundingSphere Model::bounding_sphere_in(const Referential& other) const
+{
+    if (mesh == nullptr)
+    {
+        return BoundingSphere();
+    }
+    return mesh->bounding_sphere().transformed(transform_in(other));
+}
@@ -0,0 +1,322 @@
+#include <RenderEngine/graphics/model/Primitives.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <RenderEngine/utilities/Parallel.hpp>
+#include <array>
+#include <vector>
+#include <cmath>
+using namespace RenderEngine;
+
+namespace
+{
+    // Number of triangles generated by a thread, below which the work is not split further
+    constexpr std::size_t MIN_TRIANGLES_PER_THREAD = 32768;
+
+    Vertex make_vertex(const Vectorf& position, const Vectorf& normal, float u, float v, uint32_t palette)
+    {
+        return {position.to_vec3(), normal.to_vec3(), {u, v}, palette};
+    }
+
+    // Normal of a triangle, as computed by the Face constructor
+    Vectorf flat_normal(const Vectorf& p0, const Vectorf& p1, const Vectorf& p2)
+    {
+        return Vectorf::cross(p1 - p0, p2 - p0).normed();
+    }
+
+    // Writes a triangle with the normal of its plane
+    void flat_triangle(Vertex* vertices, const Vectorf& p0, const Vectorf& p1, const Vectorf& p2, const std::array<vec2, 3>& UVs, uint32_t palette)
+    {
+        Vectorf normal = flat_normal(p0, p1, p2);
+        vertices[0] = make_vertex(p0, normal, UVs[0].x, UVs[0].y, palette);
+        vertices[1] = make_vertex(p1, normal, UVs[1].x, UVs[1].y, palette);
+        vertices[2] = make_vertex(p2, normal, UVs[2].x, UVs[2].y, palette);
+    }
+
+    // The 12 corners of an icosahedron, and its 20 faces, in the order of Face::sphere
+    std::array<Vectorf, 12> icosahedron_corners(float radius)
+    {
+        const std::array<std::array<double, 2>, 12> theta_phi = {{{0, 0},
+                                                                  {PI/3, 0}, {PI/3, 2*PI/5}, {PI/3, 4*PI/5}, {PI/3, 6*PI/5}, {PI/3, 8*PI/5},
+                                                                  {2*PI/3, PI/5}, {2*PI/3, 3*PI/5}, {2*PI/3, 5*PI/5}, {2*PI/3, 7*PI/5}, {2*PI/3, 9*PI/5},
+                                                                  {PI, 0}}};
+        std::array<Vectorf, 12> corners;
+        for (std::size_t i=0; i<corners.size(); i++)
+        {
+            double theta = theta_phi[i][0];
+            double phi = theta_phi[i][1];
+            corners[i] = Vectorf(static_cast<float>(radius*std::sin(theta)*std::cos(phi)),
+                                 static_cast<float>(radius*std::sin(theta)*std::sin(phi)),
+                                 static_cast<float>(radius*std::cos(theta)));
+        }
+        return corners;
+    }
+
+    const std::array<std::array<uint8_t, 3>, 20> ICOSAHEDRON_FACES = {{{0,1,2},{0,2,3},{0,3,4},{0,4,5},{0,5,1},
+                                                                      {2,1,6},{3,2,7},{4,3,8},{5,4,9},{1,5,10},
+                                                                      {1,10,6},{2,6,7},{3,7,8},{4,8,9},{5,9,10},
+                                                                      {11,6,10},{11,7,6},{11,8,7},{11,9,8},{11,10,9}}};
+
+    // A point of the subdivided face of the icosahedron, projected on the sphere, with its spherical UV coordinates (as in Face::sphere)
+    struct SpherePoint
+    {
+        Vectorf position;
+        Vectorf normal;
+        vec2 uv;
+    };
+
+    // Points of the row 'j' of a subdivided face (see the diagram in Face::sphere), from the side (p0, p1) to the side (p1, p2)
+    void sphere_row(std::vector<SpherePoint>& row, const Vectorf& p0, const Vectorf& u, const Vectorf& v, uint32_t divides, uint32_t j, float radius)
+    {
+        row.resize(divides + 2 - j);
+        for (uint32_t k=0; k<row.size(); k++)
+        {
+            Vectorf direction = (p0 + u*static_cast<float>(k) + v*static_cast<float>(j)).normed();
+            SpherePoint& point = row[k];
+            point.position = direction * radius;
+            point.normal = direction;
+            point.uv = {std::atan2(std::sqrt(direction.x*direction.x + direction.y*direction.y), direction.z), std::atan2(direction.y, direction.x)};
+        }
+    }
+
+    // Writes the triangle (a, b, c) of a sphere
+    void sphere_triangle(Vertex* vertices, const SpherePoint& a, const SpherePoint& b, const SpherePoint& c, bool smooth_normals, uint32_t palette)
+    {
+        if (smooth_normals)
+        {
+            vertices[0] = make_vertex(a.position, a.normal, a.uv.x, a.uv.y, palette);
+            vertices[1] = make_vertex(b.position, b.normal, b.uv.x, b.uv.y, palette);
+            vertices[2] = make_vertex(c.position, c.normal, c.uv.x, c.uv.y, palette);
+        }
+        else
+        {
+            flat_triangle(vertices, a.position, b.position, c.position, {a.uv, b.uv, c.uv}, palette);
+        }
+    }
+
+    // Number of triangles of the strips before the strip 'j' of a subdivided face (strip j has 1 + 2*(divides-j) triangles)
+    std::size_t strips_triangles(uint32_t divides, uint32_t j)
+    {
+        return static_cast<std::size_t>(j) * (2*static_cast<std::size_t>(divides) + 2 - j);
+    }
+}
+
+std::size_t Primitives::quad_vertices_count()
+{
+    return 6;
+}
+
+void Primitives::quad(Vertex* vertices, const Vectorf& p1, const Vectorf& p2, const Vectorf& p3, const Vectorf& p4, uint32_t palette)
+{
+    flat_triangle(vertices, p1, p2, p3, {vec2({0.f, 0.f}), vec2({0.f, 1.f}), vec2({1.f, 1.f})}, palette);
+    flat_triangle(vertices+3, p1, p3, p4, {vec2({0.f, 0.f}), vec2({1.f, 1.f}), vec2({1.f, 0.f})}, palette);
+}
+
+std::size_t Primitives::cube_vertices_count()
+{
+    return 36;
+}
+
+void Primitives::cube(Vertex* vertices, float length, uint32_t palette)
+{
+    const float l = length/2;
+    // two triangles per side, as in Face::cube
+    const std::array<std::array<Vectorf, 3>, 12> triangles = {{{{{-l, -l, -l}, {-l, l, -l}, {l, l, -l}}}, {{{-l, -l, -l}, {l, l, -l}, {l, -l, -l}}},
+                                                               {{{-l, -l, l}, {l, l, l}, {-l, l, l}}}, {{{-l, -l, l}, {l, -l, l}, {l, l, l}}},
+                                                               {{{-l, -l, -l}, {l, -l, -l}, {l, -l, l}}}, {{{-l, -l, -l}, {l, -l, l}, {-l, -l, l}}},
+                                                               {{{-l, l, -l}, {l, l, l}, {l, l, -l}}}, {{{-l, l, -l}, {-l, l, l}, {l, l, l}}},
+                                                               {{{-l, -l, -l}, {-l, -l, l}, {-l, l, l}}}, {{{-l, -l, -l}, {-l, l, l}, {-l, l, -l}}},
+                                                               {{{l, -l, -l}, {l, l, l}, {l, -l, l}}}, {{{l, -l, -l}, {l, l, -l}, {l, l, l}}}}};
+    for (std::size_t i=0; i<triangles.size(); i+=2)
+    {
+        flat_triangle(vertices+3*i, triangles[i][0], triangles[i][1], triangles[i][2], {vec2({0.f, 0.f}), vec2({0.f, 1.f}), vec2({1.f, 1.f})}, palette);
+        flat_triangle(vertices+3*(i+1), triangles[i+1][0], triangles[i+1][1], triangles[i+1][2], {vec2({0.f, 0.f}), vec2({1.f, 1.f}), vec2({1.f, 0.f})}, palette);
+    }
+}
+
+std::size_t Primitives::sphere_vertices_count(uint32_t divides)
+{
+    return 20 * 3 * static_cast<std::size_t>(divides+1) * static_cast<std::size_t>(divides+1);
+}
+
+void Primitives::sphere(Vertex* vertices, float radius, uint32_t divides, bool smooth_normals, uint32_t palette)
+{
+    const std::array<Vectorf, 12> corners = icosahedron_corners(radius);
+    const std::size_t strips = 20 * static_cast<std::size_t>(divides+1);
+    const std::size_t face_triangles = static_cast<std::size_t>(divides+1) * static_cast<std::size_t>(divides+1);
+    // each strip of each face of the icosahedron is written at a precomputed position, so that ranges of strips can be generated in parallel
+    Parallel::for_ranges(strips, MIN_TRIANGLES_PER_THREAD / (divides+1) + 1, [&](std::size_t begin, std::size_t end)
+    {
+        std::vector<SpherePoint> top_row;
+        std::vector<SpherePoint> bottom_row;
+        for (std::size_t strip=begin; strip<end; strip++)
+        {
+            std::size_t face = strip / (divides+1);
+            uint32_t j = static_cast<uint32_t>(strip % (divides+1));
+            const Vectorf& p0 = corners[ICOSAHEDRON_FACES[face][0]];
+            Vectorf u = (corners[ICOSAHEDRON_FACES[face][1]] - p0) / static_cast<float>(divides+1);
+            Vectorf v = (corners[ICOSAHEDRON_FACES[face][2]] - p0) / static_cast<float>(divides+1);
+            sphere_row(top_row, p0, u, v, divides, j, radius);
+            sphere_row(bottom_row, p0, u, v, divides, j+1, radius);
+            Vertex* output = vertices + 3*(face*face_triangles + strips_triangles(divides, j));
+            // top of strip triangle, then two triangles per rectangle of the strip
+            sphere_triangle(output, top_row[0], top_row[1], bottom_row[0], smooth_normals, palette);
+            output += 3;
+            for (uint32_t k=0; k<divides-j; k++)
+            {
+                sphere_triangle(output, top_row[k+1], top_row[k+2], bottom_row[k+1], smooth_normals, palette);
+                sphere_triangle(output+3, top_row[k+1], bottom_row[k+1], bottom_row[k], smooth_normals, palette);
+                output += 6;
+            }
+        }
+    });
+}
+
+std::size_t Primitives::indexed_sphere_vertices_count(uint32_t divides)
+{
+    return 20 * static_cast<std::size_t>(divides+2) * static_cast<std::size_t>(divides+3) / 2;
+}
+
+std::size_t Primitives::indexed_sphere_indices_count(uint32_t divides)
+{
+    return sphere_vertices_count(divides);
+}
+
+void Primitives::indexed_sphere(Vertex* vertices, uint32_t* indices, float radius, uint32_t divides, uint32_t palette)
+{
+    const std::array<Vectorf, 12> corners = icosahedron_corners(radius);
+    const std::size_t strips = 20 * static_cast<std::size_t>(divides+1);
+    const std::size_t face_triangles = static_cast<std::size_t>(divides+1) * static_cast<std::size_t>(divides+1);
+    const std::size_t face_vertices = indexed_sphere_vertices_count(divides) / 20;
+    // index of the first vertex of the row 'j' of a face (row j has divides+2-j vertices)
+    auto row_offset = [divides](uint32_t j) {return static_cast<std::size_t>(j) * (divides+2) - static_cast<std::size_t>(j) * (j-1) / 2;};
+    Parallel::for_ranges(strips, MIN_TRIANGLES_PER_THREAD / (divides+1) + 1, [&](std::size_t begin, std::size_t end)
+    {
+        std::vector<SpherePoint> row;
+        for (std::size_t strip=begin; strip<end; strip++)
+        {
+            std::size_t face = strip / (divides+1);
+            uint32_t j = static_cast<uint32_t>(strip % (divides+1));
+            const Vectorf& p0 = corners[ICOSAHEDRON_FACES[face][0]];
+            Vectorf u = (corners[ICOSAHEDRON_FACES[face][1]] - p0) / static_cast<float>(divides+1);
+            Vectorf v = (corners[ICOSAHEDRON_FACES[face][2]] - p0) / static_cast<float>(divides+1);
+            // each strip writes the vertices of its top row, the last strip also writes the bottom corner of the face
+            for (uint32_t r=j; r<=((j == divides) ? j+1 : j); r++)
+            {
+                sphere_row(row, p0, u, v, divides, r, radius);
+                Vertex* output = vertices + face*face_vertices + row_offset(r);
+                for (const SpherePoint& point : row)
+                {
+                    *(output++) = make_vertex(point.position, point.normal, point.uv.x, point.uv.y, palette);
+                }
+            }
+            // triangles of the strip, in the order of 'sphere'
+            uint32_t top = static_cast<uint32_t>(face*face_vertices + row_offset(j));
+            uint32_t bottom = static_cast<uint32_t>(face*face_vertices + row_offset(j+1));
+            uint32_t* output = indices + 3*(face*face_triangles + strips_triangles(divides, j));
+            output[0] = top;
+            output[1] = top+1;
+            output[2] = bottom;
+            output += 3;
+            for (uint32_t k=0; k<divides-j; k++)
+            {
+                output[0] = top+k+1;
+                output[1] = top+k+2;
+                output[2] = bottom+k+1;
+                output[3] = top+k+1;
+                output[4] = bottom+k+1;
+                output[5] = bottom+k;
+                output += 6;
+            }
+        }
+    });
+}
+
+std::size_t Primitives::cylinder_vertices_count(uint32_t divides)
+{
+    return 12 * static_cast<std::size_t>(divides);
+}
+
+void Primitives::cylinder(Vertex* vertices, float length, float radius, uint32_t divides, bool smooth_normals, uint32_t palette)
+{
+    const Vectorf z(0.f, 0.f, length);
+    const Vectorf center(0.f, 0.f, 0.f);
+    // two side triangles and one triangle on each extremity per division, as in Face::cylinder
+    Parallel::for_ranges(divides, MIN_TRIANGLES_PER_THREAD / 4, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            float t1 = static_cast<float>(i) / divides;
+            float t2 = static_cast<float>(i+1) / divides;
+            Vectorf n1(std::cos(static_cast<float>(2*PI)*t1), std::sin(static_cast<float>(2*PI)*t1), 0.f);
+            Vectorf n2(std::cos(static_cast<float>(2*PI)*t2), std::sin(static_cast<float>(2*PI)*t2), 0.f);
+            Vectorf p1 = n1 * radius;
+            Vectorf p2 = n2 * radius;
+            Vertex* output = vertices + 12*i;
+            // sides
+            if (smooth_normals)
+            {
+                output[0] = make_vertex(p1+z, n1, 0.65f, t1, palette);
+                output[1] = make_vertex(p1, n1, 0.35f, t1, palette);
+                output[2] = make_vertex(p2, n2, 0.35f, t2, palette);
+                output[3] = make_vertex(p1+z, n1, 0.65f, t1, palette);
+                output[4] = make_vertex(p2, n2, 0.35f, t2, palette);
+                output[5] = make_vertex(p2+z, n2, 0.65f, t2, palette);
+            }
+            else
+            {
+                flat_triangle(output, p1+z, p1, p2, {vec2({0.65f, t1}), vec2({0.35f, t1}), vec2({0.35f, t2})}, palette);
+                flat_triangle(output+3, p1+z, p2, p2+z, {vec2({0.65f, t1}), vec2({0.35f, t2}), vec2({0.65f, t2})}, palette);
+            }
+            // circular extremities
+            vec2 uv1 = {n1.x*0.29f, n1.y*0.97f};
+            vec2 uv2 = {n2.x*0.29f, n2.y*0.97f};
+            flat_triangle(output+6, p1, center, p2, {vec2({uv1.x + 0.15f, uv1.y + 0.015f}), vec2({0.15f, 0.5f}), vec2({uv2.x + 0.15f, uv2.y + 0.015f})}, palette);
+            flat_triangle(output+9, p2+z, z, p1+z, {vec2({uv2.x + 0.85f, uv2.y + 0.015f}), vec2({0.85f, 0.5f}), vec2({uv1.x + 0.85f, uv1.y + 0.015f})}, palette);
+        }
+    });
+}
+
+std::size_t Primitives::cone_vertices_count(uint32_t divides)
+{
+    return 6 * static_cast<std::size_t>(divides);
+}
+
+void Primitives::cone(Vertex* vertices, float length, float radius, uint32_t divides, bool smooth_normals, uint32_t palette)
+{
+    const Vectorf z(0.f, 0.f, length);
+    const Vectorf center(0.f, 0.f, 0.f);
+    // the normal of the side at an angle 'a' around the axis is (length*cos(a), length*sin(a), radius) normalized
+    const float norm = std::sqrt(length*length + radius*radius);
+    const float normal_xy = (norm > 0.f) ? length/norm : 0.f;
+    const float normal_z = (norm > 0.f) ? radius/norm : 0.f;
+    // one triangle on the base and one on the side per division, as in Face::cone
+    Parallel::for_ranges(divides, MIN_TRIANGLES_PER_THREAD / 2, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            float t1 = static_cast<float>(i) / divides;
+            float t2 = static_cast<float>(i+1) / divides;
+            float tm = (t1 + t2) / 2;
+            Vectorf n1(std::cos(static_cast<float>(2*PI)*t1), std::sin(static_cast<float>(2*PI)*t1), 0.f);
+            Vectorf n2(std::cos(static_cast<float>(2*PI)*t2), std::sin(static_cast<float>(2*PI)*t2), 0.f);
+            Vectorf p1 = n1 * radius;
+            Vectorf p2 = n2 * radius;
+            Vertex* output = vertices + 6*i;
+            // base
+            vec2 uv1 = {n1.x*0.29f, n1.y*0.97f};
+            vec2 uv2 = {n2.x*0.29f, n2.y*0.97f};
+            flat_triangle(output, p1, center, p2, {vec2({uv1.x + 0.15f, uv1.y + 0.015f}), vec2({0.15f, 0.5f}), vec2({uv2.x + 0.15f, uv2.y + 0.015f})}, palette);
+            // side
+            if (smooth_normals)
+            {
+                Vectorf nm(std::cos(static_cast<float>(2*PI)*tm)*normal_xy, std::sin(static_cast<float>(2*PI)*tm)*normal_xy, normal_z);
+                output[3] = make_vertex(z, nm, 1.f, 0.5f, palette);
+                output[4] = make_vertex(p1, Vectorf(n1.x*normal_xy, n1.y*normal_xy, normal_z), 0.35f, t1, palette);
+                output[5] = make_vertex(p2, Vectorf(n2.x*normal_xy, n2.y*normal_xy, normal_z), 0.35f, t2, palette);
+            }
+            else
+            {
+                flat_triangle(output+3, z, p1, p2, {vec2({1.f, 0.5f}), vec2({0.35f, t1}), vec2({0.35f, t2})}, palette);
+            }
+        }
+    });
+}
@@ -0,0 +1,561 @@
+#include <RenderEngine/graphics/model/Simplifier.hpp>
+#include <RenderEngine/geometry/Vector.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <array>
+#include <limits>
+using namespace RenderEngine;
+
+namespace
+{
+    // Weight of the planes constraining the border and seam edges, relative to the planes of the triangles
+    constexpr double BOUNDARY_WEIGHT = 10.;
+    // A collapse is rejected if it rotates the normal of a triangle by more than about 75 degrees
+    constexpr double MIN_NORMAL_COSINE = 0.25;
+
+    // Hash of the bits of a few 32 bits words, used to weld the positions and the wedges
+    template<std::size_t N>
+    struct WordsHash
+    {
+        std::size_t operator()(const std::array<uint32_t, N>& words) const
+        {
+            uint64_t hash = 14695981039346656037ULL;
+            for (uint32_t word : words)
+            {
+                hash = (hash ^ word) * 1099511628211ULL;
+            }
+            return static_cast<std::size_t>(hash ^ (hash >> 32));
+        }
+    };
+
+    uint32_t float_bits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    // Sum of squared distances to planes, weighted by the area of the triangles the planes come from
+    struct Quadric
+    {
+        double a00 = 0., a01 = 0., a02 = 0., a11 = 0., a12 = 0., a22 = 0.;
+        double b0 = 0., b1 = 0., b2 = 0.;
+        double c = 0.;
+        double weight = 0.;
+
+        // Adds the plane of unit normal 'n' going through 'point'
+        void add_plane(const Vector& n, const Vector& point, double w)
+        {
+            double d = -Vector::dot(n, point);
+            a00 += w*n.x*n.x; a01 += w*n.x*n.y; a02 += w*n.x*n.z;
+            a11 += w*n.y*n.y; a12 += w*n.y*n.z; a22 += w*n.z*n.z;
+            b0 += w*n.x*d; b1 += w*n.y*d; b2 += w*n.z*d;
+            c += w*d*d;
+        }
+
+        void add(const Quadric& q)
+        {
+            a00 += q.a00; a01 += q.a01; a02 += q.a02;
+            a11 += q.a11; a12 += q.a12; a22 += q.a22;
+            b0 += q.b0; b1 += q.b1; b2 += q.b2;
+            c += q.c;
+            weight += q.weight;
+        }
+
+        // Mean squared distance of the point to the planes
+        double error(const Vector& p) const
+        {
+            double e = a00*p.x*p.x + a11*p.y*p.y + a22*p.z*p.z
+                     + 2.*(a01*p.x*p.y + a02*p.x*p.z + a12*p.y*p.z)
+                     + 2.*(b0*p.x + b1*p.y + b2*p.z) + c;
+            return std::max(e, 0.) / (weight > 0. ? weight : 1.);
+        }
+    };
+
+    // An edge of a triangle, between the positions a < b, with the wedges of the triangle at a and b
+    struct TriangleEdge
+    {
+        uint32_t a, b;
+        uint32_t wedge_a, wedge_b;
+        bool operator<(const TriangleEdge& other) const {return (a < other.a) || (a == other.a && b < other.b);}
+    };
+
+    // A candidate collapse of the position 'from' onto the position 'to'
+    struct Collapse
+    {
+        uint32_t from, to;
+        std::size_t edge; // index of the first TriangleEdge of the collapsed edge
+        std::size_t edge_count; // number of triangles on the edge
+        double cost;
+    };
+
+    enum Kind {INTERIOR, BOUNDARY, LOCKED};
+
+    // Progressive simplification of a mesh. Positions are the distinct vertex positions, and wedges the distinct (position, UV, palette) of the vertices.
+    // Triangles reference wedges, and a collapse moves the wedges of a position onto the wedges of a neighbour position.
+    class Simplification
+    {
+    public:
+        Simplification(const Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count)
+        {
+            std::unordered_map<std::array<uint32_t, 3>, uint32_t, WordsHash<3>> position_index;
+            std::unordered_map<std::array<uint32_t, 4>, uint32_t, WordsHash<4>> wedge_index;
+            std::vector<uint32_t> vertex_wedge(vertices_count);
+            for (std::size_t i=0; i<vertices_count; i++)
+            {
+                const Vertex& v = vertices[i];
+                std::array<uint32_t, 3> position_key = {float_bits(v.position.x), float_bits(v.position.y), float_bits(v.position.z)};
+                uint32_t position = position_index.emplace(position_key, static_cast<uint32_t>(_points.size())).first->second;
+                if (position == _points.size())
+                {
+                    _points.push_back(Vector(v.position.x, v.position.y, v.position.z));
+                }
+                std::array<uint32_t, 4> wedge_key = {position, float_bits(v.uv.x), float_bits(v.uv.y), v.palette};
+                uint32_t wedge = wedge_index.emplace(wedge_key, static_cast<uint32_t>(_wedge_position.size())).first->second;
+                if (wedge == _wedge_position.size())
+                {
+                    _wedge_position.push_back(position);
+                    _wedge_vertex.push_back(static_cast<uint32_t>(i));
+                    _wedge_remap.push_back(wedge);
+                }
+                vertex_wedge[i] = wedge;
+            }
+            std::size_t corners_count = (indices != nullptr) ? indices_count : vertices_count;
+            for (std::size_t i=0; i+2<corners_count; i+=3)
+            {
+                std::array<uint32_t, 3> triangle;
+                for (std::size_t k=0; k<3; k++)
+                {
+                    triangle[k] = vertex_wedge[(indices != nullptr) ? indices[i+k] : i+k];
+                }
+                if (!_degenerate(triangle))
+                {
+                    _triangles.push_back(triangle);
+                }
+            }
+            // planes of the triangles
+            _quadrics.resize(_points.size());
+            for (const std::array<uint32_t, 3>& triangle : _triangles)
+            {
+                Vector normal = _normal(triangle, std::numeric_limits<uint32_t>::max(), 0);
+                double area = 0.5 * normal.norm();
+                if (area <= 0.)
+                {
+                    continue;
+                }
+                for (uint32_t wedge : triangle)
+                {
+                    Quadric& q = _quadrics[_wedge_position[wedge]];
+                    q.add_plane(normal / (2. * area), _points[_wedge_position[triangle[0]]], area);
+                    q.weight += area;
+                }
+            }
+            // planes perpendicular to the triangles along the borders and seams, so that collapses along them keep their shape
+            std::vector<TriangleEdge> edges = _edges();
+            for (std::size_t begin=0, end=0; begin<edges.size(); begin=end)
+            {
+                for (end=begin+1; end<edges.size() && edges[end].a == edges[begin].a && edges[end].b == edges[begin].b; end++);
+                if (!_boundary(edges, begin, end))
+                {
+                    continue;
+                }
+                for (std::size_t i=begin; i<end; i++)
+                {
+                    const Vector& pa = _points[edges[i].a];
+                    const Vector& pb = _points[edges[i].b];
+                    Vector normal = _normal(_triangles[_edge_triangles[i]], std::numeric_limits<uint32_t>::max(), 0);
+                    Vector side = Vector::cross(pb - pa, normal);
+                    double length = side.norm();
+                    if (length <= 0.)
+                    {
+                        continue;
+                    }
+                    Quadric q;
+                    q.add_plane(side / length, pa, BOUNDARY_WEIGHT * (pb - pa).squared_norm());
+                    _quadrics[edges[i].a].add(q);
+                    _quadrics[edges[i].b].add(q);
+                }
+            }
+        }
+
+        std::size_t triangles_count() const
+        {
+            return _triangles.size();
+        }
+
+        // Collapses edges until there are at most 'target' triangles. Returns false if no more edge can be collapsed before.
+        bool simplify(std::size_t target)
+        {
+            while (_triangles.size() > target)
+            {
+                if (!_pass(_triangles.size() - target))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        SimplifiedMesh result() const
+        {
+            SimplifiedMesh mesh;
+            mesh.indices.reserve(_triangles.size() * 3);
+            for (const std::array<uint32_t, 3>& triangle : _triangles)
+            {
+                for (uint32_t wedge : triangle)
+                {
+                    mesh.indices.push_back(_wedge_vertex[wedge]);
+                }
+            }
+            mesh.error = static_cast<float>(std::sqrt(_max_error));
+            return mesh;
+        }
+
+    protected:
+        // One pass of collapses of the cheapest edges, each one far enough from the others to be independent. Returns false if nothing could be collapsed.
+        bool _pass(std::size_t triangles_to_remove)
+        {
+            const std::size_t n_positions = _points.size();
+            std::vector<TriangleEdge> edges = _edges();
+            // classify the positions, from their border and seam edges
+            std::vector<uint32_t> boundary_edges(n_positions, 0);
+            std::vector<bool> complex(n_positions, false);
+            std::vector<std::size_t> neighbours_offsets(n_positions + 1, 0);
+            for (std::size_t begin=0, end=0; begin<edges.size(); begin=end)
+            {
+                for (end=begin+1; end<edges.size() && edges[end].a == edges[begin].a && edges[end].b == edges[begin].b; end++);
+                if (end - begin > 2)
+                {
+                    complex[edges[begin].a] = complex[edges[begin].b] = true;
+                }
+                else if (_boundary(edges, begin, end))
+                {
+                    boundary_edges[edges[begin].a]++;
+                    boundary_edges[edges[begin].b]++;
+                }
+                neighbours_offsets[edges[begin].a + 1]++;
+                neighbours_offsets[edges[begin].b + 1]++;
+            }
+            // neighbours of each position, and the triangles around them
+            for (std::size_t i=0; i<n_positions; i++)
+            {
+                neighbours_offsets[i+1] += neighbours_offsets[i];
+            }
+            std::vector<uint32_t> neighbours(neighbours_offsets[n_positions]);
+            std::vector<std::size_t> cursor(neighbours_offsets.begin(), neighbours_offsets.end() - 1);
+            for (std::size_t begin=0, end=0; begin<edges.size(); begin=end)
+            {
+                for (end=begin+1; end<edges.size() && edges[end].a == edges[begin].a && edges[end].b == edges[begin].b; end++);
+                neighbours[cursor[edges[begin].a]++] = edges[begin].b;
+                neighbours[cursor[edges[begin].b]++] = edges[begin].a;
+            }
+            std::vector<std::size_t> triangles_offsets(n_positions + 1, 0);
+            for (const std::array<uint32_t, 3>& triangle : _triangles)
+            {
+                for (uint32_t wedge : triangle)
+                {
+                    triangles_offsets[_wedge_position[wedge] + 1]++;
+                }
+            }
+            for (std::size_t i=0; i<n_positions; i++)
+            {
+                triangles_offsets[i+1] += triangles_offsets[i];
+            }
+            std::vector<uint32_t> position_triangles(triangles_offsets[n_positions]);
+            cursor.assign(triangles_offsets.begin(), triangles_offsets.end() - 1);
+            for (std::size_t t=0; t<_triangles.size(); t++)
+            {
+                for (uint32_t wedge : _triangles[t])
+                {
+                    position_triangles[cursor[_wedge_position[wedge]]++] = static_cast<uint32_t>(t);
+                }
+            }
+            // number of wedges of each position used by the triangles
+            std::vector<uint32_t> wedges_count(n_positions, 0);
+            std::vector<std::pair<uint32_t, uint32_t>> position_wedges;
+            for (const std::array<uint32_t, 3>& triangle : _triangles)
+            {
+                for (uint32_t wedge : triangle)
+                {
+                    position_wedges.emplace_back(_wedge_position[wedge], wedge);
+                }
+            }
+            std::sort(position_wedges.begin(), position_wedges.end());
+            position_wedges.erase(std::unique(position_wedges.begin(), position_wedges.end()), position_wedges.end());
+            for (const std::pair<uint32_t, uint32_t>& position_wedge : position_wedges)
+            {
+                wedges_count[position_wedge.first]++;
+            }
+            std::vector<Kind> kinds(n_positions, INTERIOR);
+            for (std::size_t p=0; p<n_positions; p++)
+            {
+                if (complex[p] || (boundary_edges[p] != 0 && boundary_edges[p] != 2) || (boundary_edges[p] == 0 && wedges_count[p] > 1))
+                {
+                    kinds[p] = LOCKED;
+                }
+                else if (boundary_edges[p] == 2)
+                {
+                    kinds[p] = BOUNDARY;
+                }
+            }
+            // cheapest valid direction of each edge
+            std::vector<Collapse> collapses;
+            for (std::size_t begin=0, end=0; begin<edges.size(); begin=end)
+            {
+                for (end=begin+1; end<edges.size() && edges[end].a == edges[begin].a && edges[end].b == edges[begin].b; end++);
+                if (end - begin > 2)
+                {
+                    continue;
+                }
+                bool boundary = _boundary(edges, begin, end);
+                Collapse collapse = {0, 0, begin, end - begin, std::numeric_limits<double>::max()};
+                for (int direction=0; direction<2; direction++)
+                {
+                    uint32_t from = (direction == 0) ? edges[begin].a : edges[begin].b;
+                    uint32_t to = (direction == 0) ? edges[begin].b : edges[begin].a;
+                    if (kinds[from] == LOCKED || (kinds[from] == BOUNDARY && !boundary) || !_wedges_mapped(edges, begin, end, from, wedges_count[from]))
+                    {
+                        continue;
+                    }
+                    Quadric q = _quadrics[from];
+                    q.add(_quadrics[to]);
+                    double cost = q.error(_points[to]);
+                    if (cost < collapse.cost)
+                    {
+                        collapse.from = from;
+                        collapse.to = to;
+                        collapse.cost = cost;
+                    }
+                }
+                if (collapse.cost < std::numeric_limits<double>::max())
+                {
+                    collapses.push_back(collapse);
+                }
+            }
+            std::sort(collapses.begin(), collapses.end(), [](const Collapse& c1, const Collapse& c2) {return c1.cost < c2.cost;});
+            // apply the cheapest collapses, locking the positions around each collapse for the rest of the pass
+            std::vector<bool> locked(n_positions, false);
+            std::vector<uint32_t> marks(n_positions, std::numeric_limits<uint32_t>::max());
+            std::size_t removed = 0;
+            for (const Collapse& collapse : collapses)
+            {
+                if (removed >= triangles_to_remove)
+                {
+                    break;
+                }
+                uint32_t from = collapse.from;
+                uint32_t to = collapse.to;
+                if (locked[from] || locked[to])
+                {
+                    continue;
+                }
+                // link condition: the positions neighbour of both ends must be the opposite corners of the triangles of the edge, or the surface would fold
+                for (std::size_t i=neighbours_offsets[from]; i<neighbours_offsets[from+1]; i++)
+                {
+                    marks[neighbours[i]] = from;
+                }
+                std::size_t common = 0;
+                for (std::size_t i=neighbours_offsets[to]; i<neighbours_offsets[to+1]; i++)
+                {
+                    common += (marks[neighbours[i]] == from) ? 1 : 0;
+                }
+                if (common != collapse.edge_count)
+                {
+                    continue;
+                }
+                // the triangles moved by the collapse must not flip
+                bool flipped = false;
+                for (std::size_t i=triangles_offsets[from]; i<triangles_offsets[from+1] && !flipped; i++)
+                {
+                    const std::array<uint32_t, 3>& triangle = _triangles[position_triangles[i]];
+                    if (_wedge_position[triangle[0]] == to || _wedge_position[triangle[1]] == to || _wedge_position[triangle[2]] == to)
+                    {
+                        continue;
+                    }
+                    Vector before = _normal(triangle, std::numeric_limits<uint32_t>::max(), 0);
+                    Vector after = _normal(triangle, from, to);
+                    double norms = std::sqrt(before.squared_norm() * after.squared_norm());
+                    flipped = (norms <= 0.) || (Vector::dot(before, after) < MIN_NORMAL_COSINE * norms);
+                }
+                if (flipped)
+                {
+                    continue;
+                }
+                for (std::size_t i=collapse.edge; i<collapse.edge+collapse.edge_count; i++)
+                {
+                    const TriangleEdge& edge = edges[i];
+                    uint32_t wedge_from = (edge.a == from) ? edge.wedge_a : edge.wedge_b;
+                    uint32_t wedge_to = (edge.a == from) ? edge.wedge_b : edge.wedge_a;
+                    _wedge_remap[wedge_from] = wedge_to;
+                }
+                _quadrics[to].add(_quadrics[from]);
+                _max_error = std::max(_max_error, collapse.cost);
+                locked[from] = true;
+                locked[to] = true;
+                for (std::size_t i=neighbours_offsets[from]; i<neighbours_offsets[from+1]; i++)
+                {
+                    locked[neighbours[i]] = true;
+                }
+                removed += collapse.edge_count;
+            }
+            if (removed == 0)
+            {
+                return false;
+            }
+            // remap the triangles, removing the ones collapsed to a segment
+            std::size_t kept = 0;
+            for (std::size_t t=0; t<_triangles.size(); t++)
+            {
+                std::array<uint32_t, 3> triangle = _triangles[t];
+                for (uint32_t& wedge : triangle)
+                {
+                    wedge = _resolve(wedge);
+                }
+                if (!_degenerate(triangle))
+                {
+                    _triangles[kept++] = triangle;
+                }
+            }
+            _triangles.resize(kept);
+            return true;
+        }
+
+        // Returns the edges of all the triangles, sorted by positions. '_edge_triangles' is set to the triangle of each edge.
+        std::vector<TriangleEdge> _edges()
+        {
+            std::vector<std::pair<TriangleEdge, uint32_t>> edges;
+            edges.reserve(_triangles.size() * 3);
+            for (std::size_t t=0; t<_triangles.size(); t++)
+            {
+                for (std::size_t k=0; k<3; k++)
+                {
+                    uint32_t w0 = _triangles[t][k];
+                    uint32_t w1 = _triangles[t][(k+1)%3];
+                    uint32_t p0 = _wedge_position[w0];
+                    uint32_t p1 = _wedge_position[w1];
+                    TriangleEdge edge = (p0 < p1) ? TriangleEdge{p0, p1, w0, w1} : TriangleEdge{p1, p0, w1, w0};
+                    edges.emplace_back(edge, static_cast<uint32_t>(t));
+                }
+            }
+            std::sort(edges.begin(), edges.end(), [](const std::pair<TriangleEdge, uint32_t>& e1, const std::pair<TriangleEdge, uint32_t>& e2) {return e1.first < e2.first;});
+            std::vector<TriangleEdge> sorted(edges.size());
+            _edge_triangles.resize(edges.size());
+            for (std::size_t i=0; i<edges.size(); i++)
+            {
+                sorted[i] = edges[i].first;
+                _edge_triangles[i] = edges[i].second;
+            }
+            return sorted;
+        }
+
+        // Returns true if the edge made of the triangle edges [begin, end) is a border (one triangle) or a seam (different wedges on each side)
+        static bool _boundary(const std::vector<TriangleEdge>& edges, std::size_t begin, std::size_t end)
+        {
+            return (end - begin == 1) || (end - begin == 2 && (edges[begin].wedge_a != edges[begin+1].wedge_a || edges[begin].wedge_b != edges[begin+1].wedge_b));
+        }
+
+        // Returns true if each of the 'wedges_count' wedges of the position 'from' is in a triangle of the edge, so that it can be moved onto the wedge of the other end in this triangle
+        static bool _wedges_mapped(const std::vector<TriangleEdge>& edges, std::size_t begin, std::size_t end, uint32_t from, uint32_t wedges_count)
+        {
+            uint32_t mapped = 0;
+            for (std::size_t i=begin; i<end; i++)
+            {
+                uint32_t wedge_from = (edges[i].a == from) ? edges[i].wedge_a : edges[i].wedge_b;
+                uint32_t wedge_to = (edges[i].a == from) ? edges[i].wedge_b : edges[i].wedge_a;
+                bool already_mapped = false;
+                for (std::size_t j=begin; j<i; j++)
+                {
+                    uint32_t previous_from = (edges[j].a == from) ? edges[j].wedge_a : edges[j].wedge_b;
+                    uint32_t previous_to = (edges[j].a == from) ? edges[j].wedge_b : edges[j].wedge_a;
+                    if (previous_from == wedge_from)
+                    {
+                        if (previous_to != wedge_to)
+                        {
+                            return false;
+                        }
+                        already_mapped = true;
+                    }
+                }
+                mapped += already_mapped ? 0 : 1;
+            }
+            return mapped == wedges_count;
+        }
+
+        // Non normalized normal of a triangle, with the position 'moved' replaced by the position 'destination'
+        Vector _normal(const std::array<uint32_t, 3>& triangle, uint32_t moved, uint32_t destination) const
+        {
+            std::array<Vector, 3> corners;
+            for (std::size_t k=0; k<3; k++)
+            {
+                uint32_t position = _wedge_position[triangle[k]];
+                corners[k] = _points[(position == moved) ? destination : position];
+            }
+            return Vector::cross(corners[1] - corners[0], corners[2] - corners[0]);
+        }
+
+        bool _degenerate(const std::array<uint32_t, 3>& triangle) const
+        {
+            uint32_t p0 = _wedge_position[triangle[0]];
+            uint32_t p1 = _wedge_position[triangle[1]];
+            uint32_t p2 = _wedge_position[triangle[2]];
+            return (p0 == p1) || (p1 == p2) || (p2 == p0);
+        }
+
+        // Returns the wedge a wedge was moved onto by the collapses
+        uint32_t _resolve(uint32_t wedge)
+        {
+            uint32_t root = wedge;
+            while (_wedge_remap[root] != root)
+            {
+                root = _wedge_remap[root];
+            }
+            while (_wedge_remap[wedge] != root)
+            {
+                uint32_t next = _wedge_remap[wedge];
+                _wedge_remap[wedge] = root;
+                wedge = next;
+            }
+            return root;
+        }
+
+    protected:
+        std::vector<Vector> _points; // coordinates of each position
+        std::vector<Quadric> _quadrics; // quadric of each position
+        std::vector<uint32_t> _wedge_position; // position of each wedge
+        std::vector<uint32_t> _wedge_vertex; // first vertex of each wedge, referenced by the simplified indices
+        std::vector<uint32_t> _wedge_remap; // wedge each wedge was moved onto, or itself
+        std::vector<std::array<uint32_t, 3>> _triangles; // wedges of each remaining triangle
+        std::vector<uint32_t> _edge_triangles; // triangle of each edge returned by the last call to '_edges'
+        double _max_error = 0.; // largest squared error of the collapses so far
+    };
+}
+
+std::vector<SimplifiedMesh> Simplifier::levels_of_detail(const Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count, std::size_t max_levels)
+{
+    std::vector<SimplifiedMesh> levels;
+    Simplification simplification(vertices, vertices_count, indices, indices_count);
+    std::size_t target = ((indices != nullptr) ? indices_count : vertices_count) / 3;
+    for (std::size_t level=0; level<std::min(max_levels, MAX_LEVELS); level++)
+    {
+        target /= 2;
+        if (target < MIN_TRIANGLES || !simplification.simplify(target))
+        {
+            break;
+        }
+        levels.push_back(simplification.result());
+    }
+    return levels;
+}
+
+std::size_t Simplifier::levels_of_detail_indices_count(std::size_t triangles_count)
+{
+    std::size_t indices_count = 0;
+    for (std::size_t level=0; level<MAX_LEVELS; level++)
+    {
+        triangles_count /= 2;
+        indices_count += 3 * triangles_count;
+    }
+    return indices_count;
+}
@@ -0,0 +1,302 @@
+#include <RenderEngine/graphics/model/SmoothNormals.hpp>
+#include <RenderEngine/geometry/Vector.hpp>
+#include <RenderEngine/utilities/Parallel.hpp>
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <limits>
+#include <thread>
+#include <cmath>
+using namespace RenderEngine;
+
+namespace
+{
+    // Items are split between threads in ranges of at least this many items
+    constexpr std::size_t MIN_RANGE_SIZE = 1 << 14;
+
+    std::size_t cell_hash(const std::array<uint32_t, 3>& cell)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (uint32_t word : cell)
+        {
+            hash = (hash ^ word) * 1099511628211ULL;
+        }
+        return static_cast<std::size_t>(hash ^ (hash >> 32));
+    }
+
+    // Returns for each position the index of the first position inserted in its cell of the grid. Positions are inserted from parallel threads
+    // in an open addressing hash table of the cells, so the representative of a cell may change between calls, but the cells do not.
+    std::vector<uint32_t> weld(const vec3* positions, std::size_t positions_count, double weld_tolerance)
+    {
+        std::vector<std::array<float, 6>> bounds;
+        std::atomic<std::size_t> next_bounds(0);
+        bounds.resize(std::max(1u, std::thread::hardware_concurrency()), {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                                                                            std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()});
+        Parallel::for_ranges(positions_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            std::array<float, 6>& range_bounds = bounds[next_bounds++];
+            for (std::size_t i=begin; i<end; i++)
+            {
+                const float p[3] = {positions[i].x, positions[i].y, positions[i].z};
+                for (std::size_t k=0; k<3; k++)
+                {
+                    range_bounds[k] = std::min(range_bounds[k], p[k]);
+                    range_bounds[k+3] = std::max(range_bounds[k+3], p[k]);
+                }
+            }
+        });
+        Vector lower(std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max());
+        Vector upper(std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest());
+        for (const std::array<float, 6>& range_bounds : bounds)
+        {
+            lower = Vector(std::min<double>(lower.x, range_bounds[0]), std::min<double>(lower.y, range_bounds[1]), std::min<double>(lower.z, range_bounds[2]));
+            upper = Vector(std::max<double>(upper.x, range_bounds[3]), std::max<double>(upper.y, range_bounds[4]), std::max<double>(upper.z, range_bounds[5]));
+        }
+        double cell_size = (upper - lower).norm() * weld_tolerance;
+        double inverse = (cell_size > 0. && std::isfinite(cell_size)) ? 1. / cell_size : 1.;
+        // cells are numbered from the lower corner of the bounding box, non finite coordinates fall in the first cell
+        std::vector<std::array<uint32_t, 3>> cells(positions_count);
+        Parallel::for_ranges(positions_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i=begin; i<end; i++)
+            {
+                const double offsets[3] = {(positions[i].x - lower.x) * inverse, (positions[i].y - lower.y) * inverse, (positions[i].z - lower.z) * inverse};
+                for (std::size_t k=0; k<3; k++)
+                {
+                    cells[i][k] = (offsets[k] >= 0.) ? static_cast<uint32_t>(std::min(std::floor(offsets[k]), 4294967295.)) : 0;
+                }
+            }
+        });
+        std::size_t capacity = 16;
+        while (capacity < positions_count * 2)
+        {
+            capacity *= 2;
+        }
+        std::vector<std::atomic<uint32_t>> table(capacity); // index + 1 of the representative of the cell, or 0 if the slot is free
+        std::vector<uint32_t> representatives(positions_count);
+        Parallel::for_ranges(positions_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i=begin; i<end; i++)
+            {
+                for (std::size_t slot=cell_hash(cells[i]) & (capacity - 1);; slot=(slot + 1) & (capacity - 1))
+                {
+                    uint32_t occupant = table[slot].load(std::memory_order_relaxed);
+                    if (occupant == 0 && table[slot].compare_exchange_strong(occupant, static_cast<uint32_t>(i + 1)))
+                    {
+                        representatives[i] = static_cast<uint32_t>(i);
+                        break;
+                    }
+                    if (cells[occupant - 1] == cells[i])
+                    {
+                        representatives[i] = occupant - 1;
+                        break;
+                    }
+                }
+            }
+        });
+        return representatives;
+    }
+}
+
+
+std::vector<uint32_t> SmoothNormals::generate(const vec3* positions, std::size_t positions_count, const uint32_t* corners, std::size_t corners_count,
+                                              std::vector<vec3>& normals, double smoothing_angle, Weighting weighting, double weld_tolerance)
+{
+    if (corners_count % 3 != 0 || (corners == nullptr && corners_count != positions_count) || positions_count > std::numeric_limits<uint32_t>::max())
+    {
+        THROW_ERROR("The corners do not describe triangles");
+    }
+    auto position_of = [&](std::size_t c) -> uint32_t {return (corners != nullptr) ? corners[c] : static_cast<uint32_t>(c);};
+    std::vector<uint32_t> representatives = weld(positions, positions_count, weld_tolerance);
+    // unit normal of each triangle (null if it is degenerate), and weight of each corner
+    std::vector<Vector> face_normals(corners_count / 3);
+    std::vector<double> weights(corners_count);
+    std::atomic<bool> invalid(false);
+    Parallel::for_ranges(face_normals.size(), MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t t=begin; t<end; t++)
+        {
+            Vector points[3];
+            for (std::size_t k=0; k<3; k++)
+            {
+                uint32_t p = position_of(t*3+k);
+                if (p >= positions_count)
+                {
+                    invalid = true;
+                    continue;
+                }
+                points[k] = Vector(positions[p].x, positions[p].y, positions[p].z);
+            }
+            Vector cross = Vector::cross(points[1] - points[0], points[2] - points[0]);
+            double length = cross.norm();
+            bool degenerate = !(length > 0.) || !std::isfinite(length);
+            face_normals[t] = degenerate ? Vector() : cross / length;
+            for (std::size_t k=0; k<3; k++)
+            {
+                // the angle at a corner is atan2(|u x v|, u.v), and |u x v| is twice the area at every corner
+                weights[t*3+k] = degenerate ? 0. : ((weighting == AREA) ? length / 2.
+                                                                         : std::atan2(length, Vector::dot(points[(k+1)%3] - points[k], points[(k+2)%3] - points[k])));
+            }
+        }
+    });
+    if (invalid)
+    {
+        THROW_ERROR("A corner references a missing position");
+    }
+    // the corners are grouped by welded position, in increasing order so that the sums do not depend on the threads
+    std::vector<uint32_t> group_offsets(positions_count + 1, 0);
+    for (std::size_t c=0; c<corners_count; c++)
+    {
+        group_offsets[representatives[position_of(c)] + 1]++;
+    }
+    for (std::size_t i=0; i<positions_count; i++)
+    {
+        group_offsets[i + 1] += group_offsets[i];
+    }
+    std::vector<uint32_t> groups(corners_count);
+    std::vector<uint32_t> filled(group_offsets.begin(), group_offsets.end() - 1);
+    for (std::size_t c=0; c<corners_count; c++)
+    {
+        groups[filled[representatives[position_of(c)]]++] = static_cast<uint32_t>(c);
+    }
+    // each corner sums the weighted normals of the triangles of its group within the smoothing angle. Corners with the same sum get the same normal,
+    // given consecutive indices in each group
+    bool smooth = smoothing_angle >= PI;
+    double min_cosine = std::cos(smoothing_angle);
+    std::vector<vec3> corner_normals(corners_count);
+    std::vector<uint32_t> normal_indices(corners_count);
+    std::vector<uint32_t> first_normals(positions_count + 1, 0);
+    Parallel::for_ranges(positions_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        std::vector<vec3> distinct;
+        for (std::size_t i=begin; i<end; i++)
+        {
+            Vector total;
+            for (uint32_t g=group_offsets[i]; g<group_offsets[i+1]; g++)
+            {
+                total += weights[groups[g]] * face_normals[groups[g] / 3];
+            }
+            distinct.clear();
+            for (uint32_t g=group_offsets[i]; g<group_offsets[i+1]; g++)
+            {
+                uint32_t c = groups[g];
+                const Vector& normal = face_normals[c / 3];
+                Vector sum;
+                if (smooth || normal.squared_norm() == 0.)
+                {
+                    sum = total;
+                }
+                else
+                {
+                    for (uint32_t h=group_offsets[i]; h<group_offsets[i+1]; h++)
+                    {
+                        const Vector& other = face_normals[groups[h] / 3];
+                        if (Vector::dot(normal, other) >= min_cosine)
+                        {
+                            sum += weights[groups[h]] * other;
+                        }
+                    }
+                }
+                vec3 result = (sum.squared_norm() > 0.) ? sum.normed().to_vec3() : vec3({0.f, 0.f, 1.f});
+                std::size_t k = std::find_if(distinct.begin(), distinct.end(), [&](const vec3& n) {return n.x == result.x && n.y == result.y && n.z == result.z;}) - distinct.begin();
+                if (k == distinct.size())
+                {
+                    distinct.push_back(result);
+                }
+                corner_normals[c] = result;
+                normal_indices[c] = static_cast<uint32_t>(k);
+            }
+            first_normals[i + 1] = static_cast<uint32_t>(distinct.size());
+        }
+    });
+    for (std::size_t i=0; i<positions_count; i++)
+    {
+        first_normals[i + 1] += first_normals[i];
+    }
+    normals.resize(first_normals.back());
+    Parallel::for_ranges(positions_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            for (uint32_t g=group_offsets[i]; g<group_offsets[i+1]; g++)
+            {
+                uint32_t c = groups[g];
+                normal_indices[c] += first_normals[i];
+                normals[normal_indices[c]] = corner_normals[c];
+            }
+        }
+    });
+    return normal_indices;
+}
+
+void SmoothNormals::generate(std::vector<Face>& faces, double smoothing_angle, Weighting weighting, double weld_tolerance)
+{
+    std::vector<vec3> positions(faces.size() * 3);
+    Parallel::for_ranges(faces.size(), MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t f=begin; f<end; f++)
+        {
+            for (std::size_t k=0; k<3; k++)
+            {
+                positions[f*3+k] = faces[f].points[k].to_vec3();
+            }
+        }
+    });
+    std::vector<vec3> normals;
+    std::vector<uint32_t> indices = generate(positions.data(), positions.size(), nullptr, positions.size(), normals, smoothing_angle, weighting, weld_tolerance);
+    Parallel::for_ranges(faces.size(), MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t f=begin; f<end; f++)
+        {
+            for (std::size_t k=0; k<3; k++)
+            {
+                const vec3& normal = normals[indices[f*3+k]];
+                faces[f].normals[k] = Vector(normal.x, normal.y, normal.z);
+            }
+        }
+    });
+}
+
+void SmoothNormals::generate(Vertex* vertices, std::size_t vertices_count, const uint32_t* indices, std::size_t indices_count,
+                             double smoothing_angle, Weighting weighting, double weld_tolerance)
+{
+    std::vector<vec3> positions(vertices_count);
+    Parallel::for_ranges(vertices_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            positions[i] = vertices[i].position;
+        }
+    });
+    std::size_t corners_count = (indices != nullptr) ? indices_count : vertices_count;
+    std::vector<vec3> normals;
+    std::vector<uint32_t> corner_normals = generate(positions.data(), vertices_count, indices, corners_count, normals, smoothing_angle, weighting, weld_tolerance);
+    if (indices == nullptr)
+    {
+        Parallel::for_ranges(vertices_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i=begin; i<end; i++)
+            {
+                vertices[i].normal = normals[corner_normals[i]];
+            }
+        });
+        return;
+    }
+    // an indexed vertex averages the normals of its corners, which are all equal unless it lies on a hard edge
+    std::vector<Vector> sums(vertices_count);
+    for (std::size_t c=0; c<corners_count; c++)
+    {
+        const vec3& normal = normals[corner_normals[c]];
+        sums[indices[c]] += Vector(normal.x, normal.y, normal.z);
+    }
+    Parallel::for_ranges(vertices_count, MIN_RANGE_SIZE, [&](std::size_t begin, std::size_t end)
+    {
+        for (std::size_t i=begin; i<end; i++)
+        {
+            if (sums[i].squared_norm() > 0.)
+            {
+                vertices[i].normal = sums[i].normed().to_vec3();
+            }
+        }
+    });
+}
@@ -0,0 +1,269 @@
+#include <RenderEngine/graphics/model/TriangleHierarchy.hpp>
+#include <algorithm>
+#include <cmath>
+using namespace RenderEngine;
+
+namespace
+{
+    const std::uint32_t max_leaf_size = 4; // leafs are not split below this number of triangles
+    const std::uint32_t bins_count = 16; // number of bins of the surface area heuristic
+
+    struct Box
+    {
+        Vectorf lower = Vectorf(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+        Vectorf upper = Vectorf(-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity());
+
+        void grow(const Vectorf& point)
+        {
+            lower = Vectorf(std::min(lower.x, point.x), std::min(lower.y, point.y), std::min(lower.z, point.z));
+            upper = Vectorf(std::max(upper.x, point.x), std::max(upper.y, point.y), std::max(upper.z, point.z));
+        }
+
+        void grow(const Box& box)
+        {
+            grow(box.lower);
+            grow(box.upper);
+        }
+
+        float area() const
+        {
+            if (lower.x > upper.x)
+            {
+                return 0.f;
+            }
+            Vectorf d = upper - lower;
+            return 2.f * (d.x*d.y + d.y*d.z + d.z*d.x);
+        }
+    };
+
+    float axis_coordinate(const Vectorf& vector, unsigned int axis)
+    {
+        return (axis == 0) ? vector.x : ((axis == 1) ? vector.y : vector.z);
+    }
+
+    // slab test of a ray against the box of a node, returns the entry distance, or infinity if the box is missed
+    float entry_distance(const TriangleHierarchy::Node& node, const Vectorf& origin, const Vectorf& inverse_direction, float max_distance)
+    {
+        float t1 = (node.lower[0] - origin.x) * inverse_direction.x;
+        float t2 = (node.upper[0] - origin.x) * inverse_direction.x;
+        float t_min = std::min(t1, t2);
+        float t_max = std::max(t1, t2);
+        t1 = (node.lower[1] - origin.y) * inverse_direction.y;
+        t2 = (node.upper[1] - origin.y) * inverse_direction.y;
+        t_min = std::max(t_min, std::min(t1, t2));
+        t_max = std::min(t_max, std::max(t1, t2));
+        t1 = (node.lower[2] - origin.z) * inverse_direction.z;
+        t2 = (node.upper[2] - origin.z) * inverse_direction.z;
+        t_min = std::max(t_min, std::min(t1, t2));
+        t_max = std::min(t_max, std::max(t1, t2));
+        t_min = std::max(t_min, 0.f);
+        t_max = std::min(t_max, max_distance);
+        return (t_min <= t_max) ? t_min : std::numeric_limits<float>::infinity();
+    }
+}
+
+TriangleHierarchy::TriangleHierarchy(const float* x, const float* y, const float* z, std::size_t triangles_count)
+{
+    _triangles.resize(triangles_count);
+    _indexes.resize(triangles_count);
+    std::vector<Vectorf> centers(triangles_count);
+    for (std::size_t i=0; i<triangles_count; i++)
+    {
+        Vectorf p0(x[3*i], y[3*i], z[3*i]);
+        Vectorf p1(x[3*i+1], y[3*i+1], z[3*i+1]);
+        Vectorf p2(x[3*i+2], y[3*i+2], z[3*i+2]);
+        _triangles[i] = {p0, p1 - p0, p2 - p0};
+        _indexes[i] = static_cast<std::uint32_t>(i);
+        centers[i] = (p0 + p1 + p2) / 3.f;
+    }
+    _nodes.reserve(2 * triangles_count + 1);
+    _nodes.push_back(Node());
+    _build_subtree(0, 0, static_cast<std::uint32_t>(triangles_count), centers);
+}
+
+TriangleHierarchy::~TriangleHierarchy()
+{
+}
+
+bool TriangleHierarchy::intersect(const Vectorf& origin, const Vectorf& direction, float max_distance, TriangleHit& hit) const
+{
+    if (_triangles.size() == 0)
+    {
+        return false;
+    }
+    Vectorf inverse_direction = 1.f / direction;
+    float best = max_distance;
+    bool found = false;
+    if (entry_distance(_nodes[0], origin, inverse_direction, best) == std::numeric_limits<float>::infinity())
+    {
+        return false;
+    }
+    std::vector<std::uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+    while (stack.size() > 0)
+    {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+        if (node.count > 0)
+        {
+            for (std::uint32_t i=node.first; i<node.first+node.count; i++)
+            {
+                // Möller–Trumbore ray/triangle intersection
+                const Triangle& triangle = _triangles[i];
+                Vectorf p = Vectorf::cross(direction, triangle.edge2);
+                float determinant = Vectorf::dot(triangle.edge1, p);
+                if (std::abs(determinant) < std::numeric_limits<float>::min())
+                {
+                    continue;
+                }
+                float inverse_determinant = 1.f / determinant;
+                Vectorf s = origin - triangle.vertex;
+                float u = Vectorf::dot(s, p) * inverse_determinant;
+                if (u < 0.f || u > 1.f)
+                {
+                    continue;
+                }
+                Vectorf q = Vectorf::cross(s, triangle.edge1);
+                float v = Vectorf::dot(direction, q) * inverse_determinant;
+                if (v < 0.f || u + v > 1.f)
+                {
+                    continue;
+                }
+                float t = Vectorf::dot(triangle.edge2, q) * inverse_determinant;
+                if (t >= 0.f && t < best)
+                {
+                    best = t;
+                    found = true;
+                    hit.triangle = _indexes[i];
+                    hit.distance = t;
+                    hit.u = u;
+                    hit.v = v;
+                }
+            }
+            continue;
+        }
+        // visit the nearest child first, skipping the childrens further than the closest hit
+        float t_first = entry_distance(_nodes[node.first], origin, inverse_direction, best);
+        float t_second = entry_distance(_nodes[node.first+1], origin, inverse_direction, best);
+        std::uint32_t first = node.first;
+        std::uint32_t second = node.first+1;
+        if (t_second < t_first)
+        {
+            std::swap(first, second);
+            std::swap(t_first, t_second);
+        }
+        if (t_second != std::numeric_limits<float>::infinity())
+        {
+            stack.push_back(second);
+        }
+        if (t_first != std::numeric_limits<float>::infinity())
+        {
+            stack.push_back(first);
+        }
+    }
+    return found;
+}
+
+std::size_t TriangleHierarchy::size() const
+{
+    return _triangles.size();
+}
+
+void TriangleHierarchy::_build_subtree(std::size_t root, std::uint32_t begin, std::uint32_t end, std::vector<Vectorf>& centers)
+{
+    Box bounds;
+    Box centers_bounds;
+    for (std::uint32_t i=begin; i<end; i++)
+    {
+        const Triangle& triangle = _triangles[i];
+        bounds.grow(triangle.vertex);
+        bounds.grow(triangle.vertex + triangle.edge1);
+        bounds.grow(triangle.vertex + triangle.edge2);
+        centers_bounds.grow(centers[i]);
+    }
+    Node& node = _nodes[root];
+    node.lower[0] = bounds.lower.x;
+    node.lower[1] = bounds.lower.y;
+    node.lower[2] = bounds.lower.z;
+    node.upper[0] = bounds.upper.x;
+    node.upper[1] = bounds.upper.y;
+    node.upper[2] = bounds.upper.z;
+    node.first = begin;
+    node.count = end - begin;
+    std::uint32_t count = end - begin;
+    if (count <= max_leaf_size)
+    {
+        return;
+    }
+    // split along the axis on which the centers are the most spread
+    Vectorf extent = centers_bounds.upper - centers_bounds.lower;
+    unsigned int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : ((extent.y >= extent.z) ? 1 : 2);
+    float lower = axis_coordinate(centers_bounds.lower, axis);
+    float width = axis_coordinate(extent, axis);
+    std::uint32_t split = begin + count / 2;
+    if (width > 0.f)
+    {
+        // binned surface area heuristic
+        auto bin_of = [&](const Vectorf& center) -> std::uint32_t
+        {
+            float position = (axis_coordinate(center, axis) - lower) / width;
+            return std::min(bins_count - 1, static_cast<std::uint32_t>(position * bins_count));
+        };
+        Box bin_boxes[bins_count];
+        std::uint32_t bin_counts[bins_count] = {};
+        for (std::uint32_t i=begin; i<end; i++)
+        {
+            std::uint32_t bin = bin_of(centers[i]);
+            const Triangle& triangle = _triangles[i];
+            bin_boxes[bin].grow(triangle.vertex);
+            bin_boxes[bin].grow(triangle.vertex + triangle.edge1);
+            bin_boxes[bin].grow(triangle.vertex + triangle.edge2);
+            bin_counts[bin]++;
+        }
+        float right_costs[bins_count] = {};
+        Box right_box;
+        std::uint32_t right_count = 0;
+        for (std::uint32_t b=bins_count-1; b>0; b--)
+        {
+            right_box.grow(bin_boxes[b]);
+            right_count += bin_counts[b];
+            right_costs[b-1] = right_box.area() * right_count;
+        }
+        float best_cost = std::numeric_limits<float>::infinity();
+        std::uint32_t best_bin = 0;
+        Box left_box;
+        std::uint32_t left_count = 0;
+        for (std::uint32_t b=0; b<bins_count-1; b++)
+        {
+            left_box.grow(bin_boxes[b]);
+            left_count += bin_counts[b];
+            float cost = left_box.area() * left_count + right_costs[b];
+            if (left_count > 0 && left_count < count && cost < best_cost)
+            {
+                best_cost = cost;
+                best_bin = b;
+            }
+        }
+        std::uint32_t j = begin;
+        for (std::uint32_t i=begin; i<end; i++)
+        {
+            if (bin_of(centers[i]) <= best_bin)
+            {
+                std::swap(_triangles[i], _triangles[j]);
+                std::swap(_indexes[i], _indexes[j]);
+                std::swap(centers[i], centers[j]);
+                j++;
+            }
+        }
+        split = j;
+    }
+    // create the two childrens ('node' is invalidated by the reallocation)
+    std::uint32_t first = static_cast<std::uint32_t>(_nodes.size());
+    _nodes[root].first = first;
+    _nodes[root].count = 0;
+    _nodes.push_back(Node());
+    _nodes.push_back(Node());
+    _build_subtree(first, begin, split, centers);
+    _build_subtree(first+1, split, end, centers);
+}
@@ -1,10 +1,89 @@
 #include <RenderEngine/graphics/shaders/Shader.hpp>
 #include <RenderEngine/graphics/GPU.hpp>
 #include <RenderEngine/utilities/Macro.hpp>
+#include <cstring>
+#include <optional>
+#include <set>
 using namespace RenderEngine;
 
+namespace
+{
+    constexpr uint32_t SPIRV_MAGIC_NUMBER = 0x07230203;
+    constexpr uint32_t SPIRV_OP_VARIABLE = 59;
+    constexpr uint32_t SPIRV_OP_DECORATE = 71;
+    constexpr uint32_t SPIRV_DECORATION_LOCATION = 30;
+    constexpr uint32_t SPIRV_DECORATION_BINDING = 33;
+    constexpr uint32_t SPIRV_DECORATION_DESCRIPTOR_SET = 34;
+    constexpr uint32_t SPIRV_STORAGE_CLASS_INPUT = 1;
+    // Specialization constant set to true in the pipelines reading CompactVertex, whose normals must be decoded from their octahedral encoding
+    constexpr uint32_t OCTAHEDRAL_NORMALS_CONSTANT_ID = 0;
+
+    // A global variable declared by a SPIR-V module
+    struct SpirvVariable
+    {
+        uint32_t storage_class = 0;
+        std::optional<uint32_t> location;
+        std::optional<uint32_t> descriptor_set;
+        std::optional<uint32_t> binding;
+    };
+
+    // Returns the global variables declared by a SPIR-V bytecode, by id
+    std::map<uint32_t, SpirvVariable> spirv_variables(const std::vector<uint8_t>& bytecode)
+    {
+        std::vector<uint32_t> words(bytecode.size() / sizeof(uint32_t));
+        std::memcpy(words.data(), bytecode.data(), words.size() * sizeof(uint32_t));
+        if (words.size() < 5 || words[0] != SPIRV_MAGIC_NUMBER)
+        {
+            THROW_ERROR("shader bytecode is not a SPIR-V module");
+        }
+        std::map<uint32_t, SpirvVariable> variables;
+        std::map<uint32_t, std::map<uint32_t, uint32_t>> decorations; // (id, decoration) -> value
+        for (std::size_t i=5; i<words.size();)
+        {
+            uint32_t opcode = words[i] & 0xFFFF;
+            uint32_t count = words[i] >> 16;
+            if (count == 0 || i + count > words.size())
+            {
+                THROW_ERROR("shader bytecode is a truncated SPIR-V module");
+            }
+            if (opcode == SPIRV_OP_DECORATE && count >= 4)
+            {
+                decorations[words[i+1]][words[i+2]] = words[i+3];
+            }
+            else if (opcode == SPIRV_OP_VARIABLE && count >= 4)
+            {
+                variables[words[i+2]].storage_class = words[i+3];
+            }
+            i += count;
+        }
+        for (std::pair<const uint32_t, SpirvVariable>& variable : variables)
+        {
+            std::map<uint32_t, std::map<uint32_t, uint32_t>>::const_iterator decoration = decorations.find(variable.first);
+            if (decoration == decorations.end())
+            {
+                continue;
+            }
+            const std::map<uint32_t, uint32_t>& values = decoration->second;
+            if (values.find(SPIRV_DECORATION_LOCATION) != values.end())
+            {
+                variable.second.location = values.at(SPIRV_DECORATION_LOCATION);
+            }
+            if (values.find(SPIRV_DECORATION_DESCRIPTOR_SET) != values.end())
+            {
+                variable.second.descriptor_set = values.at(SPIRV_DECORATION_DESCRIPTOR_SET);
+            }
+            if (values.find(SPIRV_DECORATION_BINDING) != values.end())
+            {
+                variable.second.binding = values.at(SPIRV_DECORATION_BINDING);
+            }
+        }
+        return variables;
+    }
+}
+
 Shader::Shader(const GPU* gpu,
                const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffers,
+               uint32_t vertex_stride,
                const std::vector<std::pair<std::string, VkFormat>>& output_attachments,
                const std::vector<std::map<std::string, VkDescriptorSetLayoutBinding>>& descriptor_sets, // for each layout set, descriptor of all bindings (textures, Uniform Buffer Objects, ...)
                const std::map<std::string, VkPushConstantRange>& push_constants, // definition of all push constants.
@@ -14,6 +93,8 @@ Shader::Shader(const GPU* gpu,
                const std::map<VkShaderStageFlagBits, std::vector<uint8_t>> shader_stages_bytecode // the bytecode of the compiled spirv file
                ) : _gpu(gpu)
 {
+    _check_vertex_inputs(vertex_buffers, shader_stages_bytecode);
+    _check_descriptor_sets(descriptor_sets, shader_stages_bytecode);
     _push_constants = push_constants;
     _output_attachments = output_attachments;
     _descriptor_sets = descriptor_sets;
@@ -31,13 +112,33 @@ Shader::Shader(const GPU* gpu,
     {
         _depth_test = depth_test;
         _vk_pipeline_bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS;
-        _vk_pipeline = _create_graphics_pipeline(*gpu, vertex_buffers, output_attachments, _modules, _vk_pipeline_layout, _vk_render_pass, depth_test, blending);
+        _vk_pipeline = _create_graphics_pipeline(*gpu, vertex_buffers, vertex_stride, output_attachments, _modules, _vk_pipeline_layout, _vk_render_pass, depth_test, blending, nullptr);
+        // the same shader modules can read compact vertices, the vertex input formats converting them to floats, and the shader decoding the normals
+        std::vector<std::pair<std::string, VkVertexInputAttributeDescription>> compact_vertex_buffers = _compact_vertex_buffers(vertex_buffers);
+        if (vertex_stride == sizeof(Vertex) && compact_vertex_buffers.size() > 0)
+        {
+            const VkBool32 octahedral_normals = VK_TRUE;
+            VkSpecializationMapEntry entry{};
+            entry.constantID = OCTAHEDRAL_NORMALS_CONSTANT_ID;
+            entry.offset = 0;
+            entry.size = sizeof(VkBool32);
+            VkSpecializationInfo specialization{};
+            specialization.mapEntryCount = 1;
+            specialization.pMapEntries = &entry;
+            specialization.dataSize = sizeof(VkBool32);
+            specialization.pData = &octahedral_normals;
+            _vk_compact_pipeline = _create_graphics_pipeline(*gpu, compact_vertex_buffers, sizeof(CompactVertex), output_attachments, _modules, _vk_pipeline_layout, _vk_render_pass, depth_test, blending, &specialization);
+        }
     }
 }
 
 Shader::~Shader()
 {
     vkDestroyPipeline(_gpu->_logical_device, _vk_pipeline, nullptr);
+    if (_vk_compact_pipeline != VK_NULL_HANDLE)
+    {
+        vkDestroyPipeline(_gpu->_logical_device, _vk_compact_pipeline, nullptr);
+    }
     vkDestroyPipelineLayout(_gpu->_logical_device, _vk_pipeline_layout, nullptr);
     for (const VkDescriptorSetLayout& desc : _descriptor_set_layouts)
     {
@@ -196,14 +297,112 @@ std::map<VkShaderStageFlagBits, VkShaderModule> Shader::_create_modules(const GP
     return modules;
 }
 
+std::vector<std::pair<std::string, VkVertexInputAttributeDescription>> Shader::_compact_vertex_buffers(const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffers)
+{
+    const std::map<std::string, std::pair<VkFormat, uint32_t>> compact_attributes = {
+        {"position", {VK_FORMAT_R16G16B16A16_UNORM, offsetof(CompactVertex, position)}},
+        {"normal", {VK_FORMAT_R16G16_SNORM, offsetof(CompactVertex, normal)}},
+        {"uv", {VK_FORMAT_R16G16_SFLOAT, offsetof(CompactVertex, uv)}},
+        {"palette", {VK_FORMAT_R32_UINT, offsetof(CompactVertex, palette)}}};
+    std::vector<std::pair<std::string, VkVertexInputAttributeDescription>> compact_vertex_buffers;
+    for (const std::pair<std::string, VkVertexInputAttributeDescription>& vb : vertex_buffers)
+    {
+        std::map<std::string, std::pair<VkFormat, uint32_t>>::const_iterator compact = compact_attributes.find(vb.first);
+        if (compact == compact_attributes.end())
+        {
+            return {};
+        }
+        VkVertexInputAttributeDescription attribute = vb.second;
+        attribute.format = compact->second.first;
+        attribute.offset = compact->second.second;
+        compact_vertex_buffers.push_back({vb.first, attribute});
+    }
+    return compact_vertex_buffers;
+}
+
+void Shader::_check_vertex_inputs(const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffers,
+                                  const std::map<VkShaderStageFlagBits, std::vector<uint8_t>>& shader_stages_bytecode)
+{
+    std::map<VkShaderStageFlagBits, std::vector<uint8_t>>::const_iterator vertex_stage = shader_stages_bytecode.find(VK_SHADER_STAGE_VERTEX_BIT);
+    if (vertex_stage == shader_stages_bytecode.end())
+    {
+        return;
+    }
+    std::set<uint32_t> declared_locations;
+    for (const std::pair<const uint32_t, SpirvVariable>& variable : spirv_variables(vertex_stage->second))
+    {
+        if (variable.second.storage_class == SPIRV_STORAGE_CLASS_INPUT && variable.second.location.has_value())
+        {
+            declared_locations.insert(variable.second.location.value());
+        }
+    }
+    std::set<uint32_t> described_locations;
+    for (const std::pair<std::string, VkVertexInputAttributeDescription>& vb : vertex_buffers)
+    {
+        if (declared_locations.find(vb.second.location) == declared_locations.end())
+        {
+            THROW_ERROR("the vertex shader bytecode has no input at location " + std::to_string(vb.second.location) + " for the vertex attribute '" + vb.first + "', it must be regenerated with compile.py");
+        }
+        described_locations.insert(vb.second.location);
+    }
+    for (uint32_t location : declared_locations)
+    {
+        if (described_locations.find(location) == described_locations.end())
+        {
+            THROW_ERROR("the vertex shader bytecode reads an input at location " + std::to_string(location) + " that is not described by the vertex attributes, it must be regenerated with compile.py");
+        }
+    }
+}
+
+void Shader::_check_descriptor_sets(const std::vector<std::map<std::string, VkDescriptorSetLayoutBinding>>& descriptor_sets,
+                                    const std::map<VkShaderStageFlagBits, std::vector<uint8_t>>& shader_stages_bytecode)
+{
+    for (const std::pair<const VkShaderStageFlagBits, std::vector<uint8_t>>& stage : shader_stages_bytecode)
+    {
+        std::set<std::pair<uint32_t, uint32_t>> declared_bindings; // (set, binding)
+        for (const std::pair<const uint32_t, SpirvVariable>& variable : spirv_variables(stage.second))
+        {
+            if (variable.second.descriptor_set.has_value() && variable.second.binding.has_value())
+            {
+                declared_bindings.insert({variable.second.descriptor_set.value(), variable.second.binding.value()});
+            }
+        }
+        std::set<std::pair<uint32_t, uint32_t>> described_bindings;
+        for (uint32_t set=0; set<descriptor_sets.size(); set++)
+        {
+            for (const std::pair<const std::string, VkDescriptorSetLayoutBinding>& descriptor : descriptor_sets[set])
+            {
+                if ((descriptor.second.stageFlags & stage.first) == 0)
+                {
+                    continue;
+                }
+                if (declared_bindings.find({set, descriptor.second.binding}) == declared_bindings.end())
+                {
+                    THROW_ERROR("the shader bytecode has no descriptor at set " + std::to_string(set) + " binding " + std::to_string(descriptor.second.binding) + " for '" + descriptor.first + "', it must be regenerated with compile.py");
+                }
+                described_bindings.insert({set, descriptor.second.binding});
+            }
+        }
+        for (const std::pair<uint32_t, uint32_t>& binding : declared_bindings)
+        {
+            if (described_bindings.find(binding) == described_bindings.end())
+            {
+                THROW_ERROR("the shader bytecode reads a descriptor at set " + std::to_string(binding.first) + " binding " + std::to_string(binding.second) + " that is not described by the descriptor sets, it must be regenerated with compile.py");
+            }
+        }
+    }
+}
+
 VkPipeline Shader::_create_graphics_pipeline(const GPU& gpu,
                                const std::vector<std::pair<std::string, VkVertexInputAttributeDescription>>& vertex_buffers,
+                               uint32_t vertex_stride,
                                const std::vector<std::pair<std::string, VkFormat>>& output_attachments,
                                const std::map<VkShaderStageFlagBits, VkShaderModule>& modules,
                                const VkPipelineLayout& pipeline_layout,
                                const VkRenderPass& render_pass,
                                bool depth_test,
-                               Blending blending)
+                               Blending blending,
+                               const VkSpecializationInfo* specialization)
 {
     // Staging shader modules
     std::vector<VkPipelineShaderStageCreateInfo> shader_stages;
@@ -214,6 +413,7 @@ VkPipeline Shader::_create_graphics_pipeline(const GPU& gpu,
         stage_info.stage = module.first;
         stage_info.module = module.second;
         stage_info.pName = "main";
+        stage_info.pSpecializationInfo = specialization;
         shader_stages.push_back(stage_info);
     }
     // Setting dynamic state
@@ -229,7 +429,7 @@ VkPipeline Shader::_create_graphics_pipeline(const GPU& gpu,
         vertex_input_attributes.push_back(vb.second);
     }
     VkPipelineVertexInputStateCreateInfo vertex_input_info{};
-    VkVertexInputBindingDescription input_binding_description = {0, sizeof(Vertex), VK_VERTEX_INPUT_RATE_VERTEX};
+    VkVertexInputBindingDescription input_binding_description = {0, vertex_stride, VK_VERTEX_INPUT_RATE_VERTEX};
     vertex_input_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
     vertex_input_info.vertexBindingDescriptionCount = (vertex_buffers.size() > 0) ? 1 : 0;
     vertex_input_info.pVertexBindingDescriptions = &input_binding_description;
@@ -5,14 +5,15 @@ using namespace RenderEngine;
 
 
 Shader3D::Shader3D(const GPU* gpu) : Shader(gpu,
-    {{"position", {0, 0, static_cast<VkFormat>(Type::VEC3), offsetof(Vertex, position)}}, {"normal", {1, 0, static_cast<VkFormat>(Type::VEC3), offsetof(Vertex, normal)}}, {"color", {2, 0, static_cast<VkFormat>(Type::VEC4), offsetof(Vertex, color)}}, {"uv", {3, 0, static_cast<VkFormat>(Type::VEC2), offsetof(Vertex, uv)}}, {"material", {4, 0, static_cast<VkFormat>(Type::VEC3), offsetof(Vertex, material)}}},
+    {{"position", {0, 0, static_cast<VkFormat>(Type::VEC3), offsetof(Vertex, position)}}, {"normal", {1, 0, static_cast<VkFormat>(Type::VEC3), offsetof(Vertex, normal)}}, {"uv", {2, 0, static_cast<VkFormat>(Type::VEC2), offsetof(Vertex, uv)}}, {"palette", {3, 0, static_cast<VkFormat>(Type::UINT), offsetof(Vertex, palette)}}},
+    sizeof(Vertex),
     {{"albedo", VK_FORMAT_R8G8B8A8_SRGB}, {"normal", VK_FORMAT_R8G8B8A8_SNORM}, {"material", VK_FORMAT_R8G8B8A8_UNORM}},
-    {},
+    {{{"palette", {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr}}, {"instances", {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr}}}},
     {{"params", {VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(DrawParameters)}}},
     true,
     Blending::ALPHA,
     false,
-    {{VK_SHADER_STAGE_FRAGMENT_BIT, {3, 2, 35, 7, 0, 0, 1, 0, 11, 0, 13, 0, 33, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 12, 0, 4, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 9, 0, 0, 0, 11, 0, 0, 0, 13, 0, 0, 0, 16, 0, 0, 0, 23, 0, 0, 0, 24, 0, 0, 0, 32, 0, 0, 0, 16, 0, 3, 0, 4, 0, 0, 0, 7, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 10, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 99, 112, 112, 95, 115, 116, 121, 108, 101, 95, 108, 105, 110, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 0, 4, 0, 8, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 105, 110, 99, 108, 117, 100, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 4, 0, 9, 0, 0, 0, 97, 108, 98, 101, 100, 111, 0, 0, 5, 0, 5, 0, 11, 0, 0, 0, 102, 114, 97, 103, 95, 99, 111, 108, 111, 114, 0, 0, 5, 0, 6, 0, 13, 0, 0, 0, 110, 111, 114, 109, 97, 108, 95, 83, 78, 79, 82, 77, 0, 0, 0, 0, 5, 0, 5, 0, 16, 0, 0, 0, 102, 114, 97, 103, 95, 110, 111, 114, 109, 97, 108, 0, 5, 0, 6, 0, 23, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 95, 85, 78, 79, 82, 77, 0, 0, 5, 0, 6, 0, 24, 0, 0, 0, 102, 114, 97, 103, 95, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 5, 0, 4, 0, 32, 0, 0, 0, 102, 114, 97, 103, 95, 117, 118, 0, 71, 0, 4, 0, 9, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 11, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 13, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 16, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 23, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 24, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 32, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 10, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 10, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 13, 0, 0, 0, 3, 0, 0, 0, 23, 0, 4, 0, 14, 0, 0, 0, 6, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 15, 0, 0, 0, 1, 0, 0, 0, 14, 0, 0, 0, 59, 0, 4, 0, 15, 0, 0, 0, 16, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 18, 0, 0, 0, 0, 0, 128, 63, 59, 0, 4, 0, 8, 0, 0, 0, 23, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 15, 0, 0, 0, 24, 0, 0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 30, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 31, 0, 0, 0, 1, 0, 0, 0, 30, 0, 0, 0, 59, 0, 4, 0, 31, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 12, 0, 0, 0, 11, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 12, 0, 0, 0, 61, 0, 4, 0, 14, 0, 0, 0, 17, 0, 0, 0, 16, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 19, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 20, 0, 0, 0, 17, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 21, 0, 0, 0, 17, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 22, 0, 0, 0, 19, 0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 18, 0, 0, 0, 62, 0, 3, 0, 13, 0, 0, 0, 22, 0, 0, 0, 61, 0, 4, 0, 14, 0, 0, 0, 25, 0, 0, 0, 24, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 26, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 27, 0, 0, 0, 25, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 28, 0, 0, 0, 25, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 29, 0, 0, 0, 26, 0, 0, 0, 27, 0, 0, 0, 28, 0, 0, 0, 18, 0, 0, 0, 62, 0, 3, 0, 23, 0, 0, 0, 29, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0}}, {VK_SHADER_STAGE_VERTEX_BIT, {3, 2, 35, 7, 0, 0, 1, 0, 11, 0, 13, 0, 229, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 15, 0, 0, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 185, 0, 0, 0, 193, 0, 0, 0, 199, 0, 0, 0, 214, 0, 0, 0, 216, 0, 0, 0, 219, 0, 0, 0, 221, 0, 0, 0, 222, 0, 0, 0, 226, 0, 0, 0, 228, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 8, 0, 71, 76, 95, 69, 88, 84, 95, 115, 99, 97, 108, 97, 114, 95, 98, 108, 111, 99, 107, 95, 108, 97, 121, 111, 117, 116, 0, 0, 4, 0, 10, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 99, 112, 112, 95, 115, 116, 121, 108, 101, 95, 108, 105, 110, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 0, 4, 0, 8, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 105, 110, 99, 108, 117, 100, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 11, 0, 17, 0, 0, 0, 99, 108, 105, 112, 95, 115, 112, 97, 99, 101, 95, 99, 111, 111, 114, 100, 105, 110, 97, 116, 101, 115, 40, 118, 102, 51, 59, 118, 102, 52, 59, 117, 49, 59, 0, 0, 5, 0, 5, 0, 14, 0, 0, 0, 112, 111, 115, 105, 116, 105, 111, 110, 0, 0, 0, 0, 5, 0, 7, 0, 15, 0, 0, 0, 99, 97, 109, 101, 114, 97, 95, 112, 97, 114, 97, 109, 101, 116, 101, 114, 115, 0, 0, 0, 5, 0, 6, 0, 16, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 95, 116, 121, 112, 101, 0, 5, 0, 6, 0, 20, 0, 0, 0, 97, 112, 101, 114, 116, 117, 114, 101, 95, 119, 105, 100, 116, 104, 0, 0, 5, 0, 6, 0, 24, 0, 0, 0, 97, 112, 101, 114, 116, 117, 114, 101, 95, 104, 101, 105, 103, 104, 116, 0, 5, 0, 6, 0, 28, 0, 0, 0, 102, 111, 99, 97, 108, 95, 108, 101, 110, 103, 116, 104, 0, 0, 0, 0, 5, 0, 6, 0, 32, 0, 0, 0, 109, 97, 120, 95, 100, 105, 115, 116, 97, 110, 99, 101, 0, 0, 0, 0, 5, 0, 3, 0, 98, 0, 0, 0, 114, 0, 0, 0, 5, 0, 4, 0, 117, 0, 0, 0, 116, 104, 101, 116, 97, 0, 0, 0, 5, 0, 3, 0, 125, 0, 0, 0, 112, 104, 105, 0, 5, 0, 5, 0, 162, 0, 0, 0, 112, 111, 115, 105, 116, 105, 111, 110, 0, 0, 0, 0, 5, 0, 6, 0, 164, 0, 0, 0, 68, 114, 97, 119, 80, 97, 114, 97, 109, 101, 116, 101, 114, 115, 0, 0, 6, 0, 7, 0, 164, 0, 0, 0, 0, 0, 0, 0, 109, 101, 115, 104, 95, 112, 111, 115, 105, 116, 105, 111, 110, 0, 0, 0, 6, 0, 9, 0, 164, 0, 0, 0, 1, 0, 0, 0, 109, 101, 115, 104, 95, 105, 110, 118, 101, 114, 115, 101, 95, 114, 111, 116, 97, 116, 105, 111, 110, 0, 0, 0, 6, 0, 8, 0, 164, 0, 0, 0, 2, 0, 0, 0, 99, 97, 109, 101, 114, 97, 95, 112, 97, 114, 97, 109, 101, 116, 101, 114, 115, 0, 0, 0, 6, 0, 7, 0, 164, 0, 0, 0, 3, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 95, 116, 121, 112, 101, 0, 6, 0, 6, 0, 164, 0, 0, 0, 4, 0, 0, 0, 109, 101, 115, 104, 95, 115, 99, 97, 108, 101, 0, 0, 5, 0, 4, 0, 166, 0, 0, 0, 112, 97, 114, 97, 109, 115, 0, 0, 5, 0, 6, 0, 185, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 112, 111, 115, 105, 116, 105, 111, 110, 0, 5, 0, 4, 0, 190, 0, 0, 0, 110, 111, 114, 109, 97, 108, 0, 0, 5, 0, 6, 0, 193, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 110, 111, 114, 109, 97, 108, 0, 0, 0, 5, 0, 6, 0, 197, 0, 0, 0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 197, 0, 0, 0, 0, 0, 0, 0, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 0, 6, 0, 7, 0, 197, 0, 0, 0, 1, 0, 0, 0, 103, 108, 95, 80, 111, 105, 110, 116, 83, 105, 122, 101, 0, 0, 0, 0, 6, 0, 7, 0, 197, 0, 0, 0, 2, 0, 0, 0, 103, 108, 95, 67, 108, 105, 112, 68, 105, 115, 116, 97, 110, 99, 101, 0, 6, 0, 7, 0, 197, 0, 0, 0, 3, 0, 0, 0, 103, 108, 95, 67, 117, 108, 108, 68, 105, 115, 116, 97, 110, 99, 101, 0, 5, 0, 3, 0, 199, 0, 0, 0, 0, 0, 0, 0, 5, 0, 4, 0, 202, 0, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 204, 0, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 207, 0, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 5, 0, 214, 0, 0, 0, 102, 114, 97, 103, 95, 99, 111, 108, 111, 114, 0, 0, 5, 0, 6, 0, 216, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 99, 111, 108, 111, 114, 0, 0, 0, 0, 5, 0, 5, 0, 219, 0, 0, 0, 102, 114, 97, 103, 95, 110, 111, 114, 109, 97, 108, 0, 5, 0, 6, 0, 221, 0, 0, 0, 102, 114, 97, 103, 95, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 5, 0, 6, 0, 222, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 109, 97, 116, 101, 114, 105, 97, 108, 0, 5, 0, 5, 0, 226, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 117, 118, 0, 0, 0, 5, 0, 4, 0, 228, 0, 0, 0, 102, 114, 97, 103, 95, 117, 118, 0, 72, 0, 5, 0, 164, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 4, 0, 164, 0, 0, 0, 1, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 164, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 16, 0, 0, 0, 72, 0, 5, 0, 164, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 72, 0, 5, 0, 164, 0, 0, 0, 2, 0, 0, 0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 164, 0, 0, 0, 3, 0, 0, 0, 35, 0, 0, 0, 80, 0, 0, 0, 72, 0, 5, 0, 164, 0, 0, 0, 4, 0, 0, 0, 35, 0, 0, 0, 84, 0, 0, 0, 71, 0, 3, 0, 164, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 185, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 193, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 1, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 2, 0, 0, 0, 11, 0, 0, 0, 3, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 3, 0, 0, 0, 11, 0, 0, 0, 4, 0, 0, 0, 71, 0, 3, 0, 197, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 214, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 216, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 219, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 221, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 222, 0, 0, 0, 30, 0, 0, 0, 4, 0, 0, 0, 71, 0, 4, 0, 226, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 228, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 23, 0, 4, 0, 9, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 10, 0, 0, 0, 7, 0, 0, 0, 9, 0, 0, 0, 21, 0, 4, 0, 11, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 12, 0, 0, 0, 7, 0, 0, 0, 11, 0, 0, 0, 33, 0, 6, 0, 13, 0, 0, 0, 9, 0, 0, 0, 8, 0, 0, 0, 10, 0, 0, 0, 12, 0, 0, 0, 32, 0, 4, 0, 19, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 25, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 29, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 33, 0, 0, 0, 3, 0, 0, 0, 20, 0, 2, 0, 37, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 63, 43, 0, 4, 0, 6, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 64, 43, 0, 4, 0, 6, 0, 0, 0, 90, 0, 0, 0, 0, 0, 128, 63, 43, 0, 4, 0, 6, 0, 0, 0, 121, 0, 0, 0, 255, 230, 219, 46, 43, 0, 4, 0, 6, 0, 0, 0, 149, 0, 0, 0, 219, 15, 73, 64, 43, 0, 4, 0, 6, 0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 44, 0, 7, 0, 9, 0, 0, 0, 159, 0, 0, 0, 158, 0, 0, 0, 158, 0, 0, 0, 158, 0, 0, 0, 158, 0, 0, 0, 24, 0, 4, 0, 163, 0, 0, 0, 7, 0, 0, 0, 3, 0, 0, 0, 30, 0, 7, 0, 164, 0, 0, 0, 9, 0, 0, 0, 163, 0, 0, 0, 9, 0, 0, 0, 11, 0, 0, 0, 6, 0, 0, 0, 32, 0, 4, 0, 165, 0, 0, 0, 9, 0, 0, 0, 164, 0, 0, 0, 59, 0, 4, 0, 165, 0, 0, 0, 166, 0, 0, 0, 9, 0, 0, 0, 21, 0, 4, 0, 167, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 169, 0, 0, 0, 9, 0, 0, 0, 9, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 176, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 177, 0, 0, 0, 9, 0, 0, 0, 163, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 180, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 181, 0, 0, 0, 9, 0, 0, 0, 6, 0, 0, 0, 32, 0, 4, 0, 184, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 184, 0, 0, 0, 185, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 184, 0, 0, 0, 193, 0, 0, 0, 1, 0, 0, 0, 28, 0, 4, 0, 196, 0, 0, 0, 6, 0, 0, 0, 25, 0, 0, 0, 30, 0, 6, 0, 197, 0, 0, 0, 9, 0, 0, 0, 6, 0, 0, 0, 196, 0, 0, 0, 196, 0, 0, 0, 32, 0, 4, 0, 198, 0, 0, 0, 3, 0, 0, 0, 197, 0, 0, 0, 59, 0, 4, 0, 198, 0, 0, 0, 199, 0, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 200, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 201, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 208, 0, 0, 0, 9, 0, 0, 0, 11, 0, 0, 0, 32, 0, 4, 0, 212, 0, 0, 0, 3, 0, 0, 0, 9, 0, 0, 0, 59, 0, 4, 0, 212, 0, 0, 0, 214, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 215, 0, 0, 0, 1, 0, 0, 0, 9, 0, 0, 0, 59, 0, 4, 0, 215, 0, 0, 0, 216, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 218, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 218, 0, 0, 0, 219, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 218, 0, 0, 0, 221, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 184, 0, 0, 0, 222, 0, 0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 224, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 225, 0, 0, 0, 1, 0, 0, 0, 224, 0, 0, 0, 59, 0, 4, 0, 225, 0, 0, 0, 226, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 227, 0, 0, 0, 3, 0, 0, 0, 224, 0, 0, 0, 59, 0, 4, 0, 227, 0, 0, 0, 228, 0, 0, 0, 3, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 162, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 190, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 202, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 10, 0, 0, 0, 204, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 12, 0, 0, 0, 207, 0, 0, 0, 7, 0, 0, 0, 65, 0, 5, 0, 169, 0, 0, 0, 170, 0, 0, 0, 166, 0, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 9, 0, 0, 0, 171, 0, 0, 0, 170, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 172, 0, 0, 0, 171, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 173, 0, 0, 0, 171, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 174, 0, 0, 0, 171, 0, 0, 0, 2, 0, 0, 0, 80, 0, 6, 0, 7, 0, 0, 0, 175, 0, 0, 0, 172, 0, 0, 0, 173, 0, 0, 0, 174, 0, 0, 0, 65, 0, 5, 0, 177, 0, 0, 0, 178, 0, 0, 0, 166, 0, 0, 0, 176, 0, 0, 0, 61, 0, 4, 0, 163, 0, 0, 0, 179, 0, 0, 0, 178, 0, 0, 0, 65, 0, 5, 0, 181, 0, 0, 0, 182, 0, 0, 0, 166, 0, 0, 0, 180, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 183, 0, 0, 0, 182, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 186, 0, 0, 0, 185, 0, 0, 0, 142, 0, 5, 0, 7, 0, 0, 0, 187, 0, 0, 0, 186, 0, 0, 0, 183, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 188, 0, 0, 0, 179, 0, 0, 0, 187, 0, 0, 0, 129, 0, 5, 0, 7, 0, 0, 0, 189, 0, 0, 0, 175, 0, 0, 0, 188, 0, 0, 0, 62, 0, 3, 0, 162, 0, 0, 0, 189, 0, 0, 0, 65, 0, 5, 0, 177, 0, 0, 0, 191, 0, 0, 0, 166, 0, 0, 0, 176, 0, 0, 0, 61, 0, 4, 0, 163, 0, 0, 0, 192, 0, 0, 0, 191, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 194, 0, 0, 0, 193, 0, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 195, 0, 0, 0, 192, 0, 0, 0, 194, 0, 0, 0, 62, 0, 3, 0, 190, 0, 0, 0, 195, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 203, 0, 0, 0, 162, 0, 0, 0, 62, 0, 3, 0, 202, 0, 0, 0, 203, 0, 0, 0, 65, 0, 5, 0, 169, 0, 0, 0, 205, 0, 0, 0, 166, 0, 0, 0, 200, 0, 0, 0, 61, 0, 4, 0, 9, 0, 0, 0, 206, 0, 0, 0, 205, 0, 0, 0, 62, 0, 3, 0, 204, 0, 0, 0, 206, 0, 0, 0, 65, 0, 5, 0, 208, 0, 0, 0, 209, 0, 0, 0, 166, 0, 0, 0, 201, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 210, 0, 0, 0, 209, 0, 0, 0, 62, 0, 3, 0, 207, 0, 0, 0, 210, 0, 0, 0, 57, 0, 7, 0, 9, 0, 0, 0, 211, 0, 0, 0, 17, 0, 0, 0, 202, 0, 0, 0, 204, 0, 0, 0, 207, 0, 0, 0, 65, 0, 5, 0, 212, 0, 0, 0, 213, 0, 0, 0, 199, 0, 0, 0, 168, 0, 0, 0, 62, 0, 3, 0, 213, 0, 0, 0, 211, 0, 0, 0, 61, 0, 4, 0, 9, 0, 0, 0, 217, 0, 0, 0, 216, 0, 0, 0, 62, 0, 3, 0, 214, 0, 0, 0, 217, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 220, 0, 0, 0, 190, 0, 0, 0, 62, 0, 3, 0, 219, 0, 0, 0, 220, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 223, 0, 0, 0, 222, 0, 0, 0, 62, 0, 3, 0, 221, 0, 0, 0, 223, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 54, 0, 5, 0, 9, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 55, 0, 3, 0, 8, 0, 0, 0, 14, 0, 0, 0, 55, 0, 3, 0, 10, 0, 0, 0, 15, 0, 0, 0, 55, 0, 3, 0, 12, 0, 0, 0, 16, 0, 0, 0, 248, 0, 2, 0, 18, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 20, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 24, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 28, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 32, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 98, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 117, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 125, 0, 0, 0, 7, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 22, 0, 0, 0, 15, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 0, 0, 0, 22, 0, 0, 0, 62, 0, 3, 0, 20, 0, 0, 0, 23, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 26, 0, 0, 0, 15, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 27, 0, 0, 0, 26, 0, 0, 0, 62, 0, 3, 0, 24, 0, 0, 0, 27, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 30, 0, 0, 0, 15, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 31, 0, 0, 0, 30, 0, 0, 0, 62, 0, 3, 0, 28, 0, 0, 0, 31, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 34, 0, 0, 0, 15, 0, 0, 0, 33, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 35, 0, 0, 0, 34, 0, 0, 0, 62, 0, 3, 0, 32, 0, 0, 0, 35, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 36, 0, 0, 0, 16, 0, 0, 0, 170, 0, 5, 0, 37, 0, 0, 0, 38, 0, 0, 0, 36, 0, 0, 0, 33, 0, 0, 0, 247, 0, 3, 0, 40, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 38, 0, 0, 0, 39, 0, 0, 0, 70, 0, 0, 0, 248, 0, 2, 0, 39, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 41, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 42, 0, 0, 0, 41, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 43, 0, 0, 0, 28, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 44, 0, 0, 0, 42, 0, 0, 0, 43, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 46, 0, 0, 0, 20, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 47, 0, 0, 0, 45, 0, 0, 0, 46, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 48, 0, 0, 0, 44, 0, 0, 0, 47, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 49, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 50, 0, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 51, 0, 0, 0, 28, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 52, 0, 0, 0, 50, 0, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 53, 0, 0, 0, 24, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 54, 0, 0, 0, 45, 0, 0, 0, 53, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 55, 0, 0, 0, 52, 0, 0, 0, 54, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 56, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 57, 0, 0, 0, 56, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 58, 0, 0, 0, 32, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 59, 0, 0, 0, 57, 0, 0, 0, 58, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 60, 0, 0, 0, 32, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 61, 0, 0, 0, 28, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 62, 0, 0, 0, 60, 0, 0, 0, 61, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 63, 0, 0, 0, 59, 0, 0, 0, 62, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 64, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 65, 0, 0, 0, 64, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 66, 0, 0, 0, 28, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 67, 0, 0, 0, 65, 0, 0, 0, 66, 0, 0, 0, 80, 0, 7, 0, 9, 0, 0, 0, 68, 0, 0, 0, 48, 0, 0, 0, 55, 0, 0, 0, 63, 0, 0, 0, 67, 0, 0, 0, 254, 0, 2, 0, 68, 0, 0, 0, 248, 0, 2, 0, 70, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 71, 0, 0, 0, 16, 0, 0, 0, 170, 0, 5, 0, 37, 0, 0, 0, 72, 0, 0, 0, 71, 0, 0, 0, 25, 0, 0, 0, 247, 0, 3, 0, 74, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 72, 0, 0, 0, 73, 0, 0, 0, 93, 0, 0, 0, 248, 0, 2, 0, 73, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 75, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 76, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 0, 0, 0, 20, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 79, 0, 0, 0, 77, 0, 0, 0, 78, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 80, 0, 0, 0, 76, 0, 0, 0, 79, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 81, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 82, 0, 0, 0, 81, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 83, 0, 0, 0, 24, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 84, 0, 0, 0, 83, 0, 0, 0, 78, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 85, 0, 0, 0, 82, 0, 0, 0, 84, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 86, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 87, 0, 0, 0, 86, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 88, 0, 0, 0, 32, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 89, 0, 0, 0, 87, 0, 0, 0, 88, 0, 0, 0, 80, 0, 7, 0, 9, 0, 0, 0, 91, 0, 0, 0, 80, 0, 0, 0, 85, 0, 0, 0, 89, 0, 0, 0, 90, 0, 0, 0, 254, 0, 2, 0, 91, 0, 0, 0, 248, 0, 2, 0, 93, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 94, 0, 0, 0, 16, 0, 0, 0, 170, 0, 5, 0, 37, 0, 0, 0, 95, 0, 0, 0, 94, 0, 0, 0, 29, 0, 0, 0, 247, 0, 3, 0, 97, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 95, 0, 0, 0, 96, 0, 0, 0, 157, 0, 0, 0, 248, 0, 2, 0, 96, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 99, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 100, 0, 0, 0, 99, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 101, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 102, 0, 0, 0, 101, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 103, 0, 0, 0, 100, 0, 0, 0, 102, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 104, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 105, 0, 0, 0, 104, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 106, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 107, 0, 0, 0, 106, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 108, 0, 0, 0, 105, 0, 0, 0, 107, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 109, 0, 0, 0, 103, 0, 0, 0, 108, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 110, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 111, 0, 0, 0, 110, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 112, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 113, 0, 0, 0, 112, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 114, 0, 0, 0, 111, 0, 0, 0, 113, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 115, 0, 0, 0, 109, 0, 0, 0, 114, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 116, 0, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 115, 0, 0, 0, 62, 0, 3, 0, 98, 0, 0, 0, 116, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 118, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 119, 0, 0, 0, 118, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 120, 0, 0, 0, 98, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 122, 0, 0, 0, 120, 0, 0, 0, 121, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 123, 0, 0, 0, 119, 0, 0, 0, 122, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 124, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 123, 0, 0, 0, 62, 0, 3, 0, 117, 0, 0, 0, 124, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 126, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 127, 0, 0, 0, 126, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 128, 0, 0, 0, 1, 0, 0, 0, 6, 0, 0, 0, 127, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 129, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 130, 0, 0, 0, 129, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 131, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 132, 0, 0, 0, 131, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 133, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 0, 0, 0, 133, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 135, 0, 0, 0, 132, 0, 0, 0, 134, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 136, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 137, 0, 0, 0, 136, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 138, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 139, 0, 0, 0, 138, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 140, 0, 0, 0, 137, 0, 0, 0, 139, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 141, 0, 0, 0, 135, 0, 0, 0, 140, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 142, 0, 0, 0, 141, 0, 0, 0, 121, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 143, 0, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 142, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 144, 0, 0, 0, 130, 0, 0, 0, 143, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 145, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 144, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 146, 0, 0, 0, 128, 0, 0, 0, 145, 0, 0, 0, 62, 0, 3, 0, 125, 0, 0, 0, 146, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 147, 0, 0, 0, 117, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 148, 0, 0, 0, 78, 0, 0, 0, 147, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 150, 0, 0, 0, 148, 0, 0, 0, 149, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 151, 0, 0, 0, 150, 0, 0, 0, 90, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 152, 0, 0, 0, 125, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 153, 0, 0, 0, 152, 0, 0, 0, 149, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 154, 0, 0, 0, 98, 0, 0, 0, 80, 0, 7, 0, 9, 0, 0, 0, 155, 0, 0, 0, 151, 0, 0, 0, 153, 0, 0, 0, 154, 0, 0, 0, 90, 0, 0, 0, 254, 0, 2, 0, 155, 0, 0, 0, 248, 0, 2, 0, 157, 0, 0, 0, 254, 0, 2, 0, 159, 0, 0, 0, 248, 0, 2, 0, 97, 0, 0, 0, 255, 0, 1, 0, 248, 0, 2, 0, 74, 0, 0, 0, 255, 0, 1, 0, 248, 0, 2, 0, 40, 0, 0, 0, 255, 0, 1, 0, 56, 0, 1, 0}}})
+    {{VK_SHADER_STAGE_FRAGMENT_BIT, {3, 2, 35, 7, 0, 0, 1, 0, 11, 0, 13, 0, 33, 0, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 12, 0, 4, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 9, 0, 0, 0, 11, 0, 0, 0, 13, 0, 0, 0, 16, 0, 0, 0, 23, 0, 0, 0, 24, 0, 0, 0, 32, 0, 0, 0, 16, 0, 3, 0, 4, 0, 0, 0, 7, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 10, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 99, 112, 112, 95, 115, 116, 121, 108, 101, 95, 108, 105, 110, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 0, 4, 0, 8, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 105, 110, 99, 108, 117, 100, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 4, 0, 9, 0, 0, 0, 97, 108, 98, 101, 100, 111, 0, 0, 5, 0, 5, 0, 11, 0, 0, 0, 102, 114, 97, 103, 95, 99, 111, 108, 111, 114, 0, 0, 5, 0, 6, 0, 13, 0, 0, 0, 110, 111, 114, 109, 97, 108, 95, 83, 78, 79, 82, 77, 0, 0, 0, 0, 5, 0, 5, 0, 16, 0, 0, 0, 102, 114, 97, 103, 95, 110, 111, 114, 109, 97, 108, 0, 5, 0, 6, 0, 23, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 95, 85, 78, 79, 82, 77, 0, 0, 5, 0, 6, 0, 24, 0, 0, 0, 102, 114, 97, 103, 95, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 5, 0, 4, 0, 32, 0, 0, 0, 102, 114, 97, 103, 95, 117, 118, 0, 71, 0, 4, 0, 9, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 11, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 13, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 16, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 23, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 24, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 32, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 9, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 10, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 10, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 13, 0, 0, 0, 3, 0, 0, 0, 23, 0, 4, 0, 14, 0, 0, 0, 6, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 15, 0, 0, 0, 1, 0, 0, 0, 14, 0, 0, 0, 59, 0, 4, 0, 15, 0, 0, 0, 16, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 18, 0, 0, 0, 0, 0, 128, 63, 59, 0, 4, 0, 8, 0, 0, 0, 23, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 15, 0, 0, 0, 24, 0, 0, 0, 1, 0, 0, 0, 23, 0, 4, 0, 30, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 31, 0, 0, 0, 1, 0, 0, 0, 30, 0, 0, 0, 59, 0, 4, 0, 31, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 12, 0, 0, 0, 11, 0, 0, 0, 62, 0, 3, 0, 9, 0, 0, 0, 12, 0, 0, 0, 61, 0, 4, 0, 14, 0, 0, 0, 17, 0, 0, 0, 16, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 19, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 20, 0, 0, 0, 17, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 21, 0, 0, 0, 17, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 22, 0, 0, 0, 19, 0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 18, 0, 0, 0, 62, 0, 3, 0, 13, 0, 0, 0, 22, 0, 0, 0, 61, 0, 4, 0, 14, 0, 0, 0, 25, 0, 0, 0, 24, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 26, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 27, 0, 0, 0, 25, 0, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 28, 0, 0, 0, 25, 0, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 7, 0, 0, 0, 29, 0, 0, 0, 26, 0, 0, 0, 27, 0, 0, 0, 28, 0, 0, 0, 18, 0, 0, 0, 62, 0, 3, 0, 23, 0, 0, 0, 29, 0, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0}}, {VK_SHADER_STAGE_VERTEX_BIT, {3, 2, 35, 7, 0, 0, 1, 0, 0, 0, 0, 0, 102, 1, 0, 0, 0, 0, 0, 0, 17, 0, 2, 0, 1, 0, 0, 0, 11, 0, 6, 0, 1, 0, 0, 0, 71, 76, 83, 76, 46, 115, 116, 100, 46, 52, 53, 48, 0, 0, 0, 0, 14, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 15, 0, 15, 0, 0, 0, 0, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 185, 0, 0, 0, 244, 0, 0, 0, 193, 0, 0, 0, 199, 0, 0, 0, 250, 0, 0, 0, 214, 0, 0, 0, 219, 0, 0, 0, 221, 0, 0, 0, 226, 0, 0, 0, 228, 0, 0, 0, 3, 0, 3, 0, 2, 0, 0, 0, 194, 1, 0, 0, 4, 0, 8, 0, 71, 76, 95, 69, 88, 84, 95, 115, 99, 97, 108, 97, 114, 95, 98, 108, 111, 99, 107, 95, 108, 97, 121, 111, 117, 116, 0, 0, 4, 0, 10, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 99, 112, 112, 95, 115, 116, 121, 108, 101, 95, 108, 105, 110, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 0, 4, 0, 8, 0, 71, 76, 95, 71, 79, 79, 71, 76, 69, 95, 105, 110, 99, 108, 117, 100, 101, 95, 100, 105, 114, 101, 99, 116, 105, 118, 101, 0, 5, 0, 4, 0, 4, 0, 0, 0, 109, 97, 105, 110, 0, 0, 0, 0, 5, 0, 11, 0, 17, 0, 0, 0, 99, 108, 105, 112, 95, 115, 112, 97, 99, 101, 95, 99, 111, 111, 114, 100, 105, 110, 97, 116, 101, 115, 40, 118, 102, 51, 59, 118, 102, 52, 59, 117, 49, 59, 0, 0, 5, 0, 5, 0, 14, 0, 0, 0, 112, 111, 115, 105, 116, 105, 111, 110, 0, 0, 0, 0, 5, 0, 7, 0, 15, 0, 0, 0, 99, 97, 109, 101, 114, 97, 95, 112, 97, 114, 97, 109, 101, 116, 101, 114, 115, 0, 0, 0, 5, 0, 6, 0, 16, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 95, 116, 121, 112, 101, 0, 5, 0, 6, 0, 20, 0, 0, 0, 97, 112, 101, 114, 116, 117, 114, 101, 95, 119, 105, 100, 116, 104, 0, 0, 5, 0, 6, 0, 24, 0, 0, 0, 97, 112, 101, 114, 116, 117, 114, 101, 95, 104, 101, 105, 103, 104, 116, 0, 5, 0, 6, 0, 28, 0, 0, 0, 102, 111, 99, 97, 108, 95, 108, 101, 110, 103, 116, 104, 0, 0, 0, 0, 5, 0, 6, 0, 32, 0, 0, 0, 109, 97, 120, 95, 100, 105, 115, 116, 97, 110, 99, 101, 0, 0, 0, 0, 5, 0, 3, 0, 98, 0, 0, 0, 114, 0, 0, 0, 5, 0, 4, 0, 117, 0, 0, 0, 116, 104, 101, 116, 97, 0, 0, 0, 5, 0, 3, 0, 125, 0, 0, 0, 112, 104, 105, 0, 5, 0, 6, 0, 185, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 112, 111, 115, 105, 116, 105, 111, 110, 0, 5, 0, 6, 0, 193, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 110, 111, 114, 109, 97, 108, 0, 0, 0, 5, 0, 6, 0, 197, 0, 0, 0, 103, 108, 95, 80, 101, 114, 86, 101, 114, 116, 101, 120, 0, 0, 0, 0, 6, 0, 6, 0, 197, 0, 0, 0, 0, 0, 0, 0, 103, 108, 95, 80, 111, 115, 105, 116, 105, 111, 110, 0, 6, 0, 7, 0, 197, 0, 0, 0, 1, 0, 0, 0, 103, 108, 95, 80, 111, 105, 110, 116, 83, 105, 122, 101, 0, 0, 0, 0, 6, 0, 7, 0, 197, 0, 0, 0, 2, 0, 0, 0, 103, 108, 95, 67, 108, 105, 112, 68, 105, 115, 116, 97, 110, 99, 101, 0, 6, 0, 7, 0, 197, 0, 0, 0, 3, 0, 0, 0, 103, 108, 95, 67, 117, 108, 108, 68, 105, 115, 116, 97, 110, 99, 101, 0, 5, 0, 3, 0, 199, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 214, 0, 0, 0, 102, 114, 97, 103, 95, 99, 111, 108, 111, 114, 0, 0, 5, 0, 5, 0, 219, 0, 0, 0, 102, 114, 97, 103, 95, 110, 111, 114, 109, 97, 108, 0, 5, 0, 6, 0, 221, 0, 0, 0, 102, 114, 97, 103, 95, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 5, 0, 5, 0, 226, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 117, 118, 0, 0, 0, 5, 0, 4, 0, 228, 0, 0, 0, 102, 114, 97, 103, 95, 117, 118, 0, 5, 0, 6, 0, 230, 0, 0, 0, 68, 114, 97, 119, 80, 97, 114, 97, 109, 101, 116, 101, 114, 115, 0, 0, 6, 0, 7, 0, 230, 0, 0, 0, 0, 0, 0, 0, 109, 101, 115, 104, 95, 116, 111, 95, 99, 97, 109, 101, 114, 97, 0, 0, 6, 0, 8, 0, 230, 0, 0, 0, 1, 0, 0, 0, 99, 97, 109, 101, 114, 97, 95, 112, 97, 114, 97, 109, 101, 116, 101, 114, 115, 0, 0, 0, 6, 0, 7, 0, 230, 0, 0, 0, 2, 0, 0, 0, 112, 114, 111, 106, 101, 99, 116, 105, 111, 110, 95, 116, 121, 112, 101, 0, 5, 0, 4, 0, 232, 0, 0, 0, 112, 97, 114, 97, 109, 115, 0, 0, 5, 0, 6, 0, 234, 0, 0, 0, 80, 97, 108, 101, 116, 116, 101, 69, 110, 116, 114, 121, 0, 0, 0, 0, 6, 0, 5, 0, 234, 0, 0, 0, 0, 0, 0, 0, 99, 111, 108, 111, 114, 0, 0, 0, 6, 0, 6, 0, 234, 0, 0, 0, 1, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 0, 5, 0, 4, 0, 236, 0, 0, 0, 80, 97, 108, 101, 116, 116, 101, 0, 6, 0, 5, 0, 236, 0, 0, 0, 0, 0, 0, 0, 101, 110, 116, 114, 105, 101, 115, 0, 5, 0, 4, 0, 238, 0, 0, 0, 112, 97, 108, 101, 116, 116, 101, 0, 5, 0, 5, 0, 240, 0, 0, 0, 73, 110, 115, 116, 97, 110, 99, 101, 115, 0, 0, 0, 6, 0, 6, 0, 240, 0, 0, 0, 0, 0, 0, 0, 116, 114, 97, 110, 115, 102, 111, 114, 109, 115, 0, 0, 5, 0, 5, 0, 242, 0, 0, 0, 105, 110, 115, 116, 97, 110, 99, 101, 115, 0, 0, 0, 5, 0, 7, 0, 244, 0, 0, 0, 103, 108, 95, 73, 110, 115, 116, 97, 110, 99, 101, 73, 110, 100, 101, 120, 0, 0, 0, 0, 5, 0, 6, 0, 247, 0, 0, 0, 80, 97, 108, 101, 116, 116, 101, 69, 110, 116, 114, 121, 0, 0, 0, 0, 6, 0, 5, 0, 247, 0, 0, 0, 0, 0, 0, 0, 99, 111, 108, 111, 114, 0, 0, 0, 6, 0, 6, 0, 247, 0, 0, 0, 1, 0, 0, 0, 109, 97, 116, 101, 114, 105, 97, 108, 0, 0, 0, 0, 5, 0, 6, 0, 250, 0, 0, 0, 118, 101, 114, 116, 101, 120, 95, 112, 97, 108, 101, 116, 116, 101, 0, 0, 5, 0, 7, 0, 252, 0, 0, 0, 79, 67, 84, 65, 72, 69, 68, 82, 65, 76, 95, 78, 79, 82, 77, 65, 76, 83, 0, 0, 5, 0, 6, 0, 255, 0, 0, 0, 109, 101, 115, 104, 95, 116, 111, 95, 99, 97, 109, 101, 114, 97, 0, 0, 5, 0, 5, 0, 0, 1, 0, 0, 112, 111, 115, 105, 116, 105, 111, 110, 0, 0, 0, 0, 5, 0, 4, 0, 1, 1, 0, 0, 110, 111, 114, 109, 97, 108, 0, 0, 5, 0, 4, 0, 2, 1, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 3, 1, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 4, 1, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 5, 1, 0, 0, 112, 97, 114, 97, 109, 0, 0, 0, 5, 0, 4, 0, 6, 1, 0, 0, 101, 110, 116, 114, 121, 0, 0, 0, 5, 0, 3, 0, 63, 1, 0, 0, 110, 0, 0, 0, 5, 0, 3, 0, 64, 1, 0, 0, 116, 0, 0, 0, 5, 0, 8, 0, 25, 1, 0, 0, 111, 99, 116, 97, 104, 101, 100, 114, 97, 108, 95, 100, 101, 99, 111, 100, 101, 40, 118, 102, 50, 59, 0, 0, 5, 0, 3, 0, 61, 1, 0, 0, 101, 0, 0, 0, 71, 0, 4, 0, 185, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 193, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 1, 0, 0, 0, 11, 0, 0, 0, 1, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 2, 0, 0, 0, 11, 0, 0, 0, 3, 0, 0, 0, 72, 0, 5, 0, 197, 0, 0, 0, 3, 0, 0, 0, 11, 0, 0, 0, 4, 0, 0, 0, 71, 0, 3, 0, 197, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 214, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 219, 0, 0, 0, 30, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 221, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 226, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 71, 0, 4, 0, 228, 0, 0, 0, 30, 0, 0, 0, 2, 0, 0, 0, 72, 0, 4, 0, 230, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 72, 0, 5, 0, 230, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 230, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 72, 0, 5, 0, 230, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 64, 0, 0, 0, 72, 0, 5, 0, 230, 0, 0, 0, 2, 0, 0, 0, 35, 0, 0, 0, 80, 0, 0, 0, 71, 0, 3, 0, 230, 0, 0, 0, 2, 0, 0, 0, 72, 0, 5, 0, 234, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 234, 0, 0, 0, 1, 0, 0, 0, 35, 0, 0, 0, 16, 0, 0, 0, 71, 0, 4, 0, 235, 0, 0, 0, 6, 0, 0, 0, 32, 0, 0, 0, 72, 0, 4, 0, 236, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 72, 0, 5, 0, 236, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 71, 0, 3, 0, 236, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 238, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 238, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 239, 0, 0, 0, 6, 0, 0, 0, 64, 0, 0, 0, 72, 0, 4, 0, 240, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 72, 0, 4, 0, 240, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 72, 0, 5, 0, 240, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 72, 0, 5, 0, 240, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 16, 0, 0, 0, 71, 0, 3, 0, 240, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 242, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 71, 0, 4, 0, 242, 0, 0, 0, 33, 0, 0, 0, 1, 0, 0, 0, 71, 0, 4, 0, 244, 0, 0, 0, 11, 0, 0, 0, 43, 0, 0, 0, 71, 0, 4, 0, 250, 0, 0, 0, 30, 0, 0, 0, 3, 0, 0, 0, 71, 0, 4, 0, 252, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 19, 0, 2, 0, 2, 0, 0, 0, 33, 0, 3, 0, 3, 0, 0, 0, 2, 0, 0, 0, 22, 0, 3, 0, 6, 0, 0, 0, 32, 0, 0, 0, 23, 0, 4, 0, 7, 0, 0, 0, 6, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 8, 0, 0, 0, 7, 0, 0, 0, 7, 0, 0, 0, 23, 0, 4, 0, 9, 0, 0, 0, 6, 0, 0, 0, 4, 0, 0, 0, 32, 0, 4, 0, 10, 0, 0, 0, 7, 0, 0, 0, 9, 0, 0, 0, 21, 0, 4, 0, 11, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 12, 0, 0, 0, 7, 0, 0, 0, 11, 0, 0, 0, 33, 0, 6, 0, 13, 0, 0, 0, 9, 0, 0, 0, 8, 0, 0, 0, 10, 0, 0, 0, 12, 0, 0, 0, 32, 0, 4, 0, 19, 0, 0, 0, 7, 0, 0, 0, 6, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 25, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 29, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 11, 0, 0, 0, 33, 0, 0, 0, 3, 0, 0, 0, 20, 0, 2, 0, 37, 0, 0, 0, 43, 0, 4, 0, 6, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 63, 43, 0, 4, 0, 6, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 64, 43, 0, 4, 0, 6, 0, 0, 0, 90, 0, 0, 0, 0, 0, 128, 63, 43, 0, 4, 0, 6, 0, 0, 0, 121, 0, 0, 0, 255, 230, 219, 46, 43, 0, 4, 0, 6, 0, 0, 0, 149, 0, 0, 0, 219, 15, 73, 64, 43, 0, 4, 0, 6, 0, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 44, 0, 7, 0, 9, 0, 0, 0, 159, 0, 0, 0, 158, 0, 0, 0, 158, 0, 0, 0, 158, 0, 0, 0, 158, 0, 0, 0, 24, 0, 4, 0, 163, 0, 0, 0, 7, 0, 0, 0, 3, 0, 0, 0, 21, 0, 4, 0, 167, 0, 0, 0, 32, 0, 0, 0, 1, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 32, 0, 4, 0, 169, 0, 0, 0, 9, 0, 0, 0, 9, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 176, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 184, 0, 0, 0, 1, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 184, 0, 0, 0, 185, 0, 0, 0, 1, 0, 0, 0, 59, 0, 4, 0, 184, 0, 0, 0, 193, 0, 0, 0, 1, 0, 0, 0, 28, 0, 4, 0, 196, 0, 0, 0, 6, 0, 0, 0, 25, 0, 0, 0, 30, 0, 6, 0, 197, 0, 0, 0, 9, 0, 0, 0, 6, 0, 0, 0, 196, 0, 0, 0, 196, 0, 0, 0, 32, 0, 4, 0, 198, 0, 0, 0, 3, 0, 0, 0, 197, 0, 0, 0, 59, 0, 4, 0, 198, 0, 0, 0, 199, 0, 0, 0, 3, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 200, 0, 0, 0, 2, 0, 0, 0, 43, 0, 4, 0, 167, 0, 0, 0, 201, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 208, 0, 0, 0, 9, 0, 0, 0, 11, 0, 0, 0, 32, 0, 4, 0, 212, 0, 0, 0, 3, 0, 0, 0, 9, 0, 0, 0, 59, 0, 4, 0, 212, 0, 0, 0, 214, 0, 0, 0, 3, 0, 0, 0, 32, 0, 4, 0, 215, 0, 0, 0, 1, 0, 0, 0, 9, 0, 0, 0, 32, 0, 4, 0, 218, 0, 0, 0, 3, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 218, 0, 0, 0, 219, 0, 0, 0, 3, 0, 0, 0, 59, 0, 4, 0, 218, 0, 0, 0, 221, 0, 0, 0, 3, 0, 0, 0, 23, 0, 4, 0, 224, 0, 0, 0, 6, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 225, 0, 0, 0, 1, 0, 0, 0, 224, 0, 0, 0, 59, 0, 4, 0, 225, 0, 0, 0, 226, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 227, 0, 0, 0, 3, 0, 0, 0, 224, 0, 0, 0, 59, 0, 4, 0, 227, 0, 0, 0, 228, 0, 0, 0, 3, 0, 0, 0, 24, 0, 4, 0, 229, 0, 0, 0, 9, 0, 0, 0, 4, 0, 0, 0, 30, 0, 5, 0, 230, 0, 0, 0, 229, 0, 0, 0, 9, 0, 0, 0, 11, 0, 0, 0, 32, 0, 4, 0, 231, 0, 0, 0, 9, 0, 0, 0, 230, 0, 0, 0, 59, 0, 4, 0, 231, 0, 0, 0, 232, 0, 0, 0, 9, 0, 0, 0, 32, 0, 4, 0, 233, 0, 0, 0, 9, 0, 0, 0, 229, 0, 0, 0, 30, 0, 4, 0, 234, 0, 0, 0, 9, 0, 0, 0, 9, 0, 0, 0, 29, 0, 3, 0, 235, 0, 0, 0, 234, 0, 0, 0, 30, 0, 3, 0, 236, 0, 0, 0, 235, 0, 0, 0, 32, 0, 4, 0, 237, 0, 0, 0, 2, 0, 0, 0, 236, 0, 0, 0, 59, 0, 4, 0, 237, 0, 0, 0, 238, 0, 0, 0, 2, 0, 0, 0, 29, 0, 3, 0, 239, 0, 0, 0, 229, 0, 0, 0, 30, 0, 3, 0, 240, 0, 0, 0, 239, 0, 0, 0, 32, 0, 4, 0, 241, 0, 0, 0, 2, 0, 0, 0, 240, 0, 0, 0, 59, 0, 4, 0, 241, 0, 0, 0, 242, 0, 0, 0, 2, 0, 0, 0, 32, 0, 4, 0, 243, 0, 0, 0, 1, 0, 0, 0, 167, 0, 0, 0, 59, 0, 4, 0, 243, 0, 0, 0, 244, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 245, 0, 0, 0, 2, 0, 0, 0, 229, 0, 0, 0, 32, 0, 4, 0, 246, 0, 0, 0, 7, 0, 0, 0, 229, 0, 0, 0, 30, 0, 4, 0, 247, 0, 0, 0, 9, 0, 0, 0, 9, 0, 0, 0, 32, 0, 4, 0, 248, 0, 0, 0, 7, 0, 0, 0, 247, 0, 0, 0, 32, 0, 4, 0, 249, 0, 0, 0, 1, 0, 0, 0, 11, 0, 0, 0, 59, 0, 4, 0, 249, 0, 0, 0, 250, 0, 0, 0, 1, 0, 0, 0, 32, 0, 4, 0, 251, 0, 0, 0, 2, 0, 0, 0, 234, 0, 0, 0, 49, 0, 3, 0, 37, 0, 0, 0, 252, 0, 0, 0, 32, 0, 4, 0, 253, 0, 0, 0, 7, 0, 0, 0, 224, 0, 0, 0, 33, 0, 4, 0, 254, 0, 0, 0, 7, 0, 0, 0, 253, 0, 0, 0, 54, 0, 5, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 248, 0, 2, 0, 5, 0, 0, 0, 59, 0, 4, 0, 246, 0, 0, 0, 255, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 0, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 1, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 253, 0, 0, 0, 2, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 3, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 10, 0, 0, 0, 4, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 12, 0, 0, 0, 5, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 248, 0, 0, 0, 6, 1, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 167, 0, 0, 0, 7, 1, 0, 0, 244, 0, 0, 0, 65, 0, 6, 0, 245, 0, 0, 0, 8, 1, 0, 0, 242, 0, 0, 0, 168, 0, 0, 0, 7, 1, 0, 0, 61, 0, 4, 0, 229, 0, 0, 0, 9, 1, 0, 0, 8, 1, 0, 0, 65, 0, 5, 0, 233, 0, 0, 0, 10, 1, 0, 0, 232, 0, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 229, 0, 0, 0, 11, 1, 0, 0, 10, 1, 0, 0, 146, 0, 5, 0, 229, 0, 0, 0, 12, 1, 0, 0, 9, 1, 0, 0, 11, 1, 0, 0, 62, 0, 3, 0, 255, 0, 0, 0, 12, 1, 0, 0, 61, 0, 4, 0, 229, 0, 0, 0, 13, 1, 0, 0, 255, 0, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 14, 1, 0, 0, 185, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 15, 1, 0, 0, 14, 1, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 16, 1, 0, 0, 14, 1, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 17, 1, 0, 0, 14, 1, 0, 0, 2, 0, 0, 0, 80, 0, 7, 0, 9, 0, 0, 0, 18, 1, 0, 0, 15, 1, 0, 0, 16, 1, 0, 0, 17, 1, 0, 0, 90, 0, 0, 0, 145, 0, 5, 0, 9, 0, 0, 0, 19, 1, 0, 0, 13, 1, 0, 0, 18, 1, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 20, 1, 0, 0, 19, 1, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 21, 1, 0, 0, 19, 1, 0, 0, 1, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 22, 1, 0, 0, 19, 1, 0, 0, 2, 0, 0, 0, 80, 0, 6, 0, 7, 0, 0, 0, 23, 1, 0, 0, 20, 1, 0, 0, 21, 1, 0, 0, 22, 1, 0, 0, 62, 0, 3, 0, 0, 1, 0, 0, 23, 1, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 24, 1, 0, 0, 193, 0, 0, 0, 62, 0, 3, 0, 1, 1, 0, 0, 24, 1, 0, 0, 247, 0, 3, 0, 27, 1, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 252, 0, 0, 0, 26, 1, 0, 0, 27, 1, 0, 0, 248, 0, 2, 0, 26, 1, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 28, 1, 0, 0, 193, 0, 0, 0, 79, 0, 7, 0, 224, 0, 0, 0, 29, 1, 0, 0, 28, 1, 0, 0, 28, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 62, 0, 3, 0, 2, 1, 0, 0, 29, 1, 0, 0, 57, 0, 5, 0, 7, 0, 0, 0, 30, 1, 0, 0, 25, 1, 0, 0, 2, 1, 0, 0, 62, 0, 3, 0, 1, 1, 0, 0, 30, 1, 0, 0, 249, 0, 2, 0, 27, 1, 0, 0, 248, 0, 2, 0, 27, 1, 0, 0, 61, 0, 4, 0, 229, 0, 0, 0, 31, 1, 0, 0, 255, 0, 0, 0, 81, 0, 5, 0, 9, 0, 0, 0, 32, 1, 0, 0, 31, 1, 0, 0, 0, 0, 0, 0, 79, 0, 8, 0, 7, 0, 0, 0, 33, 1, 0, 0, 32, 1, 0, 0, 32, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 81, 0, 5, 0, 9, 0, 0, 0, 34, 1, 0, 0, 31, 1, 0, 0, 1, 0, 0, 0, 79, 0, 8, 0, 7, 0, 0, 0, 35, 1, 0, 0, 34, 1, 0, 0, 34, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 81, 0, 5, 0, 9, 0, 0, 0, 36, 1, 0, 0, 31, 1, 0, 0, 2, 0, 0, 0, 79, 0, 8, 0, 7, 0, 0, 0, 37, 1, 0, 0, 36, 1, 0, 0, 36, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 80, 0, 6, 0, 163, 0, 0, 0, 38, 1, 0, 0, 33, 1, 0, 0, 35, 1, 0, 0, 37, 1, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 39, 1, 0, 0, 1, 1, 0, 0, 145, 0, 5, 0, 7, 0, 0, 0, 40, 1, 0, 0, 38, 1, 0, 0, 39, 1, 0, 0, 12, 0, 6, 0, 7, 0, 0, 0, 41, 1, 0, 0, 1, 0, 0, 0, 69, 0, 0, 0, 40, 1, 0, 0, 62, 0, 3, 0, 1, 1, 0, 0, 41, 1, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 42, 1, 0, 0, 0, 1, 0, 0, 62, 0, 3, 0, 3, 1, 0, 0, 42, 1, 0, 0, 65, 0, 5, 0, 169, 0, 0, 0, 43, 1, 0, 0, 232, 0, 0, 0, 176, 0, 0, 0, 61, 0, 4, 0, 9, 0, 0, 0, 44, 1, 0, 0, 43, 1, 0, 0, 62, 0, 3, 0, 4, 1, 0, 0, 44, 1, 0, 0, 65, 0, 5, 0, 208, 0, 0, 0, 45, 1, 0, 0, 232, 0, 0, 0, 200, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 46, 1, 0, 0, 45, 1, 0, 0, 62, 0, 3, 0, 5, 1, 0, 0, 46, 1, 0, 0, 57, 0, 7, 0, 9, 0, 0, 0, 47, 1, 0, 0, 17, 0, 0, 0, 3, 1, 0, 0, 4, 1, 0, 0, 5, 1, 0, 0, 65, 0, 5, 0, 212, 0, 0, 0, 48, 1, 0, 0, 199, 0, 0, 0, 168, 0, 0, 0, 62, 0, 3, 0, 48, 1, 0, 0, 47, 1, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 49, 1, 0, 0, 250, 0, 0, 0, 65, 0, 6, 0, 251, 0, 0, 0, 50, 1, 0, 0, 238, 0, 0, 0, 168, 0, 0, 0, 49, 1, 0, 0, 61, 0, 4, 0, 234, 0, 0, 0, 51, 1, 0, 0, 50, 1, 0, 0, 81, 0, 5, 0, 9, 0, 0, 0, 52, 1, 0, 0, 51, 1, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 9, 0, 0, 0, 53, 1, 0, 0, 51, 1, 0, 0, 1, 0, 0, 0, 80, 0, 5, 0, 247, 0, 0, 0, 54, 1, 0, 0, 52, 1, 0, 0, 53, 1, 0, 0, 62, 0, 3, 0, 6, 1, 0, 0, 54, 1, 0, 0, 65, 0, 5, 0, 10, 0, 0, 0, 55, 1, 0, 0, 6, 1, 0, 0, 168, 0, 0, 0, 61, 0, 4, 0, 9, 0, 0, 0, 56, 1, 0, 0, 55, 1, 0, 0, 62, 0, 3, 0, 214, 0, 0, 0, 56, 1, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 57, 1, 0, 0, 1, 1, 0, 0, 62, 0, 3, 0, 219, 0, 0, 0, 57, 1, 0, 0, 65, 0, 5, 0, 10, 0, 0, 0, 58, 1, 0, 0, 6, 1, 0, 0, 176, 0, 0, 0, 61, 0, 4, 0, 9, 0, 0, 0, 59, 1, 0, 0, 58, 1, 0, 0, 79, 0, 8, 0, 7, 0, 0, 0, 60, 1, 0, 0, 59, 1, 0, 0, 59, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 62, 0, 3, 0, 221, 0, 0, 0, 60, 1, 0, 0, 253, 0, 1, 0, 56, 0, 1, 0, 54, 0, 5, 0, 9, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 55, 0, 3, 0, 8, 0, 0, 0, 14, 0, 0, 0, 55, 0, 3, 0, 10, 0, 0, 0, 15, 0, 0, 0, 55, 0, 3, 0, 12, 0, 0, 0, 16, 0, 0, 0, 248, 0, 2, 0, 18, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 20, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 24, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 28, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 32, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 98, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 117, 0, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 125, 0, 0, 0, 7, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 22, 0, 0, 0, 15, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 23, 0, 0, 0, 22, 0, 0, 0, 62, 0, 3, 0, 20, 0, 0, 0, 23, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 26, 0, 0, 0, 15, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 27, 0, 0, 0, 26, 0, 0, 0, 62, 0, 3, 0, 24, 0, 0, 0, 27, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 30, 0, 0, 0, 15, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 31, 0, 0, 0, 30, 0, 0, 0, 62, 0, 3, 0, 28, 0, 0, 0, 31, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 34, 0, 0, 0, 15, 0, 0, 0, 33, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 35, 0, 0, 0, 34, 0, 0, 0, 62, 0, 3, 0, 32, 0, 0, 0, 35, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 36, 0, 0, 0, 16, 0, 0, 0, 170, 0, 5, 0, 37, 0, 0, 0, 38, 0, 0, 0, 36, 0, 0, 0, 33, 0, 0, 0, 247, 0, 3, 0, 40, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 38, 0, 0, 0, 39, 0, 0, 0, 70, 0, 0, 0, 248, 0, 2, 0, 39, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 41, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 42, 0, 0, 0, 41, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 43, 0, 0, 0, 28, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 44, 0, 0, 0, 42, 0, 0, 0, 43, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 46, 0, 0, 0, 20, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 47, 0, 0, 0, 45, 0, 0, 0, 46, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 48, 0, 0, 0, 44, 0, 0, 0, 47, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 49, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 50, 0, 0, 0, 49, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 51, 0, 0, 0, 28, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 52, 0, 0, 0, 50, 0, 0, 0, 51, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 53, 0, 0, 0, 24, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 54, 0, 0, 0, 45, 0, 0, 0, 53, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 55, 0, 0, 0, 52, 0, 0, 0, 54, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 56, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 57, 0, 0, 0, 56, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 58, 0, 0, 0, 32, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 59, 0, 0, 0, 57, 0, 0, 0, 58, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 60, 0, 0, 0, 32, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 61, 0, 0, 0, 28, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 62, 0, 0, 0, 60, 0, 0, 0, 61, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 63, 0, 0, 0, 59, 0, 0, 0, 62, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 64, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 65, 0, 0, 0, 64, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 66, 0, 0, 0, 28, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 67, 0, 0, 0, 65, 0, 0, 0, 66, 0, 0, 0, 80, 0, 7, 0, 9, 0, 0, 0, 68, 0, 0, 0, 48, 0, 0, 0, 55, 0, 0, 0, 63, 0, 0, 0, 67, 0, 0, 0, 254, 0, 2, 0, 68, 0, 0, 0, 248, 0, 2, 0, 70, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 71, 0, 0, 0, 16, 0, 0, 0, 170, 0, 5, 0, 37, 0, 0, 0, 72, 0, 0, 0, 71, 0, 0, 0, 25, 0, 0, 0, 247, 0, 3, 0, 74, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 72, 0, 0, 0, 73, 0, 0, 0, 93, 0, 0, 0, 248, 0, 2, 0, 73, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 75, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 76, 0, 0, 0, 75, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 77, 0, 0, 0, 20, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 79, 0, 0, 0, 77, 0, 0, 0, 78, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 80, 0, 0, 0, 76, 0, 0, 0, 79, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 81, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 82, 0, 0, 0, 81, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 83, 0, 0, 0, 24, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 84, 0, 0, 0, 83, 0, 0, 0, 78, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 85, 0, 0, 0, 82, 0, 0, 0, 84, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 86, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 87, 0, 0, 0, 86, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 88, 0, 0, 0, 32, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 89, 0, 0, 0, 87, 0, 0, 0, 88, 0, 0, 0, 80, 0, 7, 0, 9, 0, 0, 0, 91, 0, 0, 0, 80, 0, 0, 0, 85, 0, 0, 0, 89, 0, 0, 0, 90, 0, 0, 0, 254, 0, 2, 0, 91, 0, 0, 0, 248, 0, 2, 0, 93, 0, 0, 0, 61, 0, 4, 0, 11, 0, 0, 0, 94, 0, 0, 0, 16, 0, 0, 0, 170, 0, 5, 0, 37, 0, 0, 0, 95, 0, 0, 0, 94, 0, 0, 0, 29, 0, 0, 0, 247, 0, 3, 0, 97, 0, 0, 0, 0, 0, 0, 0, 250, 0, 4, 0, 95, 0, 0, 0, 96, 0, 0, 0, 157, 0, 0, 0, 248, 0, 2, 0, 96, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 99, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 100, 0, 0, 0, 99, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 101, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 102, 0, 0, 0, 101, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 103, 0, 0, 0, 100, 0, 0, 0, 102, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 104, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 105, 0, 0, 0, 104, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 106, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 107, 0, 0, 0, 106, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 108, 0, 0, 0, 105, 0, 0, 0, 107, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 109, 0, 0, 0, 103, 0, 0, 0, 108, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 110, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 111, 0, 0, 0, 110, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 112, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 113, 0, 0, 0, 112, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 114, 0, 0, 0, 111, 0, 0, 0, 113, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 115, 0, 0, 0, 109, 0, 0, 0, 114, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 116, 0, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 115, 0, 0, 0, 62, 0, 3, 0, 98, 0, 0, 0, 116, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 118, 0, 0, 0, 14, 0, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 119, 0, 0, 0, 118, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 120, 0, 0, 0, 98, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 122, 0, 0, 0, 120, 0, 0, 0, 121, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 123, 0, 0, 0, 119, 0, 0, 0, 122, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 124, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 123, 0, 0, 0, 62, 0, 3, 0, 117, 0, 0, 0, 124, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 126, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 127, 0, 0, 0, 126, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 128, 0, 0, 0, 1, 0, 0, 0, 6, 0, 0, 0, 127, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 129, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 130, 0, 0, 0, 129, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 131, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 132, 0, 0, 0, 131, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 133, 0, 0, 0, 14, 0, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 134, 0, 0, 0, 133, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 135, 0, 0, 0, 132, 0, 0, 0, 134, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 136, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 137, 0, 0, 0, 136, 0, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 138, 0, 0, 0, 14, 0, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 139, 0, 0, 0, 138, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 140, 0, 0, 0, 137, 0, 0, 0, 139, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 141, 0, 0, 0, 135, 0, 0, 0, 140, 0, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 142, 0, 0, 0, 141, 0, 0, 0, 121, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 143, 0, 0, 0, 1, 0, 0, 0, 31, 0, 0, 0, 142, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 144, 0, 0, 0, 130, 0, 0, 0, 143, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 145, 0, 0, 0, 1, 0, 0, 0, 17, 0, 0, 0, 144, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 146, 0, 0, 0, 128, 0, 0, 0, 145, 0, 0, 0, 62, 0, 3, 0, 125, 0, 0, 0, 146, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 147, 0, 0, 0, 117, 0, 0, 0, 133, 0, 5, 0, 6, 0, 0, 0, 148, 0, 0, 0, 78, 0, 0, 0, 147, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 150, 0, 0, 0, 148, 0, 0, 0, 149, 0, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 151, 0, 0, 0, 150, 0, 0, 0, 90, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 152, 0, 0, 0, 125, 0, 0, 0, 136, 0, 5, 0, 6, 0, 0, 0, 153, 0, 0, 0, 152, 0, 0, 0, 149, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 154, 0, 0, 0, 98, 0, 0, 0, 80, 0, 7, 0, 9, 0, 0, 0, 155, 0, 0, 0, 151, 0, 0, 0, 153, 0, 0, 0, 154, 0, 0, 0, 90, 0, 0, 0, 254, 0, 2, 0, 155, 0, 0, 0, 248, 0, 2, 0, 157, 0, 0, 0, 254, 0, 2, 0, 159, 0, 0, 0, 248, 0, 2, 0, 97, 0, 0, 0, 255, 0, 1, 0, 248, 0, 2, 0, 74, 0, 0, 0, 255, 0, 1, 0, 248, 0, 2, 0, 40, 0, 0, 0, 255, 0, 1, 0, 56, 0, 1, 0, 54, 0, 5, 0, 7, 0, 0, 0, 25, 1, 0, 0, 0, 0, 0, 0, 254, 0, 0, 0, 55, 0, 3, 0, 253, 0, 0, 0, 61, 1, 0, 0, 248, 0, 2, 0, 62, 1, 0, 0, 59, 0, 4, 0, 8, 0, 0, 0, 63, 1, 0, 0, 7, 0, 0, 0, 59, 0, 4, 0, 19, 0, 0, 0, 64, 1, 0, 0, 7, 0, 0, 0, 61, 0, 4, 0, 224, 0, 0, 0, 65, 1, 0, 0, 61, 1, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 66, 1, 0, 0, 65, 1, 0, 0, 0, 0, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 67, 1, 0, 0, 65, 1, 0, 0, 1, 0, 0, 0, 61, 0, 4, 0, 224, 0, 0, 0, 68, 1, 0, 0, 61, 1, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 69, 1, 0, 0, 68, 1, 0, 0, 0, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 70, 1, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 69, 1, 0, 0, 61, 0, 4, 0, 224, 0, 0, 0, 71, 1, 0, 0, 61, 1, 0, 0, 81, 0, 5, 0, 6, 0, 0, 0, 72, 1, 0, 0, 71, 1, 0, 0, 1, 0, 0, 0, 12, 0, 6, 0, 6, 0, 0, 0, 73, 1, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 72, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 74, 1, 0, 0, 90, 0, 0, 0, 70, 1, 0, 0, 131, 0, 5, 0, 6, 0, 0, 0, 75, 1, 0, 0, 74, 1, 0, 0, 73, 1, 0, 0, 80, 0, 6, 0, 7, 0, 0, 0, 76, 1, 0, 0, 66, 1, 0, 0, 67, 1, 0, 0, 75, 1, 0, 0, 62, 0, 3, 0, 63, 1, 0, 0, 76, 1, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 77, 1, 0, 0, 63, 1, 0, 0, 29, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 78, 1, 0, 0, 77, 1, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 79, 1, 0, 0, 78, 1, 0, 0, 12, 0, 7, 0, 6, 0, 0, 0, 80, 1, 0, 0, 1, 0, 0, 0, 40, 0, 0, 0, 79, 1, 0, 0, 158, 0, 0, 0, 62, 0, 3, 0, 64, 1, 0, 0, 80, 1, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 81, 1, 0, 0, 63, 1, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 82, 1, 0, 0, 81, 1, 0, 0, 190, 0, 5, 0, 37, 0, 0, 0, 83, 1, 0, 0, 82, 1, 0, 0, 158, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 84, 1, 0, 0, 64, 1, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 85, 1, 0, 0, 84, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 86, 1, 0, 0, 64, 1, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 87, 1, 0, 0, 83, 1, 0, 0, 85, 1, 0, 0, 86, 1, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 88, 1, 0, 0, 63, 1, 0, 0, 21, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 89, 1, 0, 0, 88, 1, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 90, 1, 0, 0, 89, 1, 0, 0, 87, 1, 0, 0, 62, 0, 3, 0, 88, 1, 0, 0, 90, 1, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 91, 1, 0, 0, 63, 1, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 92, 1, 0, 0, 91, 1, 0, 0, 190, 0, 5, 0, 37, 0, 0, 0, 93, 1, 0, 0, 92, 1, 0, 0, 158, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 94, 1, 0, 0, 64, 1, 0, 0, 127, 0, 4, 0, 6, 0, 0, 0, 95, 1, 0, 0, 94, 1, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 96, 1, 0, 0, 64, 1, 0, 0, 169, 0, 6, 0, 6, 0, 0, 0, 97, 1, 0, 0, 93, 1, 0, 0, 95, 1, 0, 0, 96, 1, 0, 0, 65, 0, 5, 0, 19, 0, 0, 0, 98, 1, 0, 0, 63, 1, 0, 0, 25, 0, 0, 0, 61, 0, 4, 0, 6, 0, 0, 0, 99, 1, 0, 0, 98, 1, 0, 0, 129, 0, 5, 0, 6, 0, 0, 0, 100, 1, 0, 0, 99, 1, 0, 0, 97, 1, 0, 0, 62, 0, 3, 0, 98, 1, 0, 0, 100, 1, 0, 0, 61, 0, 4, 0, 7, 0, 0, 0, 101, 1, 0, 0, 63, 1, 0, 0, 254, 0, 2, 0, 101, 1, 0, 0, 56, 0, 1, 0}}})
 {
 }
 
@@ -9,20 +9,36 @@
 
 #define PI 3.1415926535897932384626433832795
 
+// true in the pipeline reading compact vertices, whose normals are octahedral-encoded in vertex_normal.xy
+layout(constant_id = 0) const bool OCTAHEDRAL_NORMALS = false;
+
 layout(push_constant, std430) uniform DrawParameters
 {
-    vec4 mesh_position;
-	mat3 mesh_inverse_rotation;
+    mat4 mesh_to_camera;
     vec4 camera_parameters;
     uint projection_type;
-    float mesh_scale;
 } params;
 
+struct PaletteEntry
+{
+    vec4 color;
+    vec4 material;
+};
+
+layout(std430, set=0, binding=0) buffer readonly Palette
+{
+    PaletteEntry entries[];
+} palette;
+
+layout(std430, set=0, binding=1) buffer readonly Instances
+{
+    mat4 transforms[];
+} instances;
+
 layout(location = 0) in vec3 vertex_position;
 layout(location = 1) in vec3 vertex_normal;
-layout(location = 2) in vec4 vertex_color;
-layout(location = 3) in vec2 vertex_uv;
-layout(location = 4) in vec3 vertex_material;
+layout(location = 2) in vec2 vertex_uv;
+layout(location = 3) in uint vertex_palette;
 
 layout(location = 0) out vec4 frag_color;
 layout(location = 1) out vec3 frag_normal;
@@ -63,19 +79,36 @@ vec4 clip_space_coordinates(vec3 position, vec4 camera_parameters, uint projecti
     }
 }
 
+vec3 octahedral_decode(vec2 e)
+{
+    // unfolds the lower half of the octahedron, the returned direction is not normalized
+    vec3 n = vec3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += (n.x >= 0.0) ? -t : t;
+    n.y += (n.y >= 0.0) ? -t : t;
+    return n;
+}
+
 void main()
 {
-    // mesh coords to world coords
-    vec3 position = vec3(params.mesh_position) + params.mesh_inverse_rotation * (params.mesh_scale * vertex_position);
-    vec3 normal = params.mesh_inverse_rotation * vertex_normal;
+    // mesh coords to camera coords, through the transform of the instance (the identity for single draws)
+    mat4 mesh_to_camera = instances.transforms[gl_InstanceIndex] * params.mesh_to_camera;
+    vec3 position = vec3(mesh_to_camera * vec4(vertex_position, 1.0));
+    vec3 normal = vertex_normal;
+    if (OCTAHEDRAL_NORMALS)
+    {
+        normal = octahedral_decode(vertex_normal.xy);
+    }
+    normal = normalize(mat3(mesh_to_camera) * normal);
 
     // output in clip coords: normalised device coordinates = (x_clip, y_clip, z_clip) / w_clip
     gl_Position = clip_space_coordinates(position, params.camera_parameters, params.projection_type);
 
-    // return fragment attributes
-    frag_color = vertex_color;
+    // return fragment attributes, the color and material being read from the mesh's palette
+    PaletteEntry entry = palette.entries[vertex_palette];
+    frag_color = entry.color;
     frag_normal = normal;
-    frag_material = vertex_material;
+    frag_material = entry.material.xyz;
 
     //debugPrintfEXT("fragment normal is (x=%f, y=%f, z=%f)\n", frag_normal.x, frag_normal.y, frag_normal.z);
 }
\ No newline at end of file
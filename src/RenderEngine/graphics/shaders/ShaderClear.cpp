@@ -6,6 +6,7 @@ using namespace RenderEngine;
 
 ShaderClear::ShaderClear(const GPU* gpu) : Shader(gpu,
     {},
+    0,
     {{"albedo", VK_FORMAT_R8G8B8A8_SRGB}, {"normal", VK_FORMAT_R8G8B8A8_SNORM}, {"material", VK_FORMAT_R8G8B8A8_UNORM}, {"color", VK_FORMAT_R8G8B8A8_SRGB}},
     {},
     {},
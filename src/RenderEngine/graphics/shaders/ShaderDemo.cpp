@@ -6,6 +6,7 @@ using namespace RenderEngine;
 
 ShaderDemo::ShaderDemo(const GPU* gpu) : Shader(gpu,
     {},
+    0,
     {{"color", VK_FORMAT_R8G8B8A8_SRGB}},
     {},
     {},
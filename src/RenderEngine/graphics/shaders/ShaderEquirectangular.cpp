@@ -6,6 +6,7 @@ using namespace RenderEngine;
 
 ShaderEquirectangular::ShaderEquirectangular(const GPU* gpu) : Shader(gpu,
     {},
+    0,
     {},
     {},
     {},
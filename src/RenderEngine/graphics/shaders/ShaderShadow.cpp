@@ -6,8 +6,9 @@ using namespace RenderEngine;
 
 ShaderShadow::ShaderShadow(const GPU* gpu) : Shader(gpu,
     {},
+    0,
     {},
-    {{{"mesh", {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT}}}, {{"ssbo_in", {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT}}, {"ssbo_out", {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT}}}},
+    {{{"mesh", {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}}, {{"ssbo_in", {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}, {"ssbo_out", {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}}},
     {},
     false,
     Blending::ALPHA,
@@ -33,6 +33,7 @@ using namespace RenderEngine;
 
 {shader_name}::{shader_name}(const GPU* gpu) : Shader(gpu,
     {vertex_buffers},
+    {vertex_stride},
     {output_attachments},
     {descriptor_sets},
     {push_constants},
@@ -183,12 +184,14 @@ def save_shader(shader_prefix: str, code: dict, variables: dict):
     input_attachments = _nested((_image_format_spliter(att["name"]) for att in variables["input_attachments"]))
     output_attachments = _nested((_image_format_spliter(att["name"]) for att in variables["output_attachments"]))
     # for each stage, for each set, the list of descriptor sets
-    descriptors = _nested([(desc["name"], (desc["binding"], desc["type"].encode(), desc["count"], desc["stage"].encode())) for desc in descriptor_set]
+    descriptors = _nested([(desc["name"], (desc["binding"], desc["type"].encode(), desc["count"], desc["stage"].encode(), b"nullptr")) for desc in descriptor_set]
                            for i, descriptor_set in variables["descriptor_sets"].items())
     # For each subpass the vertex attributes
     vertex_buffers = _nested((vi["name"].split("_")[-1],
                              (vi["location"], vi["binding"], f"static_cast<VkFormat>(Type::{vi['type'].upper()})".encode(), f"offsetof({vi['name'].split('_')[0].title()}, {vi['name'].split('_')[-1]})".encode()))
                              for vi in variables["vertex_inputs"])
+    # size of a vertex in the vertex buffer
+    vertex_stride = f"sizeof({variables['vertex_inputs'][0]['name'].split('_')[0].title()})" if len(variables["vertex_inputs"]) > 0 else "0"
     # for each subpass the push constants
     push_constants = _nested((pc["name"], (pc["stage"].encode(), int(pc["offset"]), f"sizeof({pc['type']})".encode())) for pc in variables["push_constants"])
     # shader stage bytecodes
@@ -196,6 +199,7 @@ def save_shader(shader_prefix: str, code: dict, variables: dict):
     # writing c++ source file
     src = SHADER_SRC.format(shader_name=shader_prefix,
                             vertex_buffers=vertex_buffers,
+                            vertex_stride=vertex_stride,
                             output_attachments=output_attachments,
                             push_constants=push_constants,
                             descriptor_sets=descriptors,
@@ -155,7 +155,10 @@ void Window::_recreate_swapchain()
 
 void Window::_delete_swapchain()
 {
-    vkDeviceWaitIdle(gpu->_logical_device);
+    {
+        std::lock_guard<std::mutex> lock(gpu->_queues_mutex);
+        vkDeviceWaitIdle(gpu->_logical_device);
+    }
     delete _swap_chain;
     _swap_chain = nullptr;
 }
@@ -1,4 +1,5 @@
 #include <RenderEngine/utilities/Functions.hpp>
+#include <cstring>
 using namespace RenderEngine;
 
 unsigned int Utilities::log2(unsigned int x)
@@ -108,3 +109,72 @@ unsigned int Utilities::replace_substrings(std::string& str, const std::string&
     }
     return k;
 }
+
+uint16_t Utilities::to_half(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(float));
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    uint32_t magnitude = bits & 0x7FFFFFFFu;
+    if (magnitude >= 0x7F800000u) // infinity or NaN
+    {
+        return sign | ((magnitude > 0x7F800000u) ? 0x7E00u : 0x7C00u);
+    }
+    if (magnitude >= 0x477FF000u) // rounds to a magnitude above the largest half (65504)
+    {
+        return sign | 0x7C00u;
+    }
+    if (magnitude < 0x38800000u) // subnormal half: the mantissa is shifted by the missing exponent, rounding to nearest even
+    {
+        if (magnitude < 0x33000001u)
+        {
+            return sign;
+        }
+        uint32_t mantissa = (magnitude & 0x007FFFFFu) | 0x00800000u;
+        uint32_t shift = 126u - (magnitude >> 23);
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half & 1u)))
+        {
+            half++;
+        }
+        return sign | static_cast<uint16_t>(half);
+    }
+    // normal half: rebias the exponent and round the mantissa to nearest even (a carry correctly increments the exponent)
+    uint32_t half = ((magnitude - 0x38000000u) + 0x0FFFu + ((magnitude >> 13) & 1u)) >> 13;
+    return sign | static_cast<uint16_t>(half);
+}
+
+float Utilities::from_half(uint16_t half)
+{
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1Fu;
+    uint32_t mantissa = half & 0x03FFu;
+    uint32_t bits;
+    if (exponent == 0x1Fu) // infinity or NaN
+    {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    }
+    else if (exponent != 0)
+    {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+    else if (mantissa == 0)
+    {
+        bits = sign;
+    }
+    else // subnormal half, normalized in the float
+    {
+        exponent = 113u;
+        while ((mantissa & 0x0400u) == 0)
+        {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x03FFu) << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(float));
+    return value;
+}
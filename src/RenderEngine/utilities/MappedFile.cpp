@@ -0,0 +1,106 @@
+#include <RenderEngine/utilities/MappedFile.hpp>
+#include <RenderEngine/utilities/Macro.hpp>
+#include <stdexcept>
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+using namespace RenderEngine;
+
+
+MappedFile::MappedFile(const std::string& path)
+{
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        THROW_ERROR("Failed to open the file '" + path + "'");
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        THROW_ERROR("Failed to read the size of the file '" + path + "'");
+    }
+    _size = static_cast<std::size_t>(size.QuadPart);
+    if (_size > 0)
+    {
+        // the mapping keeps the file open
+        _mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        CloseHandle(file);
+        if (_mapping == NULL)
+        {
+            THROW_ERROR("Failed to map the file '" + path + "'");
+        }
+        _data = reinterpret_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (_data == nullptr)
+        {
+            CloseHandle(_mapping);
+            THROW_ERROR("Failed to map the file '" + path + "'");
+        }
+    }
+    else
+    {
+        CloseHandle(file);
+    }
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        THROW_ERROR("Failed to open the file '" + path + "'");
+    }
+    struct stat info;
+    if (fstat(file, &info) < 0)
+    {
+        close(file);
+        THROW_ERROR("Failed to read the size of the file '" + path + "'");
+    }
+    _size = static_cast<std::size_t>(info.st_size);
+    if (_size > 0)
+    {
+        void* memory = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (memory == MAP_FAILED)
+        {
+            close(file);
+            THROW_ERROR("Failed to map the file '" + path + "'");
+        }
+        // the file is parsed front to back, mostly
+        madvise(memory, _size, MADV_SEQUENTIAL);
+        _data = reinterpret_cast<const char*>(memory);
+    }
+    // the mapping stays valid once the file is closed
+    close(file);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#if defined(_WIN32)
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+        CloseHandle(_mapping);
+    }
+#else
+    if (_data != nullptr)
+    {
+        munmap(const_cast<char*>(_data), _size);
+    }
+#endif
+}
+
+const char* MappedFile::data() const
+{
+    return _data;
+}
+
+std::size_t MappedFile::size() const
+{
+    return _size;
+}
@@ -0,0 +1,78 @@
+// Replaces the global allocation functions to count heap allocations. They are defined in their own translation unit, so that the compiler never sees
+// a pointer returned by malloc reaching 'operator delete' (-Wmismatched-new-delete). All the replaceable non aligned forms are defined, so that every
+// allocation and deallocation goes through malloc and free. Aligned allocations keep the default functions, and are not counted.
+#include "allocations_counter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<std::size_t> allocations(0);
+
+    void* allocate(std::size_t size) noexcept
+    {
+        allocations++;
+        return std::malloc(size == 0 ? 1 : size);
+    }
+}
+
+std::size_t allocations_count()
+{
+    return allocations.load();
+}
+
+void* operator new(std::size_t size)
+{
+    void* ptr = allocate(size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
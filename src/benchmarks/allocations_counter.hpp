@@ -0,0 +1,5 @@
+#pragma once
+#include <cstddef>
+
+// Number of heap allocations made since the start of the program, counted by the global allocation functions replaced in allocations_counter.cpp
+std::size_t allocations_count();
@@ -0,0 +1,246 @@
+// Micro benchmarks of the geometry library. Runs on CPU only: no GPU or window is required.
+// Reports the mean time per operation and the number of heap allocations per operation.
+#include <RenderEngine/geometry/geometry.hpp>
+#include "allocations_counter.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+using namespace RenderEngine;
+
+// prevents the compiler from optimizing away the benchmarked computations
+static volatile double sink = 0.;
+
+// Runs 'function' (which performs 'operations' operations per call) repeatedly for at least 'min_seconds', and prints the time and allocations per operation
+template<typename F>
+void benchmark(const std::string& name, std::size_t operations, F function, double min_seconds=0.2)
+{
+    function();  // warm up
+    std::size_t calls = 0;
+    std::size_t allocations_start = allocations_count();
+    std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed(0.);
+    while (elapsed.count() < min_seconds)
+    {
+        function();
+        calls++;
+        elapsed = std::chrono::steady_clock::now() - start;
+    }
+    std::size_t allocations = allocations_count() - allocations_start;
+    double total_operations = static_cast<double>(calls * operations);
+    std::printf("%-48s %12.2f ns/op %10.3f allocs/op\n", name.c_str(), elapsed.count() * 1.0E9 / total_operations, allocations / total_operations);
+}
+
+// Returns a list of 'n' random quaternions of unit norm
+static std::vector<Quaternion> random_quaternions(std::size_t n, std::mt19937& generator)
+{
+    std::uniform_real_distribution<double> uniform(-1., 1.);
+    std::vector<Quaternion> quaternions;
+    for (std::size_t i=0; i<n; i++)
+    {
+        Quaternion q(uniform(generator), uniform(generator), uniform(generator), uniform(generator));
+        quaternions.push_back(q / q.norm());
+    }
+    return quaternions;
+}
+
+// Returns a list of 'n' random vectors
+static std::vector<Vector> random_vectors(std::size_t n, std::mt19937& generator)
+{
+    std::uniform_real_distribution<double> uniform(-10., 10.);
+    std::vector<Vector> vectors;
+    for (std::size_t i=0; i<n; i++)
+    {
+        vectors.emplace_back(uniform(generator), uniform(generator), uniform(generator));
+    }
+    return vectors;
+}
+
+int main()
+{
+    std::mt19937 generator(0);
+    const std::size_t n = 1024;
+    const std::vector<Quaternion> quaternions = random_quaternions(n, generator);
+    const std::vector<Vector> vectors = random_vectors(n, generator);
+    std::vector<Quaternionf> quaternionsf;
+    for (const Quaternion& q : quaternions)
+    {
+        quaternionsf.emplace_back(q);
+    }
+
+    std::printf("--- Vector/Quaternion/Matrix ---\n");
+    benchmark("Quaternion * Quaternion", n, [&]()
+    {
+        Quaternion q;
+        for (const Quaternion& other : quaternions)
+        {
+            q = q * other;
+        }
+        sink = sink + q.w;
+    });
+    benchmark("Quaternionf * Quaternionf", n, [&]()
+    {
+        Quaternionf q;
+        for (const Quaternionf& other : quaternionsf)
+        {
+            q = q * other;
+        }
+        sink = sink + q.w;
+    });
+    benchmark("Quaternion * Vector", n, [&]()
+    {
+        Vector v(1., 0., 0.);
+        for (std::size_t i=0; i<n; i++)
+        {
+            v = quaternions[i] * vectors[i];
+        }
+        sink = sink + v.x;
+    });
+    benchmark("Quaternion::SLERP", n, [&]()
+    {
+        double total = 0.;
+        for (std::size_t i=0; i<n; i++)
+        {
+            total += Quaternion::SLERP(quaternions[i], quaternions[(i+1) % n], 0.3).w;
+        }
+        sink = sink + total;
+    });
+    benchmark("Matrix(Quaternion)", n, [&]()
+    {
+        double total = 0.;
+        for (const Quaternion& q : quaternions)
+        {
+            total += Matrix(q).scalars[1][2];
+        }
+        sink = sink + total;
+    });
+    benchmark("Transform(Vector, Quaternion, double)", n, [&]()
+    {
+        double total = 0.;
+        for (std::size_t i=0; i<n; i++)
+        {
+            total += Transform(vectors[i], quaternions[i], 2.0).scalars[1][3];
+        }
+        sink = sink + total;
+    });
+
+    std::printf("--- Referential::absolute_coordinates ---\n");
+    for (unsigned int depth : {1u, 2u, 4u, 8u, 16u})
+    {
+        // build a chain of referentials of given depth
+        std::vector<std::unique_ptr<Referential>> chain;
+        chain.emplace_back(new Referential(vectors[0], quaternions[0], 1.0));
+        for (unsigned int i=1; i<depth; i++)
+        {
+            chain.emplace_back(new Referential(vectors[i], quaternions[i], 1.1, chain.back().get()));
+        }
+        Referential& leaf = *chain.back();
+        benchmark("depth " + std::to_string(depth) + ", unchanged", n, [&]()
+        {
+            double total = 0.;
+            for (std::size_t i=0; i<n; i++)
+            {
+                total += std::get<2>(leaf.absolute_coordinates());
+            }
+            sink = sink + total;
+        });
+        Referential& root = *chain.front();
+        benchmark("depth " + std::to_string(depth) + ", root moved", n, [&]()
+        {
+            double total = 0.;
+            for (std::size_t i=0; i<n; i++)
+            {
+                root.set_position(root.position() + Vector(1.0E-3, 0., 0.));
+                total += std::get<2>(leaf.absolute_coordinates());
+            }
+            sink = sink + total;
+        });
+    }
+
+    std::printf("--- Referential::coordinates_in ---\n");
+    {
+        const std::size_t n_objects = 10000;
+        // a camera in a yaw/pitch rig, and objects grouped under a few parents
+        Referential yaw(Vector(0., 1., -1.), quaternions[0]);
+        Referential pitch(Vector(), quaternions[1], 1.0, &yaw);
+        Referential camera(Vector(), Quaternion(), 1.0, &pitch);
+        std::vector<std::unique_ptr<Referential>> groups;
+        for (std::size_t i=0; i<16; i++)
+        {
+            groups.emplace_back(new Referential(vectors[i], quaternions[i], 1.0));
+        }
+        std::vector<std::unique_ptr<Referential>> objects;
+        std::vector<const Referential*> objects_pointers;
+        for (std::size_t i=0; i<n_objects; i++)
+        {
+            objects.emplace_back(new Referential(vectors[i % n], quaternions[i % n], 1.0, groups[i % groups.size()].get()));
+            objects_pointers.push_back(objects.back().get());
+        }
+        benchmark("10k objects, unchanged", n_objects, [&]()
+        {
+            double total = 0.;
+            for (const std::unique_ptr<Referential>& object : objects)
+            {
+                total += std::get<2>(object->coordinates_in(camera));
+            }
+            sink = sink + total;
+        });
+        benchmark("10k objects, camera moved", n_objects, [&]()
+        {
+            yaw.set_position(yaw.position() + Vector(1.0E-3, 0., 0.));
+            double total = 0.;
+            for (const std::unique_ptr<Referential>& object : objects)
+            {
+                total += std::get<2>(object->coordinates_in(camera));
+            }
+            sink = sink + total;
+        });
+        ReferentialsCoordinates coordinates;
+        benchmark("10k objects, bulk_coordinates_in", n_objects, [&]()
+        {
+            yaw.set_position(yaw.position() + Vector(1.0E-3, 0., 0.));
+            Referential::bulk_coordinates_in(camera, objects_pointers, coordinates);
+            sink = sink + coordinates.scale[0];
+        });
+    }
+
+    std::printf("--- Animation ---\n");
+    {
+        // 1024 referentials animated by tracks of 32 keyframes, played forward
+        std::vector<std::unique_ptr<Referential>> targets;
+        AnimationClip clip;
+        for (std::size_t i=0; i<n; i++)
+        {
+            targets.emplace_back(new Referential());
+            clip.tracks.emplace_back(targets.back().get());
+            for (std::size_t k=0; k<32; k++)
+            {
+                clip.tracks.back().add_keyframe(static_cast<double>(k), vectors[(i+k) % n], quaternions[(i+k) % n], 1.0);
+            }
+        }
+        double time = 0.;
+        benchmark("SLERP and lerp of 1024 referentials", n, [&]()
+        {
+            time = std::fmod(time + 1.0E-2, 31.);
+            std::size_t k = static_cast<std::size_t>(time);
+            double t = time - k;
+            for (std::size_t i=0; i<n; i++)
+            {
+                targets[i]->set_position(vectors[(i+k) % n]*(1-t) + vectors[(i+k+1) % n]*t);
+                targets[i]->set_orientation(Quaternion::SLERP(quaternions[(i+k) % n], quaternions[(i+k+1) % n], t));
+            }
+            sink = sink + targets[0]->orientation().w;
+        });
+        benchmark("AnimationClip::apply of 1024 tracks", n, [&]()
+        {
+            time = std::fmod(time + 1.0E-2, 31.);
+            clip.apply(time);
+            sink = sink + targets[0]->orientation().w;
+        });
+    }
+    return EXIT_SUCCESS;
+}
@@ -61,24 +61,24 @@ int main()
             }
             if (keyboard.keys().at("Z").down)
             {
-                yaw.position += yaw.orientation * Vector(0., 0., 1.0*dt);
+                yaw.set_position(yaw.position() + yaw.orientation() * Vector(0., 0., 1.0*dt));
             }
             if (keyboard.keys().at("S").down)
             {
-                yaw.position -= yaw.orientation * Vector(0., 0., 1.0*dt);
+                yaw.set_position(yaw.position() - yaw.orientation() * Vector(0., 0., 1.0*dt));
             }
             if (keyboard.keys().at("Q").down)
             {
-                yaw.position -= yaw.orientation * Vector(1.0*dt, 0., 0.);
+                yaw.set_position(yaw.position() - yaw.orientation() * Vector(1.0*dt, 0., 0.));
             }
             if (keyboard.keys().at("D").down)
             {
-                yaw.position += yaw.orientation * Vector(1.0*dt, 0., 0.);
+                yaw.set_position(yaw.position() + yaw.orientation() * Vector(1.0*dt, 0., 0.));
             }
             if (mouse.buttons().at("LEFT CLICK").down)
             {
-                yaw.orientation = yaw.orientation * Quaternion(mouse.dx_rel()*PI, Vector(0.0, 1.0, 0.0));
-                pitch.orientation = pitch.orientation * Quaternion(mouse.dy_rel()*PI, Vector(-1.0, 0.0, 0.0));
+                yaw.set_orientation(yaw.orientation() * Quaternion(mouse.dx_rel()*PI, Vector(0.0, 1.0, 0.0)));
+                pitch.set_orientation(pitch.orientation() * Quaternion(mouse.dy_rel()*PI, Vector(-1.0, 0.0, 0.0)));
             }
             if (keyboard.keys().at("PRINT SCREEN").was_released)
             {